@@ -71,6 +71,37 @@ static const char maximum_inference_rate_message[] =
     "If not specified, default value is 0, the inference will run at maximium rate depending on a device capabilities. "
     "Tweaking this value allow better accuracy in power usage measurement by limiting the execution.";
 
+/// @brief message for offered request rate
+static const char qps_message[] =
+    "Optional. Offered request rate per second. Enables the open-loop mode: requests arrive at the given rate "
+    "regardless of completion of the previous ones and the latency is counted from the arrival time, so the time "
+    "spent waiting for an idle infer request is included. Requires async API.";
+
+/// @brief message for arrival distribution
+static const char arrival_message[] =
+    "Optional. Distribution of request arrivals in the open-loop mode: \"poisson\" (default) or \"constant\".";
+
+/// @brief message for arrival trace
+static const char arrival_trace_message[] =
+    "Optional. Path to a text file with request arrival timestamps in milliseconds, one per line, to replay in the "
+    "open-loop mode. If -qps is set, the trace is time-scaled to the given average rate.";
+
+/// @brief message for offered load sweep
+static const char qps_sweep_message[] =
+    "Optional. Offered request rates to sweep in the open-loop mode in \"<start>:<stop>:<step>\" format. Each rate "
+    "is measured for the time given by -t or for -niter iterations and the rate where the throughput stops following "
+    "the offered load or the 99 percentile latency doubles is reported as the knee.";
+
+/// @brief message for models manifest
+static const char models_manifest_message[] =
+    "Optional. Path to JSON manifest of models to benchmark together on a shared OpenVINO Core instead of -m:\n"
+    "                              {\"models\": [{\"model\": \"a.xml\", \"device\": \"CPU\", \"shape\": "
+    "\"[1,3,224,224]\", \"nireq\": 2, \"qps\": 100, \"config\": {\"NUM_STREAMS\": \"2\"}}, ...]}\n"
+    "                              Only \"model\" is required, the device defaults to -d, the requests count to the "
+    "optimal one and a model without \"qps\" is driven closed loop. Each model is measured alone and then together "
+    "with the others for the time given by -t or for -niter iterations, and the latency percentiles, the slowdown "
+    "caused by co-location and the memory usage are reported.";
+
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
@@ -313,6 +344,21 @@ DEFINE_uint64(nireq, 0, infer_requests_count_message);
 /// @brief Execute infer requests at a fixed frequency
 DEFINE_double(max_irate, 0, maximum_inference_rate_message);
 
+/// @brief Models to benchmark together
+DEFINE_string(models_manifest, "", models_manifest_message);
+
+/// @brief Offered request rate of the open-loop mode
+DEFINE_double(qps, 0, qps_message);
+
+/// @brief Distribution of arrivals of the open-loop mode
+DEFINE_string(arrival, "poisson", arrival_message);
+
+/// @brief Arrival timestamps to replay in the open-loop mode
+DEFINE_string(arrival_trace, "", arrival_trace_message);
+
+/// @brief Offered request rates to sweep in the open-loop mode
+DEFINE_string(qps_sweep, "", qps_sweep_message);
+
 /// @brief Number of streams to use for inference on the CPU (also affects Hetero cases)
 DEFINE_string(nstreams, "", infer_num_streams_message);
 
@@ -397,6 +443,15 @@ static void show_usage() {
     std::cout << "    -max_irate \"<float>\"        " << maximum_inference_rate_message << std::endl;
     std::cout << "    -t                            " << execution_time_message << std::endl;
     std::cout << std::endl;
+    std::cout << "Open-loop load options" << std::endl;
+    std::cout << "    -qps  \"<float>\"              " << qps_message << std::endl;
+    std::cout << "    -arrival  <poisson/constant>  " << arrival_message << std::endl;
+    std::cout << "    -arrival_trace  <path>        " << arrival_trace_message << std::endl;
+    std::cout << "    -qps_sweep  <start:stop:step> " << qps_sweep_message << std::endl;
+    std::cout << std::endl;
+    std::cout << "Multi-model options" << std::endl;
+    std::cout << "    -models_manifest  <path>      " << models_manifest_message << std::endl;
+    std::cout << std::endl;
     std::cout << "Input shapes" << std::endl;
     std::cout << "    -b  <integer>                 " << batch_size_message << std::endl;
     std::cout << "    -shape                        " << shape_message << std::endl;
@@ -0,0 +1,273 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "colocation.hpp"
+#include "inputs_filling.hpp"
+// clang-format on
+
+#ifdef JSON_HEADER
+#    include <json.hpp>
+#else
+#    include <nlohmann/json.hpp>
+#endif
+
+std::vector<ColocatedModel> parse_models_manifest(const std::string& filename, const std::string& default_device) {
+    std::ifstream ifs(filename);
+    if (!ifs.is_open()) {
+        throw std::runtime_error("Can't load models manifest \"" + filename + "\".");
+    }
+
+    nlohmann::json manifest;
+    try {
+        ifs >> manifest;
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Can't parse models manifest \"" + filename + "\".\n" + e.what());
+    }
+    if (!manifest.contains("models") || !manifest.at("models").is_array() || manifest.at("models").empty()) {
+        throw std::runtime_error("Models manifest \"" + filename + "\" should contain non-empty \"models\" array.");
+    }
+
+    std::vector<ColocatedModel> models;
+    for (const auto& item : manifest.at("models")) {
+        if (!item.contains("model")) {
+            throw std::runtime_error("Every entry of models manifest \"" + filename +
+                                     "\" should have \"model\" path.");
+        }
+        ColocatedModel model;
+        model.path = item.at("model").get<std::string>();
+        model.device = item.value("device", default_device);
+        model.shape = item.value("shape", std::string{});
+        model.data_shape = item.value("data_shape", std::string{});
+        model.nireq = item.value("nireq", uint64_t{0});
+        model.qps = item.value("qps", 0.0);
+        if (model.qps < 0) {
+            throw std::runtime_error("Request rate of model \"" + model.path + "\" should not be negative.");
+        }
+        if (item.contains("config")) {
+            const auto& config = item.at("config");
+            for (auto option = config.cbegin(), end = config.cend(); option != end; ++option) {
+                model.config[option.key()] =
+                    option.value().is_string() ? option.value().get<std::string>() : option.value().dump();
+            }
+        }
+        models.push_back(std::move(model));
+    }
+    return models;
+}
+
+ColocationBenchmark::ColocationBenchmark(ov::Core& core,
+                                         const std::vector<ColocatedModel>& models,
+                                         const std::map<std::string, ov::AnyMap>& device_configs) {
+    for (const auto& desc : models) {
+        auto instance = std::make_unique<Instance>();
+        instance->desc = desc;
+
+        auto model = core.read_model(desc.path);
+        for (auto& item : model->inputs()) {
+            if (item.get_tensor().get_names().empty()) {
+                item.get_tensor_ptr()->set_names(
+                    std::unordered_set<std::string>{item.get_node_shared_ptr()->get_name()});
+            }
+        }
+        bool reshape = false;
+        auto inputs_info = get_inputs_info(desc.shape,
+                                           "",
+                                           0,
+                                           desc.data_shape,
+                                           {},
+                                           "",
+                                           "",
+                                           std::const_pointer_cast<const ov::Model>(model)->inputs(),
+                                           reshape);
+        if (reshape) {
+            benchmark_app::PartialShapes shapes = {};
+            for (auto& item : inputs_info[0])
+                shapes[item.first] = item.second.partialShape;
+            model->reshape(shapes);
+        }
+
+        ov::AnyMap config;
+        auto device_config = std::find_if(device_configs.begin(), device_configs.end(), [&](const auto& item) {
+            return desc.device.find(item.first) == 0;
+        });
+        if (device_config != device_configs.end()) {
+            config = device_config->second;
+        }
+        for (const auto& item : desc.config) {
+            config[item.first] = item.second;
+        }
+
+        auto start_time = Time::now();
+        instance->compiled_model = core.compile_model(model, desc.device, config);
+        slog::info << "Compile model " << desc.path << " for " << desc.device << " took "
+                   << double_to_string(get_duration_ms_till_now(start_time)) << " ms" << slog::endl;
+
+        auto nireq = desc.nireq;
+        if (nireq == 0) {
+            nireq = instance->compiled_model.get_property(ov::optimal_number_of_infer_requests);
+        }
+        instance->desc.nireq = nireq;
+        instance->requests =
+            std::make_unique<InferRequestsQueue>(instance->compiled_model, nireq, inputs_info.size(), false);
+
+        // every request keeps its own copy of random input data, so the measurement loop only starts the requests
+        auto inputs_data = get_tensors({}, inputs_info);
+        size_t i = 0;
+        for (auto& request : instance->requests->requests) {
+            for (auto& item : inputs_info[i % inputs_info.size()]) {
+                const auto& data = inputs_data.at(item.first);
+                const auto& input_tensor = data[i % data.size()];
+                auto request_tensor = request->get_tensor(item.first);
+                if (item.second.partialShape.is_dynamic()) {
+                    request_tensor.set_shape(input_tensor.get_shape());
+                }
+                copy_tensor_data(request_tensor, input_tensor);
+            }
+            ++i;
+        }
+
+        _instances.push_back(std::move(instance));
+    }
+}
+
+ColocationBenchmark::LoadResult ColocationBenchmark::drive(Instance& instance,
+                                                            uint64_t niter,
+                                                            uint64_t duration_nanoseconds) {
+    auto& queue = *instance.requests;
+    // warming up - out of scope
+    queue.get_idle_request()->start_async();
+    queue.wait_all();
+    queue.reset_times();
+
+    std::unique_ptr<ArrivalProcess> arrivals;
+    ns next_arrival{0};
+    bool arrivals_left = true;
+    if (instance.desc.qps > 0) {
+        arrivals = std::make_unique<ArrivalProcess>("poisson", instance.desc.qps);
+        arrivals_left = arrivals->next(next_arrival);
+    }
+
+    uint64_t iteration = 0;
+    auto start_time = Time::now();
+    int64_t exec_time = arrivals ? next_arrival.count() : 0;
+    while (arrivals_left && ((niter != 0 && iteration < niter) ||
+                             (duration_nanoseconds != 0 && static_cast<uint64_t>(exec_time) < duration_nanoseconds))) {
+        if (arrivals) {
+            const auto arrival_time = start_time + next_arrival;
+            std::this_thread::sleep_until(arrival_time);
+            queue.get_idle_request()->start_async(arrival_time);
+            arrivals_left = arrivals->next(next_arrival);
+            exec_time = next_arrival.count();
+        } else {
+            queue.get_idle_request()->start_async();
+            exec_time = std::chrono::duration_cast<ns>(Time::now() - start_time).count();
+        }
+        ++iteration;
+    }
+    queue.wait_all();
+
+    LoadResult result;
+    result.qps = 1000.0 * iteration / queue.get_duration_in_milliseconds();
+    result.latencies = queue.get_latencies();
+    return result;
+}
+
+void ColocationBenchmark::run(uint64_t niter, uint64_t duration_nanoseconds) {
+    for (auto& instance : _instances) {
+        slog::info << "Measuring " << instance->desc.path << " alone" << slog::endl;
+        instance->isolated = drive(*instance, niter, duration_nanoseconds);
+    }
+
+    slog::info << "Measuring " << _instances.size() << " models together" << slog::endl;
+    // the models start at once, otherwise the first ones would run without interference for a while
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool started = false;
+    std::vector<std::exception_ptr> errors(_instances.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < _instances.size(); i++) {
+        threads.emplace_back([&, i] {
+            try {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [&] {
+                        return started;
+                    });
+                }
+                _instances[i]->colocated = drive(*_instances[i], niter, duration_nanoseconds);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        started = true;
+    }
+    cv.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+void ColocationBenchmark::report(const std::shared_ptr<StatisticsReport>& statistics) const {
+    for (size_t i = 0; i < _instances.size(); i++) {
+        const auto& instance = *_instances[i];
+        LatencyDistribution isolated(instance.isolated.latencies);
+        LatencyDistribution colocated(instance.colocated.latencies);
+        const double slowdown = colocated.percentile(99) / isolated.percentile(99);
+
+        slog::info << "Model " << i << ": " << instance.desc.path << " on " << instance.desc.device << ", "
+                   << instance.desc.nireq << " infer requests, "
+                   << (instance.desc.qps > 0 ? double_to_string(instance.desc.qps) + " QPS offered" : "closed loop")
+                   << slog::endl;
+        slog::info << "   Alone:            " << double_to_string(instance.isolated.qps) << " QPS, P99 "
+                   << double_to_string(isolated.percentile(99)) << " ms" << slog::endl;
+        slog::info << "   Co-located:       " << double_to_string(instance.colocated.qps) << " QPS, P99 "
+                   << double_to_string(colocated.percentile(99)) << " ms" << slog::endl;
+        colocated.write_to_slog();
+        slog::info << "   P99 slowdown:     " << double_to_string(slowdown) << slog::endl;
+
+        if (statistics) {
+            statistics->add_parameters(
+                StatisticsReport::Category::RUNTIME_CONFIG,
+                {StatisticsVariant("model " + std::to_string(i), "model_" + std::to_string(i), instance.desc.path)});
+            statistics->add_parameters(
+                StatisticsReport::Category::COLOCATION,
+                {StatisticsVariant("co-located models",
+                                   "colocated_models",
+                                   std::vector<std::pair<std::string, double>>{
+                                       {"model", static_cast<double>(i)},
+                                       {"nireq", static_cast<double>(instance.desc.nireq)},
+                                       {"offered QPS", instance.desc.qps},
+                                       {"alone QPS", instance.isolated.qps},
+                                       {"alone P99 (ms)", isolated.percentile(99)},
+                                       {"co-located QPS", instance.colocated.qps},
+                                       {"co-located P50 (ms)", colocated.percentile(50)},
+                                       {"co-located P99 (ms)", colocated.percentile(99)},
+                                       {"co-located P99.9 (ms)", colocated.percentile(99.9)},
+                                       {"P99 slowdown", slowdown}})});
+        }
+    }
+}
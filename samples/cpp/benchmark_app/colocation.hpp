@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <openvino/openvino.hpp>
+#include <string>
+#include <vector>
+
+// clang-format off
+#include "infer_request_wrap.hpp"
+#include "statistics_report.hpp"
+#include "utils.hpp"
+// clang-format on
+
+/// @brief A model of the co-location benchmark and the load it is driven with
+struct ColocatedModel {
+    std::string path;
+    std::string device;
+    // input shapes in -shape and -data_shape formats
+    std::string shape;
+    std::string data_shape;
+    // 0 means the optimal number of infer requests of the compiled model
+    uint64_t nireq = 0;
+    // offered request rate, 0 means closed loop
+    double qps = 0;
+    // properties on top of the device configuration of the command line
+    ov::AnyMap config;
+};
+
+/// @brief Parses JSON manifest of co-located models:
+/// {"models": [{"model": "a.xml", "device": "CPU", "shape": "[1,3,224,224]", "nireq": 2, "qps": 100,
+///              "config": {"NUM_STREAMS": "2"}}, ...]}
+/// Only "model" is required, the device defaults to default_device.
+std::vector<ColocatedModel> parse_models_manifest(const std::string& filename, const std::string& default_device);
+
+/// @brief Runs several models on a shared ov::Core concurrently. Each model is measured alone first and then
+/// together with the others, so the interference is the ratio of the co-located results to the isolated ones.
+class ColocationBenchmark {
+public:
+    /// @param device_configs - device configurations built from the command line, the first one which the model
+    /// device starts with is used
+    ColocationBenchmark(ov::Core& core,
+                        const std::vector<ColocatedModel>& models,
+                        const std::map<std::string, ov::AnyMap>& device_configs);
+
+    ColocationBenchmark(const ColocationBenchmark&) = delete;
+    ColocationBenchmark& operator=(const ColocationBenchmark&) = delete;
+
+    /// @brief Measures each model alone and then all of them at once, the limits apply to each model in each phase
+    void run(uint64_t niter, uint64_t duration_nanoseconds);
+
+    void report(const std::shared_ptr<StatisticsReport>& statistics) const;
+
+private:
+    struct LoadResult {
+        double qps = 0;
+        std::vector<double> latencies;
+    };
+
+    struct Instance {
+        ColocatedModel desc;
+        ov::CompiledModel compiled_model;
+        std::unique_ptr<InferRequestsQueue> requests;
+        LoadResult isolated;
+        LoadResult colocated;
+    };
+
+    static LoadResult drive(Instance& instance, uint64_t niter, uint64_t duration_nanoseconds);
+
+    std::vector<std::unique_ptr<Instance>> _instances;
+};
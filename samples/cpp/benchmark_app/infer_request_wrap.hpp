@@ -50,6 +50,13 @@ public:
         _request.start_async();
     }
 
+    // the latency is counted from the time the request was due to arrive rather than from the time it was actually
+    // started, so the time spent waiting for an idle request is not hidden when the device falls behind the load
+    void start_async(const Time::time_point& arrival_time) {
+        _startTime = arrival_time;
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
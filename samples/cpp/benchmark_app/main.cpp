@@ -30,6 +30,7 @@
 #include "samples/slog.hpp"
 
 #include "benchmark_app.hpp"
+#include "colocation.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
 #include "remote_tensors_filling.hpp"
@@ -131,17 +132,24 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_models_manifest.empty()) {
         show_usage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
+    if (!FLAGS_m.empty() && !FLAGS_models_manifest.empty()) {
+        throw std::logic_error("-m and -models_manifest options can't be used together.");
+    }
 
     if (FLAGS_latency_percentile > 100 || FLAGS_latency_percentile < 1) {
         show_usage();
         throw std::logic_error("The percentile value is incorrect. The applicable values range is [1, 100].");
     }
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Incorrect -qps value. The rate should be positive.");
+    }
+    const bool openLoop = FLAGS_qps > 0 || !FLAGS_arrival_trace.empty() || !FLAGS_qps_sweep.empty();
     if (FLAGS_api == "") {
-        FLAGS_api = FLAGS_hint == "latency" ? "sync" : "async";
+        FLAGS_api = FLAGS_hint == "latency" && !openLoop && FLAGS_models_manifest.empty() ? "sync" : "async";
     }
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
@@ -152,6 +160,30 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
                 "Number of iterations should be greater than number of infer requests when using sync API.");
         }
     }
+    if (!FLAGS_models_manifest.empty()) {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Co-located models (-models_manifest option) are benchmarked with async API only.");
+        }
+        if (openLoop) {
+            throw std::logic_error("Request rates of co-located models are set in the models manifest.");
+        }
+    }
+    if (openLoop) {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Open-loop mode (-qps, -arrival_trace, -qps_sweep options) requires async API.");
+        }
+        if (FLAGS_max_irate > 0) {
+            throw std::logic_error("-max_irate option can't be used together with the open-loop mode.");
+        }
+        if (!FLAGS_qps_sweep.empty() && FLAGS_qps > 0) {
+            throw std::logic_error("-qps and -qps_sweep options can't be used together.");
+        }
+        parse_qps_sweep(FLAGS_qps_sweep);
+    }
+    if (FLAGS_arrival != "poisson" && FLAGS_arrival != "constant") {
+        throw std::logic_error(
+            "Incorrect arrival distribution. Please set -arrival option to `poisson` or `constant`.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -624,6 +656,69 @@ int main(int argc, char* argv[]) {
             core.set_property(ov::cache_dir(FLAGS_cache_dir));
         }
 
+        if (!FLAGS_models_manifest.empty()) {
+            // ----------------- 4. Reading the manifest of co-located models
+            // -------------------------------------------------
+            next_step();
+            auto models = parse_models_manifest(FLAGS_models_manifest, device_name);
+            for (size_t i = 0; i < models.size(); i++) {
+                slog::info << "Model " << i << ": " << models[i].path << " on " << models[i].device << slog::endl;
+            }
+            for (int i = 0; i < 2; i++) {
+                next_step();
+                slog::info << "Skipping the step for co-located models, the manifest shapes are used" << slog::endl;
+            }
+
+            // ----------------- 7. Loading the models to the devices
+            // ---------------------------------------------------------
+            next_step();
+            auto mem_start = get_peak_memory_usage();
+            ColocationBenchmark benchmark(core, models, config);
+            auto mem_compiled = get_peak_memory_usage();
+            slog::info << "Compile models ram used " << mem_compiled - mem_start << " KB" << slog::endl;
+            for (int i = 0; i < 2; i++) {
+                next_step();
+                slog::info << "Skipping the step for co-located models, infer requests are created with the models"
+                           << slog::endl;
+            }
+
+            // ----------------- 10. Measuring performance
+            // ------------------------------------------------------------------
+            uint64_t duration_seconds = FLAGS_t;
+            if (FLAGS_t == 0 && FLAGS_niter == 0) {
+                duration_seconds = device_default_device_duration_in_seconds(device_name);
+            }
+            std::stringstream ss;
+            ss << "Start inference of " << models.size() << " co-located models, limits per model and phase: ";
+            if (duration_seconds > 0) {
+                ss << get_duration_in_milliseconds(duration_seconds) << " ms duration";
+            }
+            if (FLAGS_niter != 0) {
+                ss << (duration_seconds > 0 ? ", " : "") << FLAGS_niter << " iterations";
+            }
+            next_step(ss.str());
+            benchmark.run(FLAGS_niter, get_duration_in_nanoseconds(duration_seconds));
+            auto mem_end = get_peak_memory_usage();
+
+            // ----------------- 11. Dumping statistics report
+            // -------------------------------------------------------------
+            next_step();
+            benchmark.report(statistics);
+            slog::info << "Peak memory usage:   " << mem_end << " KB" << slog::endl;
+            if (statistics) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("compile models ram used (KB)",
+                                       "compile_models_memory",
+                                       static_cast<unsigned long long>(mem_compiled - mem_start)),
+                     StatisticsVariant("peak memory usage (KB)",
+                                       "peak_memory",
+                                       static_cast<unsigned long long>(mem_end))});
+                statistics->dump();
+            }
+            return 0;
+        }
+
         // If set batch size, disable the auto batching
         if (FLAGS_b > 0) {
             slog::warn << "Batch size is set. Auto batching will be disabled" << slog::endl;
@@ -1030,6 +1125,14 @@ int main(int argc, char* argv[]) {
                 statistics->add_parameters(StatisticsReport::Category::RUNTIME_CONFIG,
                                            {StatisticsVariant(ss.str(), dev_name + "_streams_num", nstreams.second)});
             }
+            if (FLAGS_qps > 0 || !FLAGS_arrival_trace.empty()) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::RUNTIME_CONFIG,
+                    {StatisticsVariant("offered QPS", "offered_qps", FLAGS_qps),
+                     StatisticsVariant("arrivals",
+                                       "arrivals",
+                                       FLAGS_arrival_trace.empty() ? FLAGS_arrival : FLAGS_arrival_trace)});
+            }
         }
 
         // ----------------- 9. Creating infer requests and filling input blobs
@@ -1109,6 +1212,13 @@ int main(int argc, char* argv[]) {
                 ss << " using " << device_ss.str();
             }
         }
+        if (FLAGS_qps > 0) {
+            ss << ", open-loop " << FLAGS_arrival << " arrivals at " << FLAGS_qps << " QPS";
+        } else if (!FLAGS_arrival_trace.empty()) {
+            ss << ", open-loop arrivals from " << FLAGS_arrival_trace;
+        } else if (!FLAGS_qps_sweep.empty()) {
+            ss << ", open-loop " << FLAGS_arrival << " arrivals sweeping " << FLAGS_qps_sweep << " QPS";
+        }
         ss << ", limits: ";
         if (duration_seconds > 0) {
             ss << get_duration_in_milliseconds(duration_seconds) << " ms duration";
@@ -1208,67 +1318,126 @@ int main(int argc, char* argv[]) {
         inferRequestsQueue.reset_times();
 
         size_t processedFramesN = 0;
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
-            if (!inferRequest) {
-                OPENVINO_THROW("No idle Infer Requests!");
+        auto measure = [&](double qps) {
+            iteration = 0;
+            processedFramesN = 0;
+            // open-loop mode: requests arrive on schedule independently of the completion of the previous ones
+            std::unique_ptr<ArrivalProcess> arrivals;
+            ns nextArrival{0};
+            bool arrivalsLeft = true;
+            if (qps > 0 || !FLAGS_arrival_trace.empty()) {
+                arrivals.reset(new ArrivalProcess(FLAGS_arrival, qps, FLAGS_arrival_trace));
+                arrivalsLeft = arrivals->next(nextArrival);
             }
 
-            if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+            auto startTime = Time::now();
+            auto execTime = arrivals ? nextArrival.count()
+                                     : std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+
+            /** Start inference & calculate performance **/
+            /** to align number if iterations to guarantee that last infer requests are
+             * executed in the same conditions **/
+            while (arrivalsLeft && ((niter != 0LL && iteration < niter) ||
+                                    (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                                    (!arrivals && FLAGS_api == "async" && iteration % nireq != 0))) {
+                const auto arrivalTime = startTime + nextArrival;
+                if (arrivals) {
+                    std::this_thread::sleep_until(arrivalTime);
+                }
+                inferRequest = inferRequestsQueue.get_idle_request();
+                if (!inferRequest) {
+                    OPENVINO_THROW("No idle Infer Requests!");
+                }
 
-                if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+                if (!inferenceOnly) {
+                    auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+
+                    if (FLAGS_pcseq) {
+                        inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+                    }
+
+                    if (isDynamicNetwork) {
+                        batchSize = get_batch_size(inputs);
+                    }
+
+                    for (auto& item : inputs) {
+                        auto inputName = item.first;
+                        const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
+                        inferRequest->set_tensor(inputName, data);
+                    }
+
+                    if (useGpuMem) {
+                        auto outputTensors =
+                            ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
+                        for (auto& output : compiledModel.outputs()) {
+                            inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
+                        }
+                    }
                 }
 
-                if (isDynamicNetwork) {
-                    batchSize = get_batch_size(inputs);
+                if (FLAGS_api == "sync") {
+                    inferRequest->infer();
+                } else if (arrivals) {
+                    inferRequest->start_async(arrivalTime);
+                } else {
+                    inferRequest->start_async();
                 }
+                ++iteration;
+                processedFramesN += batchSize;
 
-                for (auto& item : inputs) {
-                    auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
-                    inferRequest->set_tensor(inputName, data);
+                if (arrivals) {
+                    arrivalsLeft = arrivals->next(nextArrival);
+                    execTime = nextArrival.count();
+                    continue;
                 }
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
-                if (useGpuMem) {
-                    auto outputTensors =
-                        ::gpu::get_remote_output_tensors(compiledModel, inferRequest->get_output_cl_buffer());
-                    for (auto& output : compiledModel.outputs()) {
-                        inferRequest->set_tensor(output.get_any_name(), outputTensors[output.get_any_name()]);
-                    }
+                if (FLAGS_max_irate > 0) {
+                    auto nextRunFinishTime = 1 / FLAGS_max_irate * processedFramesN * 1.0e9;
+                    std::this_thread::sleep_for(
+                        std::chrono::nanoseconds(static_cast<int64_t>(nextRunFinishTime - execTime)));
                 }
             }
 
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
+            // wait the latest inference executions
+            inferRequestsQueue.wait_all();
+        };
+
+        const auto sweepRates = parse_qps_sweep(FLAGS_qps_sweep);
+        if (sweepRates.empty()) {
+            measure(FLAGS_qps);
+        } else {
+            // the report below describes the last step of the sweep
+            std::vector<LoadSweepStep> sweepSteps;
+            for (auto rate : sweepRates) {
+                if (!sweepSteps.empty()) {
+                    inferRequestsQueue.reset_times();
+                }
+                measure(rate);
+                LatencyDistribution stepLatency(inferRequestsQueue.get_latencies());
+                sweepSteps.push_back({rate,
+                                      1000.0 * iteration / inferRequestsQueue.get_duration_in_milliseconds(),
+                                      stepLatency.percentile(50),
+                                      stepLatency.percentile(99)});
+                slog::info << "Offered " << double_to_string(rate) << " QPS: achieved "
+                           << double_to_string(sweepSteps.back().achieved_qps) << " QPS, median "
+                           << double_to_string(sweepSteps.back().median) << " ms, P99 "
+                           << double_to_string(sweepSteps.back().p99) << " ms" << slog::endl;
+            }
+            const auto knee = find_load_knee(sweepSteps);
+            if (knee < sweepSteps.size()) {
+                slog::info << "Load knee:           " << double_to_string(sweepSteps[knee].offered_qps) << " QPS"
+                           << slog::endl;
             } else {
-                inferRequest->start_async();
+                slog::warn << "The device doesn't keep up even with the lowest offered load" << slog::endl;
             }
-            ++iteration;
-
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
-
-            if (FLAGS_max_irate > 0) {
-                auto nextRunFinishTime = 1 / FLAGS_max_irate * processedFramesN * 1.0e9;
-                std::this_thread::sleep_for(
-                    std::chrono::nanoseconds(static_cast<int64_t>(nextRunFinishTime - execTime)));
+            if (statistics) {
+                statistics->add_load_sweep(sweepSteps);
             }
         }
 
-        // wait the latest inference executions
-        inferRequestsQueue.wait_all();
-
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+        LatencyDistribution latencyDistribution(inferRequestsQueue.get_latencies());
         std::vector<LatencyMetrics> groupLatencies = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
@@ -1307,6 +1476,7 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Average latency (ms)", "latency_avg", generalLatency.avg),
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
+                statistics->add_latency_distribution(latencyDistribution);
 
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
@@ -1375,6 +1545,7 @@ int main(int argc, char* argv[]) {
         if (device_name.find("MULTI") == std::string::npos) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
+            latencyDistribution.write_to_slog();
 
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
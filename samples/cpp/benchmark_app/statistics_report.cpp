@@ -4,6 +4,7 @@
 
 // clang-format off
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <string>
 #include <utility>
@@ -21,12 +22,99 @@ void StatisticsReport::add_parameters(const Category& category, const Parameters
         _parameters[category].insert(_parameters[category].end(), parameters.begin(), parameters.end());
 }
 
+LatencyDistribution::LatencyDistribution(std::vector<double> latencies) : _latencies(std::move(latencies)) {
+    if (_latencies.empty()) {
+        throw std::logic_error("Latency distribution expects non-empty vector of latencies at construction.");
+    }
+    std::sort(_latencies.begin(), _latencies.end());
+    // bucket bounds are 2^(k/4) ms, so the relative resolution is the same for any latency
+    static constexpr double buckets_per_octave = 4;
+    static constexpr double min_bound = 1.0e-3;
+    auto bucket_id = [](double latency) {
+        return static_cast<int>(std::ceil(std::log2(std::max(latency, min_bound)) * buckets_per_octave));
+    };
+    auto it = _latencies.begin();
+    for (int k = bucket_id(_latencies.front()); it != _latencies.end(); k++) {
+        const double bound = std::exp2(k / buckets_per_octave);
+        auto end = std::upper_bound(it, _latencies.end(), bound);
+        histogram.emplace_back(bound, static_cast<size_t>(std::distance(it, end)));
+        it = end;
+    }
+}
+
+double LatencyDistribution::percentile(double boundary) const {
+    const auto rank = static_cast<size_t>(std::ceil(boundary / 100.0 * _latencies.size()));
+    return _latencies[std::min(std::max<size_t>(rank, 1), _latencies.size()) - 1];
+}
+
+void LatencyDistribution::write_to_slog() const {
+    for (auto boundary : reported_percentiles) {
+        std::ostringstream label;
+        label << "   P" << boundary << ":";
+        slog::info << std::left << std::setw(21) << label.str() << double_to_string(percentile(boundary)) << " ms"
+                   << slog::endl;
+    }
+}
+
+size_t find_load_knee(const std::vector<LoadSweepStep>& steps) {
+    size_t knee = steps.size();
+    for (size_t i = 0; i < steps.size(); i++) {
+        if (steps[i].achieved_qps < 0.95 * steps[i].offered_qps || steps[i].p99 > 2 * steps.front().p99) {
+            break;
+        }
+        knee = i;
+    }
+    return knee;
+}
+
+void StatisticsReport::add_latency_distribution(const LatencyDistribution& distribution) {
+    Parameters percentiles;
+    for (auto boundary : LatencyDistribution::reported_percentiles) {
+        std::ostringstream name;
+        name << boundary;
+        std::string json_name = name.str();
+        std::replace(json_name.begin(), json_name.end(), '.', '_');
+        percentiles.emplace_back("P" + name.str() + " latency (ms)",
+                                 "latency_p" + json_name,
+                                 distribution.percentile(boundary));
+    }
+    add_parameters(Category::EXECUTION_RESULTS, percentiles);
+
+    Parameters histogram;
+    for (auto& bucket : distribution.histogram) {
+        histogram.emplace_back(
+            "latency histogram",
+            "latency_histogram",
+            std::vector<std::pair<std::string, double>>{{"upper bound (ms)", bucket.first},
+                                                        {"count", static_cast<double>(bucket.second)}});
+    }
+    add_parameters(Category::LATENCY_HISTOGRAM, histogram);
+}
+
+void StatisticsReport::add_load_sweep(const std::vector<LoadSweepStep>& steps) {
+    Parameters sweep;
+    for (auto& step : steps) {
+        sweep.emplace_back("load sweep",
+                           "load_sweep",
+                           std::vector<std::pair<std::string, double>>{{"offered QPS", step.offered_qps},
+                                                                       {"achieved QPS", step.achieved_qps},
+                                                                       {"median latency (ms)", step.median},
+                                                                       {"P99 latency (ms)", step.p99}});
+    }
+    add_parameters(Category::LOAD_SWEEP, sweep);
+    const auto knee = find_load_knee(steps);
+    if (knee < steps.size()) {
+        add_parameters(Category::EXECUTION_RESULTS,
+                       {StatisticsVariant("load knee (QPS)", "load_knee", steps[knee].offered_qps)});
+    }
+}
+
 void StatisticsReport::dump() {
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv", 3);
 
     auto dump_parameters = [&dumper](const Parameters& parameters) {
         for (auto& parameter : parameters) {
-            if (parameter.type != StatisticsVariant::METRICS) {
+            if (parameter.type != StatisticsVariant::METRICS && parameter.type != StatisticsVariant::VALUES) {
                 dumper << parameter.csv_name;
             }
             dumper << parameter.to_string();
@@ -67,6 +155,32 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    auto dump_table = [&](const std::string& title, const Parameters& rows) {
+        if (rows.empty()) {
+            return;
+        }
+        dumper << title;
+        dumper.endLine();
+        for (auto& column : rows.front().values_val) {
+            dumper << column.first;
+        }
+        dumper.endLine();
+
+        dump_parameters(rows);
+        dumper.endLine();
+    };
+    if (_parameters.count(Category::LATENCY_HISTOGRAM)) {
+        dump_table("Latency histogram", _parameters.at(Category::LATENCY_HISTOGRAM));
+    }
+
+    if (_parameters.count(Category::LOAD_SWEEP)) {
+        dump_table("Load sweep", _parameters.at(Category::LOAD_SWEEP));
+    }
+
+    if (_parameters.count(Category::COLOCATION)) {
+        dump_table("Co-located models", _parameters.at(Category::COLOCATION));
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
@@ -227,6 +341,15 @@ void StatisticsReportJSON::dump() {
     if (_parameters.count(Category::EXECUTION_RESULTS_GROUPPED)) {
         dump_parameters(js["execution_results"], _parameters.at(Category::EXECUTION_RESULTS_GROUPPED));
     }
+    if (_parameters.count(Category::LATENCY_HISTOGRAM)) {
+        dump_parameters(js["execution_results"], _parameters.at(Category::LATENCY_HISTOGRAM));
+    }
+    if (_parameters.count(Category::LOAD_SWEEP)) {
+        dump_parameters(js["execution_results"], _parameters.at(Category::LOAD_SWEEP));
+    }
+    if (_parameters.count(Category::COLOCATION)) {
+        dump_parameters(js["execution_results"], _parameters.at(Category::COLOCATION));
+    }
 
     std::ofstream out_stream(name);
     out_stream << std::setw(4) << js << std::endl;
@@ -353,11 +476,19 @@ std::string StatisticsVariant::to_string() const {
         return s_val;
     case ULONGLONG:
         return std::to_string(ull_val);
-    case METRICS:
+    case METRICS: {
         std::ostringstream str;
         metrics_val.write_to_stream(str);
         return str.str();
     }
+    case VALUES: {
+        std::ostringstream str;
+        for (size_t i = 0; i < values_val.size(); i++) {
+            str << (i ? ";" : "") << values_val[i].second;
+        }
+        return str.str();
+    }
+    }
     throw std::invalid_argument("StatisticsVariant::to_string : invalid type is provided");
 }
 
@@ -382,6 +513,17 @@ void StatisticsVariant::write_to_json(nlohmann::json& js) const {
         }
         arr.push_back(to_json(metrics_val));
     } break;
+    case VALUES: {
+        auto& arr = js[json_name];
+        if (arr.empty()) {
+            arr = nlohmann::json::array();
+        }
+        nlohmann::json row;
+        for (auto& value : values_val) {
+            row[value.first] = value.second;
+        }
+        arr.push_back(row);
+    } break;
     default:
         throw std::invalid_argument("StatisticsVariant:: json conversion : invalid type is provided");
     }
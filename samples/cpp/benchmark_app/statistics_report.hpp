@@ -32,7 +32,7 @@ static constexpr char sortDetailedCntReport[] = "sort_detailed_counters";
 
 class StatisticsVariant {
 public:
-    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS };
+    enum Type { INT, DOUBLE, STRING, ULONGLONG, METRICS, VALUES };
 
     StatisticsVariant(std::string csv_name, std::string json_name, int v)
         : csv_name(csv_name),
@@ -69,6 +69,12 @@ public:
           json_name(json_name),
           metrics_val(v),
           type(METRICS) {}
+    // a row of named values, rows of the same category form a table
+    StatisticsVariant(std::string csv_name, std::string json_name, std::vector<std::pair<std::string, double>> v)
+        : csv_name(csv_name),
+          json_name(json_name),
+          values_val(std::move(v)),
+          type(VALUES) {}
 
     ~StatisticsVariant() {}
 
@@ -79,12 +85,43 @@ public:
     unsigned long long ull_val = 0;
     std::string s_val;
     LatencyMetrics metrics_val;
+    std::vector<std::pair<std::string, double>> values_val;
     Type type;
 
     std::string to_string() const;
     void write_to_json(nlohmann::json& js) const;
 };
 
+/// @brief Tail percentiles and log-scale histogram of request latencies
+class LatencyDistribution {
+public:
+    explicit LatencyDistribution(std::vector<double> latencies);
+
+    /// @brief Returns the nearest-rank percentile of the latencies in ms
+    double percentile(double boundary) const;
+    void write_to_slog() const;
+
+    static constexpr double reported_percentiles[] = {50, 90, 95, 99, 99.9};
+    // histogram buckets are a quarter of an octave wide, each one is {upper bound in ms, number of requests}
+    std::vector<std::pair<double, size_t>> histogram;
+
+private:
+    std::vector<double> _latencies;
+};
+
+/// @brief Results of a single step of the offered load sweep
+struct LoadSweepStep {
+    double offered_qps;
+    double achieved_qps;
+    double median;
+    double p99;
+};
+
+/// @brief Returns the index of the step with the highest offered load the device still keeps up with: the achieved
+/// rate is at least 95% of the offered one and the 99 percentile latency is at most twice as high as at the lowest
+/// load. Returns the number of steps if even the lowest load is not sustained.
+size_t find_load_knee(const std::vector<LoadSweepStep>& steps);
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
@@ -96,7 +133,15 @@ public:
         std::string report_folder;
     };
 
-    enum class Category { COMMAND_LINE_PARAMETERS, RUNTIME_CONFIG, EXECUTION_RESULTS, EXECUTION_RESULTS_GROUPPED };
+    enum class Category {
+        COMMAND_LINE_PARAMETERS,
+        RUNTIME_CONFIG,
+        EXECUTION_RESULTS,
+        EXECUTION_RESULTS_GROUPPED,
+        LATENCY_HISTOGRAM,
+        LOAD_SWEEP,
+        COLOCATION
+    };
 
     virtual ~StatisticsReport() = default;
 
@@ -117,6 +162,10 @@ public:
 
     void add_parameters(const Category& category, const Parameters& parameters);
 
+    void add_latency_distribution(const LatencyDistribution& distribution);
+
+    void add_load_sweep(const std::vector<LoadSweepStep>& steps);
+
     virtual void dump();
 
     virtual void dump_performance_counters(const std::vector<PerformanceCounters>& perfCounts);
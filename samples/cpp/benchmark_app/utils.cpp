@@ -86,6 +86,79 @@ uint32_t device_default_device_duration_in_seconds(const std::string& device) {
     return duration;
 }
 
+ArrivalProcess::ArrivalProcess(const std::string& distribution, double qps, const std::string& trace_file)
+    : _poisson(distribution == "poisson"),
+      _qps(qps),
+      _generator(std::random_device{}()),
+      _gaps(qps > 0 ? qps : 1.0) {
+    if (trace_file.empty()) {
+        if (qps <= 0) {
+            throw std::logic_error("Request rate should be positive for the open-loop mode");
+        }
+        return;
+    }
+    std::ifstream file(trace_file);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open arrival trace file: " + trace_file);
+    }
+    // one arrival timestamp in milliseconds per line
+    double timestamp = 0;
+    while (file >> timestamp) {
+        _trace.push_back(timestamp);
+    }
+    if (_trace.empty()) {
+        throw std::logic_error("Arrival trace file " + trace_file + " contains no timestamps");
+    }
+    std::sort(_trace.begin(), _trace.end());
+    const double first = _trace.front();
+    double scale = 1.0;
+    if (qps > 0 && _trace.size() > 1 && _trace.back() > first) {
+        const double trace_qps = 1000.0 * (_trace.size() - 1) / (_trace.back() - first);
+        scale = trace_qps / qps;
+    }
+    for (auto& item : _trace) {
+        item = (item - first) * scale * 1.0e-3;
+    }
+}
+
+bool ArrivalProcess::next(ns& arrival) {
+    if (!_trace.empty()) {
+        if (_trace_pos == _trace.size()) {
+            return false;
+        }
+        _time = _trace[_trace_pos++];
+    } else if (_poisson) {
+        _time += _gaps(_generator);
+    } else {
+        _time += 1.0 / _qps;
+    }
+    arrival = ns(static_cast<int64_t>(_time * 1.0e9));
+    return true;
+}
+
+std::vector<double> parse_qps_sweep(const std::string& sweep_string) {
+    std::vector<double> rates;
+    if (sweep_string.empty()) {
+        return rates;
+    }
+    auto values = split(sweep_string, ':');
+    if (values.size() != 3) {
+        throw std::logic_error("Incorrect -qps_sweep value " + sweep_string + ", <start>:<stop>:<step> is expected");
+    }
+    const double start = std::stod(values[0]);
+    const double stop = std::stod(values[1]);
+    const double step = std::stod(values[2]);
+    if (start <= 0 || stop < start || step <= 0) {
+        throw std::logic_error("Incorrect -qps_sweep value " + sweep_string +
+                               ", positive start not greater than stop and positive step are expected");
+    }
+    // the tolerance keeps the stop value when the range is not exactly representable
+    for (double rate = start; rate <= stop + step * 1.0e-6; rate += step) {
+        rates.push_back(rate);
+    }
+    return rates;
+}
+
 std::vector<std::string> split(const std::string& s, char delim) {
     std::vector<std::string> result;
     std::stringstream ss(s);
@@ -8,6 +8,7 @@
 #include <iomanip>
 #include <map>
 #include <openvino/openvino.hpp>
+#include <random>
 #include <samples/slog.hpp>
 #include <string>
 #include <unordered_set>
@@ -58,6 +59,29 @@ using InputsInfo = std::map<std::string, InputInfo>;
 using PartialShapes = std::map<std::string, ov::PartialShape>;
 }  // namespace benchmark_app
 
+/// @brief Generates arrival times of requests for the open-loop mode as offsets from the start of the measurement.
+/// Poisson arrivals have exponentially distributed gaps with the mean of 1/qps, constant arrivals are evenly spaced.
+/// A trace replays the timestamps from a file, it is time-scaled to the given rate if the rate is not zero.
+class ArrivalProcess {
+public:
+    ArrivalProcess(const std::string& distribution, double qps, const std::string& trace_file = "");
+
+    /// @brief Returns the offset of the next arrival, false if the trace is over
+    bool next(ns& arrival);
+
+private:
+    bool _poisson;
+    double _qps;
+    double _time = 0;
+    std::mt19937_64 _generator;
+    std::exponential_distribution<double> _gaps;
+    std::vector<double> _trace;
+    size_t _trace_pos = 0;
+};
+
+/// @brief Parses "<start>:<stop>:<step>" string into the ascending list of offered request rates
+std::vector<double> parse_qps_sweep(const std::string& sweep_string);
+
 bool can_measure_as_static(const std::vector<benchmark_app::InputsInfo>& app_input_info);
 bool is_virtual_device(const std::string& device_name);
 bool is_virtual_device_found(const std::vector<std::string>& device_names);
@@ -4989,6 +4989,15 @@ class VariableState:
     """
     def __repr__(self) -> str:
         ...
+    def fork_from(self, source: VariableState) -> None:
+        """
+                Makes this state a copy of the source state, typically a state of
+                another infer request of the same compiled model. Plugins may share
+                the memory of the source state instead of copying it.
+        
+                :param source: The state to copy.
+                :type source: openvino.VariableState
+        """
     def reset(self) -> None:
         """
                 Reset internal variable state for relevant infer request,
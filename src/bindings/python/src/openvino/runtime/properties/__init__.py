@@ -9,6 +9,7 @@ from openvino._pyopenvino.properties import WorkloadType
 # Properties
 from openvino._pyopenvino.properties import enable_profiling
 from openvino._pyopenvino.properties import cache_dir
+from openvino._pyopenvino.properties import cache_size_limit
 from openvino._pyopenvino.properties import cache_mode
 from openvino._pyopenvino.properties import auto_batch_timeout
 from openvino._pyopenvino.properties import num_streams
@@ -35,6 +35,18 @@ void regclass_VariableState(py::module m) {
         :rtype: str
     )");
 
+    variable_st.def("fork_from",
+                    &ov::VariableState::fork_from,
+                    py::arg("source"),
+                    R"(
+        Makes this state a copy of the source state, typically a state of
+        another infer request of the same compiled model. Plugins may share
+        the memory of the source state instead of copying it.
+
+        :param source: The state to copy.
+        :type source: openvino.VariableState
+    )");
+
     variable_st.def_property("state",
                              &ov::VariableState::get_state,
                              &ov::VariableState::set_state,
@@ -94,3 +94,29 @@ def test_query_state_write_buffer(device, base_class, input_shape, data_type, mo
             expected_res = np.full(input_shape, i, dtype=data_type)
 
         assert np.allclose(res[list(res)[0]], expected_res, atol=1e-6), f"Expected values: {expected_res} \n Actual values: {res} \n"
+
+
+@pytest.mark.skipif(
+    os.environ.get("TEST_DEVICE", "CPU") not in ["CPU", "GPU"],
+    reason=f"Can't run test on device {os.environ.get('TEST_DEVICE', 'CPU')}, "
+    "Memory layers fully supported only on CPU and GPU",
+)
+def test_fork_variable_state(device):
+    core = Core()
+    input_shape = [10, 10]
+    model = generate_model_with_memory(input_shape, np.float32)
+    compiled_model = core.compile_model(model=model, device_name=device)
+    source = compiled_model.create_infer_request()
+    target = compiled_model.create_infer_request()
+    ones = np.ones(input_shape, dtype=np.float32)
+
+    for _ in range(3):
+        source.infer({0: ones})
+    target.query_state()[0].fork_from(source.query_state()[0])
+    assert np.array_equal(target.query_state()[0].state.data, np.full(input_shape, 3, dtype=np.float32))
+
+    # states stay independent after the fork
+    res = target.infer({0: ones})
+    assert np.array_equal(res[list(res)[0]], np.full(input_shape, 4, dtype=np.float32))
+    res = source.infer({0: ones})
+    assert np.array_equal(res[list(res)[0]], np.full(input_shape, 4, dtype=np.float32))
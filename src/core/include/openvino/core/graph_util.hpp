@@ -309,7 +309,8 @@ void serialize(const std::shared_ptr<const ov::Model>& m,
 /// This method saves a model to IR applying all necessary transformations that usually applied
 /// in model conversion flow provided by OVC tool. Particularly, floating point weights are compressed to FP16.
 /// \param model Model which will be converted to IR representation.
-/// \param output_model Path to the output model file, must have extension .xml
+/// \param output_model Path to the output model file, must have extension .xml, or .xmlbin to bundle the IR XML and
+/// the weights into one file (see ov::pass::SingleFileSerialize)
 /// \param compress_to_fp16 Whether to compress floating point weights to FP16 (true by default)
 OPENVINO_API
 void save_model(const std::shared_ptr<const ov::Model>& model,
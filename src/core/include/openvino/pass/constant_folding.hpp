@@ -19,6 +19,16 @@ namespace pass {
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_MODEL_PASS_RTTI("ConstantFolding");
+
+    /// \param parallel  Fold independent nodes with constant inputs concurrently before the sequential pass. Only the
+    /// operations of the core opsets are folded concurrently, as their evaluation must be thread safe, the others are
+    /// left to the sequential pass.
+    /// \param max_parallel_memory  Limit of the size in bytes of the folded outputs of the nodes folded concurrently,
+    /// they are kept until they replace the original outputs.
+    explicit ConstantFolding(bool parallel = false, size_t max_parallel_memory = 512 * 1024 * 1024)
+        : m_parallel(parallel),
+          m_max_parallel_memory(max_parallel_memory) {}
+
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
 protected:
@@ -26,6 +36,15 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Folds the nodes which have only constant inputs of the original precision in batches, the nodes of a
+    /// batch are evaluated concurrently and replaced sequentially. Consumers of the folded nodes join the next batches.
+    bool parallel_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Replaces the outputs of the node with the folded ones.
+    bool replace_with_folded(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+
+private:
+    bool m_parallel = false;
+    size_t m_max_parallel_memory = 0;
 };
 
 /**
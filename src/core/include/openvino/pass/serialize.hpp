@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <functional>
 #include <string>
@@ -82,5 +83,59 @@ private:
     std::function<std::string(const std::string&)> m_cache_encrypt;
     const Serialize::Version m_version;
 };
+
+/**
+ * @brief SingleFileSerialize transformation bundles the IR XML and the IR bin of ov::Model into one file
+ *
+ * It is not a separate model format: the topology is the regular IR XML and is parsed as such, the bundle only joins
+ * it with the weights. The weights section starts at a page boundary, so the weights can be used directly from the
+ * memory mapped file. The file is read by IR frontend, ov::save_model writes it for the paths with
+ * SingleFileSerialize::extension.
+ * @attention
+ * - the output stream must be seekable, the header is written after the sections
+ * \ingroup ov_pass_cpp_api
+ */
+class OPENVINO_API SingleFileSerialize : public ov::pass::ModelPass {
+public:
+    OPENVINO_MODEL_PASS_RTTI("SingleFileSerialize");
+
+    /**
+     * Format:
+     * [   Header  ]
+     * [  Padding  ]
+     * [  Weights  ]  <- page aligned, the content of IR bin
+     * [  IR XML   ]
+     */
+    struct Header {
+        char magic[8];
+        uint64_t format_version;
+        uint64_t weights_offset;
+        uint64_t weights_size;
+        uint64_t model_offset;
+        uint64_t model_size;
+    };
+
+    static constexpr char magic[8] = {'O', 'V', 'X', 'M', 'L', 'B', 'I', 'N'};
+    static constexpr uint64_t format_version = 1;
+    static constexpr uint64_t weights_alignment = 4096;
+    static constexpr const char* extension = ".xmlbin";
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+
+    SingleFileSerialize(std::ostream& stream, Serialize::Version version = Serialize::Version::UNSPECIFIED);
+
+    SingleFileSerialize(const std::string& path, Serialize::Version version = Serialize::Version::UNSPECIFIED);
+
+    SingleFileSerialize(const std::filesystem::path& path, Serialize::Version version = Serialize::Version::UNSPECIFIED)
+        : SingleFileSerialize(path.string(), version) {}
+
+    /// @brief Returns true if data of the given size starts with the header of the bundle
+    static bool is_single_file(const char* data, size_t size);
+
+private:
+    std::ostream* m_stream;
+    const std::string m_path;
+    const Serialize::Version m_version;
+};
 }  // namespace pass
 }  // namespace ov
@@ -20,6 +20,7 @@
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/pass/visualize_tree.hpp"
+#include "openvino/util/common_util.hpp"
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/file_util.hpp"
 #include "transformations/common_optimizations/compress_float_constants.hpp"
@@ -322,7 +323,11 @@ void save_model(const std::shared_ptr<const ov::Model>& m, const std::string& ou
 
     ov::pass::Manager manager("SaveModel");
     manager.register_pass<ov::pass::FusedNamesCleanup>();
-    manager.register_pass<ov::pass::Serialize>(output_model, "");
+    if (ov::util::ends_with(output_model, ov::pass::SingleFileSerialize::extension)) {
+        manager.register_pass<ov::pass::SingleFileSerialize>(output_model);
+    } else {
+        manager.register_pass<ov::pass::Serialize>(output_model, "");
+    }
     manager.run_passes(std::move(cloned));
 }
 
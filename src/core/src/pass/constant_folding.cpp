@@ -4,8 +4,12 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <mutex>
+#include <set>
+
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/op/constant.hpp"
@@ -14,6 +18,7 @@
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/opsets/opset.hpp"
 #include "transformations/rt_info/decompression.hpp"
 #include "transformations/rt_info/dequantization_node.hpp"
 
@@ -101,11 +106,67 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+/**
+ * \brief Check if node is an operation of a core opset.
+ *
+ * The evaluation of the core operations doesn't change the shared state, so they may be folded concurrently. The
+ * operations of the extensions and of the plugins give no such guarantee, and they are folded sequentially.
+ */
+static bool is_core_operation(const ov::Node& node) {
+    static const std::set<ov::NodeTypeInfo> core_operations = [] {
+        std::set<ov::NodeTypeInfo> operations;
+        for (const auto& opset : ov::get_available_opsets()) {
+            const auto& types = opset.second().get_type_info_set();
+            operations.insert(types.begin(), types.end());
+        }
+        return operations;
+    }();
+    return core_operations.count(node.get_type_info()) != 0;
+}
+
+/**
+ * \brief Check if node can be folded independently of the other nodes.
+ *
+ * The node is a core operation and all its inputs are Constants of the original precision, so neither other nodes have
+ * to be folded first nor the precision of the inputs has to be restored. The outputs are static to estimate their size.
+ */
+static bool can_fold_in_parallel(const std::shared_ptr<ov::Node>& node) {
+    if (node->get_output_size() == 0 || !is_core_operation(*node) || !is_output_foldable(node->output(0)) ||
+        ov::is_type<ov::op::util::MultiSubGraphOp>(node) || node_has_requires_precision_conversion_attribute(node) ||
+        !node->can_constant_fold(node->input_values())) {
+        return false;
+    }
+    for (const auto& input : node->inputs()) {
+        if (ov::util::has_original_input_precision(input) &&
+            ov::util::get_original_input_precision(input) != input.get_element_type()) {
+            return false;
+        }
+    }
+    for (const auto& output : node->outputs()) {
+        if (!output.get_partial_shape().is_static() || !output.get_element_type().is_static()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static size_t folded_outputs_size(const ov::Node& node) {
+    size_t size = 0;
+    for (const auto& output : node.outputs()) {
+        size += (ov::shape_size(output.get_shape()) * output.get_element_type().bitwidth() + 7) / 8;
+    }
+    return size;
+}
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
+    if (m_parallel) {
+        rewritten = parallel_folding(model) || rewritten;
+    }
+
     for (const auto& original_node : model->get_ordered_ops()) {
         auto node = original_node;
         if (!original_node->can_constant_fold(original_node->input_values())) {
@@ -143,24 +204,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                             "constant_fold_default returned incorrect number of replacements for ",
                             node);
 
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = original_node->output(i);
-                const auto& replacement = replacements.at(i);
-                auto replacement_ptr = replacement.get_node_shared_ptr();
-                if (replacement_ptr && (node_output != replacement)) {
-                    replacement_ptr->set_friendly_name(friendly_name_from(*original_node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(original_node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(original_node, replacement_ptr);
-                    ov::copy_weightless_cache_attr(original_node, replacement_ptr);
-
-                    rewritten = true;
-                }
-            }
+            rewritten = replace_with_folded(original_node, replacements) || rewritten;
         } else {
             // if CF was unsuccessful remove original precision attribute from inputs
             bool restored = restore_original_input_precision(original_node);
@@ -174,6 +218,116 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::replace_with_folded(const std::shared_ptr<Node>& node,
+                                                   const OutputVector& replacements) {
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        const auto& replacement = replacements.at(i);
+        auto replacement_ptr = replacement.get_node_shared_ptr();
+        if (replacement_ptr && (node_output != replacement)) {
+            replacement_ptr->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Copy runtime info from source nodes
+            // when it was not propogated during pre-calculation
+            copy_runtime_info_from_input_values(node);
+            // Propagate runtime info attributes to replacement
+            copy_runtime_info(node, replacement_ptr);
+            ov::copy_weightless_cache_attr(node, replacement_ptr);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::parallel_folding(const std::shared_ptr<ov::Model>& model) {
+    bool rewritten = false;
+    std::unordered_set<Node*> queued;
+    std::deque<std::shared_ptr<Node>> ready;
+    // shape inference of a node may evaluate bounds of its inputs, which are shared with other nodes, so the nodes
+    // are validated sequentially before they are queued
+    auto enqueue = [&](const std::shared_ptr<Node>& node) {
+        if (queued.count(node.get()) || !node->can_constant_fold(node->input_values())) {
+            return;
+        }
+        node->validate_and_infer_types();
+        if (can_fold_in_parallel(node)) {
+            queued.insert(node.get());
+            ready.push_back(node);
+        }
+    };
+    for (const auto& node : model->get_ordered_ops()) {
+        enqueue(node);
+    }
+
+    while (!ready.empty()) {
+        // the folded outputs of the batch coexist with the original ones until they are replaced
+        std::vector<std::shared_ptr<Node>> batch;
+        size_t batch_memory = 0;
+        while (!ready.empty()) {
+            const auto memory = folded_outputs_size(*ready.front());
+            if (!batch.empty() && batch_memory + memory > m_max_parallel_memory) {
+                break;
+            }
+            batch_memory += memory;
+            batch.push_back(std::move(ready.front()));
+            ready.pop_front();
+        }
+
+        std::vector<OutputVector> folded(batch.size());
+        std::vector<char> is_folded(batch.size(), 0);
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        ov::parallel_for(batch.size(), [&](size_t i) {
+            try {
+                folded[i].resize(batch[i]->get_output_size());
+                is_folded[i] = batch[i]->constant_fold(folded[i], batch[i]->input_values());
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        });
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        for (size_t i = 0; i < batch.size(); ++i) {
+            // the nodes which are not folded are left for the sequential pass
+            if (!is_folded[i]) {
+                continue;
+            }
+            const auto& node = batch[i];
+            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                            node);
+            OPENVINO_ASSERT(folded[i].size() == node->get_output_size(),
+                            "constant_fold_default returned incorrect number of replacements for ",
+                            node);
+
+            for (auto input : node->inputs()) {
+                ov::util::remove_original_input_precision_attribute(input);
+            }
+            NodeVector consumers;
+            for (const auto& output : node->outputs()) {
+                for (const auto& target : output.get_target_inputs()) {
+                    consumers.push_back(target.get_node()->shared_from_this());
+                }
+            }
+            rewritten = replace_with_folded(node, folded[i]) || rewritten;
+            folded[i].clear();
+
+            for (const auto& consumer : consumers) {
+                enqueue(consumer);
+            }
+        }
+    }
+    return rewritten;
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node) {
     if (is_type<op::util::ShapeOfBase>(node)) {
         // Don't propogate names of ShapeOf source node since it is not fused itself
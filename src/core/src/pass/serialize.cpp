@@ -7,6 +7,7 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <openvino/cc/pass/itt.hpp>
 #include <unordered_map>
@@ -1309,12 +1310,7 @@ void serializeFunc(std::ostream& xml_file,
     bin_file.flush();
 };
 
-}  // namespace
-
-namespace ov {
-bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
-    RUN_ON_FUNCTION_SCOPE(Serialize);
-
+void prepare_for_serialization(const std::shared_ptr<ov::Model>& model) {
     model->validate_nodes_and_infer_types();
 
     // TODO xxx-105807: if rt_info is set in python api as a string ['precise_0'] = '',
@@ -1323,6 +1319,15 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
     for (auto& node : model->get_ops())
         if (fp16_compression_is_disabled(node))
             disable_fp16_compression(node);
+}
+
+}  // namespace
+
+namespace ov {
+bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_FUNCTION_SCOPE(Serialize);
+
+    prepare_for_serialization(model);
 
     if (m_xmlFile && m_binFile) {
         serializeFunc(*m_xmlFile, *m_binFile, model, m_version);
@@ -1469,6 +1474,87 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ov::Model>& model
     return false;
 }
 
+pass::SingleFileSerialize::SingleFileSerialize(std::ostream& stream, Serialize::Version version)
+    : m_stream{&stream},
+      m_path{},
+      m_version{version} {}
+
+pass::SingleFileSerialize::SingleFileSerialize(const std::string& path, Serialize::Version version)
+    : m_stream{nullptr},
+      m_path{path},
+      m_version{version} {}
+
+bool pass::SingleFileSerialize::is_single_file(const char* data, size_t size) {
+    return data && size >= sizeof(Header) && std::memcmp(data, magic, sizeof(magic)) == 0;
+}
+
+bool pass::SingleFileSerialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(SingleFileSerialize);
+
+    prepare_for_serialization(model);
+
+    auto write = [&](std::ostream& stream) {
+        // the offsets are relative to the header, the weights are page aligned when the header starts the file
+        const std::streamoff header_offset = stream.tellp();
+        // the header is completed when the sizes are known, so the stream has to go back to it
+        OPENVINO_ASSERT(header_offset >= 0, "SingleFileSerialize requires a seekable output stream");
+        Header hdr = {};
+        stream.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+        hdr.weights_offset = (sizeof(hdr) + weights_alignment - 1) / weights_alignment * weights_alignment;
+        const std::vector<char> padding(hdr.weights_offset - sizeof(hdr), 0);
+        stream.write(padding.data(), padding.size());
+
+        // the weights are written to the stream directly, the IR is small in comparison and is buffered to be
+        // written after them
+        std::stringstream xml;
+        serializeFunc(xml, stream, model, m_version);
+
+        const std::streamoff model_offset = stream.tellp();
+        hdr.weights_size = static_cast<uint64_t>(model_offset - header_offset) - hdr.weights_offset;
+        hdr.model_offset = static_cast<uint64_t>(model_offset - header_offset);
+        stream << xml.rdbuf();
+        const std::streamoff file_end = stream.tellp();
+        hdr.model_size = static_cast<uint64_t>(file_end - model_offset);
+
+        std::memcpy(hdr.magic, magic, sizeof(magic));
+        hdr.format_version = format_version;
+        stream.seekp(header_offset);
+        OPENVINO_ASSERT(stream, "Can't seek back to the header of the IR bundle");
+        stream.write(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+        stream.seekp(file_end);
+        stream.flush();
+        OPENVINO_ASSERT(stream, "Can't write the IR bundle");
+    };
+
+    if (m_stream) {
+        write(*m_stream);
+    } else {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+        const auto& path_ref = ov::util::string_to_wstring(m_path);
+        std::string message = "Can't open model file.";
+#else
+        const auto& path_ref = m_path;
+        std::string message = "Can't open model file: \"" + path_ref + "\"";
+#endif
+        auto dir = ov::util::get_directory(path_ref);
+        if (dir != path_ref)
+            ov::util::create_directory_recursive(dir);
+
+        std::ofstream file(path_ref, std::ios::out | std::ios::binary);
+        OPENVINO_ASSERT(file, message);
+        try {
+            write(file);
+        } catch (const ov::AssertFailure&) {
+            file.close();
+            std::ignore = std::remove(m_path.c_str());
+            throw;
+        }
+    }
+
+    // Return false because we didn't change ov Model
+    return false;
+}
+
 /// -------- Hash calculation pass -------------
 
 namespace {
@@ -6,6 +6,8 @@
 
 #include <gmock/gmock.h>
 
+#include <thread>
+
 #include "common_test_utils/all_close_f.hpp"
 #include "common_test_utils/ov_test_utils.hpp"
 #include "common_test_utils/test_tools.hpp"
@@ -3949,6 +3951,96 @@ TEST(constant_folding, sq_diff) {
     ASSERT_NE(res_node, nullptr);
 }
 
+TEST(constant_folding, parallel_decompression_subgraphs) {
+    constexpr size_t branches = 16;
+    // the memory limits fold every node in its own batch, all the nodes of a level in one batch and all at once
+    for (size_t max_parallel_memory : {size_t{1}, size_t{8 * 4 * 4}, size_t{1024 * 1024}}) {
+        auto param = make_shared<op::v0::Parameter>(element::f32, Shape{2, 8});
+        OutputVector outputs;
+        for (size_t i = 0; i < branches; ++i) {
+            const auto value = static_cast<uint8_t>(i + 2);
+            auto weights = op::v0::Constant::create(element::u8, Shape{8, 4}, std::vector<uint8_t>(32, value));
+            auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+            auto zero_point = op::v0::Constant::create(element::f32, Shape{1, 4}, {1});
+            auto subtract = make_shared<op::v1::Subtract>(convert, zero_point);
+            auto scale = op::v0::Constant::create(element::f32, Shape{1, 4}, {0.5f});
+            auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+            multiply->set_friendly_name("weights_" + std::to_string(i));
+            outputs.push_back(make_shared<op::v0::MatMul>(param, multiply));
+        }
+        auto model = make_shared<Model>(outputs, ParameterVector{param});
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>(true, max_parallel_memory);
+        pass_manager.run_passes(model);
+
+        EXPECT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+        EXPECT_EQ(count_ops_of_type<op::v1::Subtract>(model), 0);
+        EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+        for (size_t i = 0; i < branches; ++i) {
+            auto matmul = model->get_results().at(i)->get_input_node_shared_ptr(0);
+            auto weights = ov::as_type_ptr<op::v0::Constant>(matmul->get_input_node_shared_ptr(1));
+            ASSERT_TRUE(weights);
+            EXPECT_EQ(weights->get_friendly_name(), "weights_" + std::to_string(i));
+            EXPECT_EQ(weights->cast_vector<float>(), std::vector<float>(32, 0.5f * (i + 1)));
+        }
+    }
+}
+
+namespace {
+// an operation of an extension, which evaluation isn't known to be thread safe
+class ThreadRecordingAdd : public ov::op::v1::Add {
+public:
+    OPENVINO_OP("ThreadRecordingAdd", "extension", ov::op::v1::Add);
+
+    ThreadRecordingAdd(const Output<Node>& arg0,
+                       const Output<Node>& arg1,
+                       std::shared_ptr<std::vector<std::thread::id>> threads)
+        : ov::op::v1::Add(arg0, arg1),
+          m_threads(std::move(threads)) {}
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        return std::make_shared<ThreadRecordingAdd>(new_args.at(0), new_args.at(1), m_threads);
+    }
+
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override {
+        // not synchronized on purpose, the evaluations must not be concurrent
+        m_threads->push_back(std::this_thread::get_id());
+        return ov::op::v1::Add::evaluate(outputs, inputs);
+    }
+
+private:
+    std::shared_ptr<std::vector<std::thread::id>> m_threads;
+};
+}  // namespace
+
+TEST(constant_folding, parallel_folds_extension_operations_sequentially) {
+    constexpr size_t branches = 64;
+    auto threads = std::make_shared<std::vector<std::thread::id>>();
+    OutputVector outputs;
+    for (size_t i = 0; i < branches; ++i) {
+        auto a = op::v0::Constant::create(element::f32, Shape{1024}, {static_cast<float>(i)});
+        auto b = op::v0::Constant::create(element::f32, Shape{1024}, {1.0f});
+        outputs.push_back(make_shared<ThreadRecordingAdd>(a, b, threads));
+    }
+    auto model = make_shared<Model>(outputs, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(true);
+    pass_manager.run_passes(model);
+
+    EXPECT_EQ(count_ops_of_type<ThreadRecordingAdd>(model), 0);
+    ASSERT_EQ(threads->size(), branches);
+    for (const auto& thread : *threads) {
+        EXPECT_EQ(thread, std::this_thread::get_id());
+    }
+    for (size_t i = 0; i < branches; ++i) {
+        auto folded = ov::as_type_ptr<op::v0::Constant>(model->get_results().at(i)->get_input_node_shared_ptr(0));
+        ASSERT_TRUE(folded);
+        EXPECT_EQ(folded->cast_vector<float>(), std::vector<float>(1024, i + 1.0f));
+    }
+}
+
 class UnsupportedTypesTest : public testing::TestWithParam<element::Type> {};
 
 TEST_P(UnsupportedTypesTest, add_multiply) {
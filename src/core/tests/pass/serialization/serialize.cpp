@@ -10,6 +10,7 @@
 
 #include "common_test_utils/file_utils.hpp"
 #include "common_test_utils/graph_comparator.hpp"
+#include "common_test_utils/test_assertions.hpp"
 #include "common_test_utils/test_common.hpp"
 #include "openvino/core/graph_util.hpp"
 #include "openvino/util/file_util.hpp"
@@ -90,6 +91,54 @@ TEST_P(SerializationTest, SaveModelByPath) {
     });
 }
 
+TEST_P(SerializationTest, SaveModelSingleFile) {
+    m_out_xml_path = ov::test::utils::generateTestFilePrefix() + ov::pass::SingleFileSerialize::extension;
+    m_out_bin_path = "";
+    CompareSerialized([this](const std::shared_ptr<ov::Model>& m) {
+        ov::save_model(m, m_out_xml_path, false);
+    });
+
+    std::ifstream file(m_out_xml_path, std::ios::binary);
+    ov::pass::SingleFileSerialize::Header header = {};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    const auto header_size = static_cast<size_t>(file.gcount());
+    ASSERT_TRUE(ov::pass::SingleFileSerialize::is_single_file(reinterpret_cast<const char*>(&header), header_size));
+    EXPECT_EQ(0, header.weights_offset % ov::pass::SingleFileSerialize::weights_alignment);
+}
+
+TEST_P(SerializationTest, SingleFileSerializeToStream) {
+    auto expected = ov::test::readModel(m_model_path, m_binary_path);
+    std::stringstream stream;
+    ov::pass::SingleFileSerialize(stream).run_on_model(expected);
+    auto result = ov::test::readModel(stream.str());
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(result, expected);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
+TEST_P(SerializationTest, SingleFileSerializeToNonSeekableStream) {
+    // accepts the data, but can't report or change the position
+    class NonSeekableBuffer : public std::streambuf {
+    protected:
+        int_type overflow(int_type c) override {
+            return traits_type::not_eof(c);
+        }
+        std::streamsize xsputn(const char*, std::streamsize count) override {
+            return count;
+        }
+    };
+
+    auto expected = ov::test::readModel(m_model_path, m_binary_path);
+    NonSeekableBuffer buffer;
+    std::ostream stream(&buffer);
+    OV_EXPECT_THROW(ov::pass::SingleFileSerialize(stream).run_on_model(expected),
+                    ov::AssertFailure,
+                    testing::HasSubstr("seekable"));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     IRSerialization,
     SerializationTest,
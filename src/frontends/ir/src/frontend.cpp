@@ -5,12 +5,14 @@
 #include "openvino/frontend/ir/frontend.hpp"
 
 #include <array>
+#include <cstring>
 #include <pugixml.hpp>
 #include <vector>
 
 #include "input_model.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/so_extension.hpp"
+#include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
@@ -91,6 +93,53 @@ size_t get_ir_version(std::istream& model) {
     return ir_version;
 }
 
+bool is_single_file(std::istream& model) {
+    char header[sizeof(ov::pass::SingleFileSerialize::Header)];
+
+    model.seekg(0, model.beg);
+    model.read(header, sizeof(header));
+    const auto header_size = static_cast<size_t>(model.gcount());
+    model.clear();
+    model.seekg(0, model.beg);
+
+    return ov::pass::SingleFileSerialize::is_single_file(header, header_size);
+}
+
+std::shared_ptr<ov::AlignedBuffer> read_stream(std::istream& stream) {
+    stream.seekg(0, std::ios::end);
+    size_t size = stream.tellg();
+    stream.seekg(0, std::ios::beg);
+
+    auto buffer = std::make_shared<ov::AlignedBuffer>(size);
+    stream.read(buffer->get_ptr<char>(), buffer->size());
+    return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(buffer->get_ptr<char>(),
+                                                                                  buffer->size(),
+                                                                                  buffer);
+}
+
+/**
+ * @brief Splits the IR bundle into the IR XML and the weights sections, both of them share the file buffer
+ */
+std::pair<std::shared_ptr<ov::AlignedBuffer>, std::shared_ptr<ov::AlignedBuffer>> split_ir_bundle(
+    const std::shared_ptr<ov::AlignedBuffer>& file) {
+    ov::pass::SingleFileSerialize::Header header;
+    std::memcpy(&header, file->get_ptr(), sizeof(header));
+    OPENVINO_ASSERT(header.format_version == ov::pass::SingleFileSerialize::format_version,
+                    "Unsupported version of IR bundle: ",
+                    header.format_version);
+    const uint64_t file_size = file->size();
+    OPENVINO_ASSERT(header.weights_offset <= file_size && header.weights_size <= file_size - header.weights_offset &&
+                        header.model_offset <= file_size && header.model_size <= file_size - header.model_offset,
+                    "IR bundle is corrupted: the sections exceed the file size");
+
+    auto section = [&](uint64_t offset, uint64_t size) -> std::shared_ptr<ov::AlignedBuffer> {
+        return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(file->get_ptr<char>() + offset,
+                                                                                      size,
+                                                                                      file);
+    };
+    return {section(header.model_offset, header.model_size), section(header.weights_offset, header.weights_size)};
+}
+
 }  // namespace
 
 bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
@@ -129,11 +178,17 @@ bool FrontEnd::supported_impl(const std::vector<ov::Any>& variants) const {
 
     size_t version;
     if (provided_model_stream) {
+        if (is_single_file(*provided_model_stream))
+            return true;
         version = get_ir_version(*provided_model_stream);
     } else if (local_model_stream.is_open()) {
+        if (is_single_file(local_model_stream))
+            return true;
         version = get_ir_version(local_model_stream);
         local_model_stream.close();
     } else if (model_buffer) {
+        if (ov::pass::SingleFileSerialize::is_single_file(model_buffer->get_ptr<char>(), model_buffer->size()))
+            return true;
         version = get_ir_version(model_buffer->get_ptr<char>(), model_buffer->size());
     } else {
         return false;
@@ -239,6 +294,31 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     }
     bool enable_mmap = variants[variants.size() - 1].is<bool>() ? variants[variants.size() - 1].as<bool>() : false;
 
+    // IR bundle keeps the weights in the same file, the weights path is left empty as the weights offsets
+    // are not file offsets
+    std::shared_ptr<ov::AlignedBuffer> single_file;
+    if (local_model_stream.is_open() && is_single_file(local_model_stream)) {
+        if (enable_mmap) {
+            local_model_stream.close();
+            auto mapped_memory = ov::load_mmap_object(model_path);
+            single_file = std::make_shared<ov::SharedBuffer<std::shared_ptr<MappedMemory>>>(mapped_memory->data(),
+                                                                                            mapped_memory->size(),
+                                                                                            mapped_memory);
+        } else {
+            single_file = read_stream(local_model_stream);
+            local_model_stream.close();
+        }
+    } else if (provided_model_stream && is_single_file(*provided_model_stream)) {
+        single_file = read_stream(*provided_model_stream);
+    } else if (model_buf &&
+               ov::pass::SingleFileSerialize::is_single_file(model_buf->get_ptr<char>(), model_buf->size())) {
+        single_file = model_buf;
+    }
+    if (single_file) {
+        std::tie(model_buf, weights) = split_ir_bundle(single_file);
+        return std::make_shared<InputModel>(model_buf, weights, create_extensions_map(), std::string{});
+    }
+
     // Find weights if only path to xml was provided
     if (weights_path.empty()) {
         auto pos = model_path.rfind('.');
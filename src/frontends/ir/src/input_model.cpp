@@ -7,6 +7,7 @@
 #include <pugixml.hpp>
 
 #include "ir_deserializer.hpp"
+#include "itt.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/concat.hpp"
@@ -215,6 +216,7 @@ public:
         : m_weights(weights),
           m_extensions(extensions),
           m_weights_path(std::move(weights_path)) {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::V10Reader_RT, "InputModelIRImpl::ParseXml");
         pugi::xml_parse_result res = m_xml_doc.load(model);
         OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
         init_opset();
@@ -227,6 +229,7 @@ public:
         : m_weights(weights),
           m_extensions(extensions),
           m_weights_path(std::move(weights_path)) {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::V10Reader_RT, "InputModelIRImpl::ParseXml");
         auto res = m_xml_doc.load_buffer(model->get_ptr(), model->size(), pugi::parse_default, pugi::encoding_utf8);
         OPENVINO_ASSERT(res.status == pugi::status_ok, res.description(), " at offset ", res.offset);
         init_opset();
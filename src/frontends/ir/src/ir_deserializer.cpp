@@ -4,13 +4,16 @@
 
 #include "ir_deserializer.hpp"
 
+#include <mutex>
 #include <pugixml.hpp>
 #include <regex>
 #include <string_view>
 
+#include "itt.hpp"
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -70,6 +73,72 @@ std::unordered_set<std::string> deserialize_tensor_names(const std::string_view&
 
     return output_names;
 }
+
+/**
+ * @brief Calls func for every index in [0, count) in parallel.
+ *
+ * The first exception thrown by func is rethrown in the calling thread after all calls are done.
+ */
+template <typename F>
+void parallel_for_rethrow(size_t count, const F& func) {
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    ov::parallel_for(count, [&](size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief Reads the data of the Const layer from the weights.
+ *
+ * @param node The Const layer.
+ * @param weights The weights the layer refers to.
+ * @param as_strings Unpacks the data as a string tensor whatever the element type is.
+ * @return The buffer sharing the weights or holding the unpacked strings, nullptr if the layer doesn't describe
+ * the data.
+ */
+std::shared_ptr<ov::AlignedBuffer> read_constant_data(const pugi::xml_node& node,
+                                                      const std::shared_ptr<ov::AlignedBuffer>& weights,
+                                                      bool as_strings) {
+    pugi::xml_node dn = node.child("data");
+    if (dn.empty())
+        OPENVINO_THROW("No attrtibutes defined for Const op!");
+
+    std::vector<int64_t> shape;
+    std::string el_type_str;
+
+    size_t offset = static_cast<size_t>(pugixml::get_uint64_attr(dn, "offset"));
+    size_t size = static_cast<size_t>(pugixml::get_uint64_attr(dn, "size"));
+    if (!ov::getStrAttribute(dn, "element_type", el_type_str))
+        return nullptr;
+    if (!ov::getParameters<int64_t>(dn, "shape", shape))
+        return nullptr;
+
+    ov::element::Type el_type = ov::element::Type(el_type_str);
+
+    if (!weights)
+        OPENVINO_THROW("Empty weights data in bin file or bin file cannot be found!");
+    if (weights->size() < offset + size)
+        OPENVINO_THROW("Incorrect weights in bin file!");
+    char* data = weights->get_ptr<char>() + offset;
+
+    if (as_strings || el_type == ov::element::string) {
+        return ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>::unpack_string_tensor(data, size);
+    }
+    if (size < ((ov::shape_size(shape) * el_type.bitwidth() + 7) >> 3))
+        OPENVINO_THROW("Attribute and shape size are inconsistent for Const op!");
+    return std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(data, size, weights);
+}
 }  // namespace
 
 ov::XmlDeserializer::IoMap ov::XmlDeserializer::updated_io_map(const pugi::xml_node& node,
@@ -379,59 +448,17 @@ void ov::XmlDeserializer::on_adapter(const std::string& name, ov::ValueAccessor<
             value.copy(data, value.size());
             a->set(buffer);
         } else if (name == "value" && type == "Const") {
-            std::vector<int64_t> shape;
-            std::string el_type_str;
-
-            size_t offset = static_cast<size_t>(pugixml::get_uint64_attr(dn, "offset"));
-            size_t size = static_cast<size_t>(pugixml::get_uint64_attr(dn, "size"));
-            if (!getStrAttribute(dn, "element_type", el_type_str))
-                return;
-            if (!getParameters<int64_t>(dn, "shape", shape))
-                return;
-
-            ov::element::Type el_type = ov::element::Type(el_type_str);
-
-            if (!m_weights)
-                OPENVINO_THROW("Empty weights data in bin file or bin file cannot be found!");
-            if (m_weights->size() < offset + size)
-                OPENVINO_THROW("Incorrect weights in bin file!");
-            char* data = m_weights->get_ptr<char>() + offset;
-
-            if (el_type == element::string) {
-                auto buffer =
-                    ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>::unpack_string_tensor(data, size);
-                a->set(buffer);
-            } else {
-                if (size < ((ov::shape_size(shape) * el_type.bitwidth() + 7) >> 3))
-                    OPENVINO_THROW("Attribute and shape size are inconsistent for ", type, " op!");
-
-                auto buffer =
-                    std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(data, size, m_weights);
+            auto buffer = m_constant_data ? m_constant_data : read_constant_data(m_node, m_weights, false);
+            if (buffer)
                 a->set(buffer);
-            }
         }
     } else if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>>(&adapter)) {
-        pugi::xml_node dn = m_node.child("data");
         const auto& type = pugixml::get_str_attr(m_node, "type");
         if (name == "value" && type == "Const") {
-            std::vector<int64_t> shape;
-            std::string el_type_str;
-
-            size_t offset = static_cast<size_t>(pugixml::get_uint64_attr(dn, "offset"));
-            size_t size = static_cast<size_t>(pugixml::get_uint64_attr(dn, "size"));
-            if (!getStrAttribute(dn, "element_type", el_type_str))
-                return;
-            if (!getParameters<int64_t>(dn, "shape", shape))
-                return;
-
-            if (!m_weights)
-                OPENVINO_THROW("Empty weights data in bin file or bin file cannot be found!");
-            if (m_weights->size() < offset + size)
-                OPENVINO_THROW("Incorrect weights in bin file!");
-            char* data = m_weights->get_ptr<char>() + offset;
-            auto buffer =
-                ov::AttributeAdapter<std::shared_ptr<ov::StringAlignedBuffer>>::unpack_string_tensor(data, size);
-            a->set(buffer);
+            auto data = m_constant_data ? m_constant_data : read_constant_data(m_node, m_weights, true);
+            auto buffer = std::dynamic_pointer_cast<ov::StringAlignedBuffer>(data);
+            if (buffer)
+                a->set(buffer);
         }
     } else if (auto a = ov::as_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
         const auto& type = pugixml::get_str_attr(m_node, "type");
@@ -480,7 +507,7 @@ void ov::XmlDeserializer::on_adapter(const std::string& name, ov::ValueAccessor<
 
 std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_node& root,
                                                                const std::shared_ptr<ov::AlignedBuffer>& weights) {
-    // OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Index");
 
     struct FunctionNodes {
         ov::ParameterVector parameters;
@@ -504,10 +531,19 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
-    // Read all layers and store their parameters in params map
+    // Read all layers and store their parameters in params map, the layers are independent, so the parameters are
+    // parsed in parallel and collected in the order of the layers in XML
+    std::vector<pugi::xml_node> layers;
     FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parse_generic_params(node);
-        params[node_param.layerId] = {node, node_param};
+        layers.push_back(node);
+    }
+    std::vector<GenericLayerParams> layers_params(layers.size());
+    parallel_for_rethrow(layers.size(), [&](size_t i) {
+        layers_params[i] = parse_generic_params(layers[i]);
+    });
+    for (size_t i = 0; i < layers.size(); i++) {
+        const auto& node_param = layers_params[i];
+        params[node_param.layerId] = {layers[i], node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -541,10 +577,32 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "Constants");
+    // Constants have no inputs and make the majority of the layers of big models, so their data is read from the
+    // weights in parallel ahead of the rest of the graph: the bounds are checked and the string tensors are unpacked.
+    // The nodes themselves are created in the sequential pass, so their ids and order don't depend on the threads.
+    // Constants created by an extension are left as they are, the extension reads the attributes itself.
+    std::vector<size_t> constant_ids;
+    for (const auto& layer_id : order) {
+        const auto& p = params[layer_id];
+        if (p.params.type == "Const" && edges[layer_id].empty() && p.xml.child("data").attribute("value").empty() &&
+            !m_extensions.count(ov::DiscreteTypeInfo("Constant", p.params.version.c_str()))) {
+            constant_ids.push_back(layer_id);
+        }
+    }
+    std::vector<std::shared_ptr<ov::AlignedBuffer>> constants_data(constant_ids.size());
+    parallel_for_rethrow(constant_ids.size(), [&](size_t i) {
+        constants_data[i] = read_constant_data(params.at(constant_ids[i]).xml, weights, false);
+    });
+    std::unordered_map<size_t, std::shared_ptr<ov::AlignedBuffer>> id_to_constant_data;
+    for (size_t i = 0; i < constant_ids.size(); i++) {
+        id_to_constant_data[constant_ids[i]] = std::move(constants_data[i]);
+    }
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "Build");
     FunctionNodes func_nodes;
     std::map<size_t, std::shared_ptr<ov::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
-
     //  Following topological order create OpenVINO operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
@@ -569,7 +627,12 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
             inputs[realInputPortId] = input_node->output(p_output.get_real_output_port_id(e.fromPortId));
         }
 
-        auto node = create_node(inputs, p.xml, weights, p.params);
+        const auto constant_data = id_to_constant_data.find(layer_id);
+        auto node = create_node(inputs,
+                                p.xml,
+                                weights,
+                                p.params,
+                                constant_data != id_to_constant_data.end() ? constant_data->second : nullptr);
         id_to_node[layer_id] = node;
 
         if (const auto& parameter_node = ov::as_type_ptr<ov::op::v0::Parameter>(node)) {
@@ -604,6 +667,7 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
         func_nodes.all.emplace_back(node);
     }
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "Model");
     auto function = std::make_shared<ov::Model>(func_nodes.results,
                                                 func_nodes.sinks,
                                                 func_nodes.parameters,
@@ -614,6 +678,7 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(const pugi::xml_n
         }
     }
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "MetaData");
     // Read meta data from legacy representation
     if (root.child("rt_info").empty()) {
         // Legacy representation
@@ -849,7 +914,8 @@ static const std::string& translate_type_name(const std::string& name) {
 std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov::Output<ov::Node>>& inputs,
                                                            const pugi::xml_node& node,
                                                            const std::shared_ptr<ov::AlignedBuffer>& weights,
-                                                           const GenericLayerParams& params) {
+                                                           const GenericLayerParams& params,
+                                                           const std::shared_ptr<ov::AlignedBuffer>& constant_data) {
     // Check that inputs are correctly defined
     for (size_t i = 0; i < inputs.size(); i++) {
         if (!inputs[i].get_node())
@@ -870,7 +936,7 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
     auto extensionIt = m_extensions.find(type);
 
     if (extensionIt != m_extensions.end()) {
-        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version, constant_data);
         ovNode = (*extensionIt->second).create(inputs, visitor).at(0).get_node_shared_ptr();
     }
 
@@ -922,7 +988,7 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
             constant->alloc_buffer_on_visit_attributes(false);
         }
         ovNode->set_arguments(inputs);
-        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version, constant_data);
 
         if (ovNode->visit_attributes(visitor)) {
             ovNode->constructor_validate_and_infer_types();
@@ -933,7 +999,7 @@ std::shared_ptr<ov::Node> ov::XmlDeserializer::create_node(const std::vector<ov:
     }
     if (!ovNode && m_extensions.count(ov::op::util::FrameworkNode::get_type_info_static())) {
         ovNode = std::make_shared<ov::op::util::FrameworkNode>(inputs);
-        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+        XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version, constant_data);
         ovNode->visit_attributes(visitor);
 
         size_t index{0};
@@ -64,12 +64,14 @@ public:
                              const std::unordered_map<std::string, ov::OpSet>& opsets,
                              const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                              std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
-                             size_t version)
+                             size_t version,
+                             const std::shared_ptr<ov::AlignedBuffer>& constant_data = nullptr)
         : m_node(node),
           m_weights(weights),
           m_opsets(opsets),
           m_extensions(extensions),
           m_variables(variables),
+          m_constant_data(constant_data),
           m_version(version) {}
 
     void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& value) override {
@@ -179,7 +181,8 @@ private:
     std::shared_ptr<ov::Node> create_node(const ov::OutputVector& inputs,
                                           const pugi::xml_node& node,
                                           const std::shared_ptr<ov::AlignedBuffer>& weights,
-                                          const GenericLayerParams& params);
+                                          const GenericLayerParams& params,
+                                          const std::shared_ptr<ov::AlignedBuffer>& constant_data = nullptr);
 
     void read_meta_data(const std::shared_ptr<ov::Model>& model, const pugi::xml_node& meta_section);
 
@@ -193,6 +196,8 @@ private:
     const std::unordered_map<std::string, ov::OpSet>& m_opsets;
     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& m_extensions;
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& m_variables;
+    // the data of the Const layer read ahead of the node creation, the layer is read on the visit if it's not set
+    const std::shared_ptr<ov::AlignedBuffer> m_constant_data;
 
     ///
     /// store information about parameters/results order during a model creation
@@ -0,0 +1,20 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief Defines IR frontend domains for tracing
+ * @file itt.hpp
+ */
+
+#pragma once
+
+#include "openvino/itt.hpp"
+
+namespace ov {
+namespace itt {
+namespace domains {
+OV_ITT_DOMAIN(V10Reader_RT);
+}  // namespace domains
+}  // namespace itt
+}  // namespace ov
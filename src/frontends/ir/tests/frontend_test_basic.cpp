@@ -1805,3 +1805,47 @@ TEST_F(IRFrontendTests, VeryShortValidModel) {
     OV_ASSERT_NO_THROW(version = model->get_rt_info().at("version").as<int64_t>());
     ASSERT_EQ(11, version);
 }
+
+TEST_F(IRFrontendTests, model_with_many_constants) {
+    // constants are created in parallel, so the model should keep the order and the data of all of them
+    constexpr size_t constants_count = 64;
+    std::stringstream layers, concat_inputs, edges;
+    for (size_t i = 0; i < constants_count; i++) {
+        layers << "<layer id=\"" << i << "\" name=\"value" << i << "\" type=\"Const\" version=\"opset1\">"
+               << "<data element_type=\"f32\" shape=\"1\" offset=\"" << i * sizeof(float) << "\" size=\"4\"/>"
+               << "<output><port id=\"0\" precision=\"FP32\"><dim>1</dim></port></output></layer>";
+        concat_inputs << "<port id=\"" << i << "\" precision=\"FP32\"><dim>1</dim></port>";
+        edges << "<edge from-layer=\"" << i << "\" from-port=\"0\" to-layer=\"" << constants_count << "\" to-port=\""
+              << i << "\"/>";
+    }
+    edges << "<edge from-layer=\"" << constants_count << "\" from-port=\"" << constants_count << "\" to-layer=\""
+          << constants_count + 1 << "\" to-port=\"0\"/>";
+    std::stringstream xmlModel;
+    xmlModel << "<?xml version=\"1.0\" ?><net name=\"Network\" version=\"11\"><layers>" << layers.str()
+             << "<layer id=\"" << constants_count << "\" name=\"concat\" type=\"Concat\" version=\"opset1\">"
+             << "<data axis=\"0\"/><input>" << concat_inputs.str() << "</input><output><port id=\""
+             << constants_count << "\" precision=\"FP32\"><dim>" << constants_count << "</dim></port></output></layer>"
+             << "<layer id=\"" << constants_count + 1 << "\" name=\"output\" type=\"Result\" version=\"opset1\">"
+             << "<input><port id=\"0\" precision=\"FP32\"><dim>" << constants_count << "</dim></port></input></layer>"
+             << "</layers><edges>" << edges.str() << "</edges></net>";
+
+    std::vector<unsigned char> buffer(constants_count * sizeof(float));
+    float* floatBuffer = reinterpret_cast<float*>(buffer.data());
+    for (size_t i = 0; i < constants_count; i++) {
+        floatBuffer[i] = static_cast<float>(i);
+    }
+    createTemporalModelFile(xmlModel.str(), buffer);
+
+    std::shared_ptr<ov::Model> model;
+    OV_ASSERT_NO_THROW(model = core.read_model(xmlFileName, binFileName));
+    ASSERT_TRUE(!!model);
+
+    auto concat = model->get_results()[0]->get_input_node_shared_ptr(0);
+    ASSERT_EQ(constants_count, concat->get_input_size());
+    for (size_t i = 0; i < constants_count; i++) {
+        auto constant = ov::as_type_ptr<ov::opset1::Constant>(concat->get_input_node_shared_ptr(i));
+        ASSERT_TRUE(!!constant);
+        EXPECT_EQ("value" + std::to_string(i), constant->get_friendly_name());
+        EXPECT_EQ(std::vector<float>{static_cast<float>(i)}, constant->cast_vector<float>());
+    }
+}
@@ -71,6 +71,13 @@ public:
      */
     virtual void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Sets priority of the next inference, the pipeline stages of that inference are run by the executors with
+     * this priority. The inferences which follow it run with the default priority unless it's set again.
+     * @param priority - priority of the next inference
+     */
+    virtual void set_priority(ov::hint::Priority priority);
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
@@ -222,7 +229,8 @@ private:
 
     ov::threading::Task make_next_stage_task(const Pipeline::iterator itStage,
                                              const Pipeline::iterator itEndStage,
-                                             const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor);
+                                             const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor,
+                                             const ov::hint::Priority priority);
 
     template <typename F>
     void infer_impl(const F& f) {
@@ -277,6 +285,7 @@ private:
         m_sync_callback_executor;  //!< Used to run post inference callback in synchronous pipline
     mutable std::mutex m_mutex;
     std::function<void(std::exception_ptr)> m_callback;
+    ov::hint::Priority m_priority = ov::hint::Priority::DEFAULT;
 };
 
 }  // namespace ov
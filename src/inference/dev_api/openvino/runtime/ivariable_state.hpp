@@ -51,6 +51,15 @@ public:
      */
     virtual ov::SoPtr<ov::ITensor> get_state() const;
 
+    /**
+     * @brief Makes the state a copy of the source state, e.g. a state of another infer request after processing a
+     * common prompt. Implementations may share the memory of the source instead of copying it, but the states stay
+     * independent: changes of one of them after the call are not visible in the other one.
+     * The default implementation copies the tensor returned by the source get_state().
+     * @param source The state to copy, it must not be used by a running inference during the call
+     */
+    virtual void fork_from(const std::shared_ptr<IVariableState>& source);
+
 protected:
     /**
      * @brief A default dtor
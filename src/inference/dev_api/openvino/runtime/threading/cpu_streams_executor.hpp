@@ -23,7 +23,8 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        Each stream thread pulls tasks from its own queue and steals them from the queues of the other streams
+ *        (of the same NUMA node first), the tasks of higher priority are executed first.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -45,6 +46,8 @@ public:
 
     void run(Task task) override;
 
+    void run_with_priority(Task task, ov::hint::Priority priority) override;
+
     void execute(Task task) override;
 
     int get_stream_id() override;
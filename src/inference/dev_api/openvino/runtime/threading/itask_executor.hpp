@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "openvino/runtime/common.hpp"
+#include "openvino/runtime/properties.hpp"
 
 namespace ov {
 namespace threading {
@@ -62,6 +63,15 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute ov::Task inside task executor context with the given priority.
+     *        Executors which support priorities run the pending tasks of the higher priority first,
+     *        default implementation ignores the priority and uses run()
+     * @param task A task to start
+     * @param priority A priority of the task
+     */
+    virtual void run_with_priority(Task task, ov::hint::Priority priority);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default run_and_wait() method implementation uses run() pure virtual method
@@ -16,6 +16,7 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
@@ -278,6 +279,15 @@ public:
      */
     void start_async();
 
+    /**
+     * @brief Starts inference of specified input(s) in asynchronous mode with the given priority.
+     * @note The devices which support priorities run the pending tasks of the higher priority requests first, so the
+     *       inference of latency critical requests is not delayed by the others. The priority applies to this
+     *       inference only, infer() and start_async() use the default priority.
+     * @param priority Priority of the inference.
+     */
+    void start_async(ov::hint::Priority priority);
+
     /**
      * @brief Waits for the result to become available. Blocks until the result
      * becomes available.
@@ -721,6 +721,20 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief Read-write property to set an upper bound, in bytes, for the size of the models cache directory.
+ *
+ * When the limit is set, compiled blobs are published atomically, access to the cache directory is coordinated
+ * between processes with a lock file, and least recently used blobs are evicted once the total size of the cache
+ * exceeds the limit. The default value 0 means that the cache size is not limited.
+ *
+ * @code
+ * core.set_property(ov::cache_dir("cache/"), ov::cache_size_limit(4ull << 30)); // keep at most 4 GiB of blobs
+ * @endcode
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t> cache_size_limit{"CACHE_SIZE_LIMIT"};
+
 /**
  * @brief Read-only property to notify user that compiled model was loaded from the cache
  * @ingroup ov_runtime_cpp_prop_api
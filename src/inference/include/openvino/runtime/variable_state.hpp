@@ -74,6 +74,15 @@ public:
      * @param state The current state to set.
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Makes this state a copy of the source state, typically a state of another infer request of the same
+     * compiled model. It allows processing a common prompt once and continuing from it in several infer requests.
+     * Plugins may share the memory of the source state instead of copying it (copy-on-write), the states stay
+     * independent anyway.
+     * @param source The state to copy. Inference of the request owning the source must not run during the call.
+     */
+    void fork_from(const VariableState& source);
 };
 
 }  // namespace ov
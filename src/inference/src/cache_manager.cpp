@@ -0,0 +1,401 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cache_manager.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <system_error>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+
+namespace {
+
+constexpr const char* index_file_name = "ov_cache.idx";
+constexpr const char* lock_file_name = "ov_cache.lock";
+constexpr const char* index_header = "OV_CACHE_INDEX 1";
+constexpr const char* blob_ext = ".blob";
+constexpr const char* tmp_ext = ".tmp";
+
+// Temporary files left by crashed writers are removed once they are older than this
+constexpr auto stale_tmp_age = std::chrono::hours(1);
+
+// Last access times of the read entries are written to the index at most once per this interval,
+// other index updates of the process write them immediately
+constexpr uint64_t access_flush_interval_ms = 10000;
+
+ov::util::Path to_path(const std::string& path) {
+#if defined(_WIN32) && defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT)
+    return ov::util::Path(ov::util::string_to_wstring(path));
+#else
+    return ov::util::Path(path);
+#endif
+}
+
+uint64_t now_ms() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count());
+}
+
+std::string unique_suffix() {
+    static std::mutex gen_mutex;
+    static std::mt19937_64 gen{std::random_device{}()};
+    std::lock_guard<std::mutex> lock(gen_mutex);
+    std::stringstream ss;
+    ss << std::hex << gen();
+    return ss.str();
+}
+
+/**
+ * @brief Exclusive advisory lock on a file, used to serialize cache index updates between processes
+ */
+class FileLock {
+public:
+    explicit FileLock(const ov::util::Path& path) {
+#ifdef _WIN32
+        m_handle = CreateFileW(path.wstring().c_str(),
+                               GENERIC_READ | GENERIC_WRITE,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr,
+                               OPEN_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL,
+                               nullptr);
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped = {};
+            if (!LockFileEx(m_handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+                CloseHandle(m_handle);
+                m_handle = INVALID_HANDLE_VALUE;
+            }
+        }
+#else
+        m_fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0666);
+        if (m_fd != -1) {
+            int res;
+            do {
+                res = ::flock(m_fd, LOCK_EX);
+            } while (res == -1 && errno == EINTR);
+            if (res == -1) {
+                ::close(m_fd);
+                m_fd = -1;
+            }
+        }
+#endif
+    }
+
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+
+    ~FileLock() {
+#ifdef _WIN32
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped = {};
+            UnlockFileEx(m_handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+            CloseHandle(m_handle);
+        }
+#else
+        if (m_fd != -1) {
+            ::flock(m_fd, LOCK_UN);
+            ::close(m_fd);
+        }
+#endif
+    }
+
+    bool is_locked() const {
+#ifdef _WIN32
+        return m_handle != INVALID_HANDLE_VALUE;
+#else
+        return m_fd != -1;
+#endif
+    }
+
+private:
+#ifdef _WIN32
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+#else
+    int m_fd = -1;
+#endif
+};
+
+}  // namespace
+
+BoundedFileStorageCacheManager::BoundedFileStorageCacheManager(std::string cachePath, uint64_t sizeLimit)
+    : m_cachePath(to_path(cachePath)),
+      m_sizeLimit(sizeLimit) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    FileLock file_lock(m_cachePath / lock_file_name);
+    if (!file_lock.is_locked()) {
+        return;
+    }
+    auto index = load_index();
+    sync_with_directory(index);
+    evict(index, {});
+    store_index(index);
+}
+
+BoundedFileStorageCacheManager::~BoundedFileStorageCacheManager() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_pendingAccess.empty()) {
+        return;
+    }
+    FileLock file_lock(m_cachePath / lock_file_name);
+    if (!file_lock.is_locked()) {
+        return;
+    }
+    auto index = load_index();
+    apply_pending_access(index);
+    store_index(index);
+}
+
+ov::util::Path BoundedFileStorageCacheManager::get_blob_file(const std::string& id) const {
+    return m_cachePath / (id + blob_ext);
+}
+
+BoundedFileStorageCacheManager::Index BoundedFileStorageCacheManager::load_index() const {
+    Index index;
+    std::ifstream stream(m_cachePath / index_file_name);
+    std::string header;
+    if (!stream.is_open() || !std::getline(stream, header) || header != index_header) {
+        // Missing or unknown index, it is rebuilt from directory content
+        return index;
+    }
+    std::string id;
+    Entry entry;
+    while (stream >> id >> entry.size >> entry.last_access) {
+        index[id] = entry;
+    }
+    return index;
+}
+
+void BoundedFileStorageCacheManager::store_index(const Index& index) const {
+    const auto index_file = m_cachePath / index_file_name;
+    const auto tmp_file = m_cachePath / (std::string(index_file_name) + "." + unique_suffix() + tmp_ext);
+    {
+        std::ofstream stream(tmp_file, std::ios_base::out | std::ios_base::trunc);
+        if (!stream.is_open()) {
+            return;
+        }
+        stream << index_header << '\n';
+        for (const auto& item : index) {
+            stream << item.first << ' ' << item.second.size << ' ' << item.second.last_access << '\n';
+        }
+        if (!stream.good()) {
+            stream.close();
+            std::error_code ec;
+            std::filesystem::remove(tmp_file, ec);
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_file, index_file, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_file, ec);
+    }
+}
+
+void BoundedFileStorageCacheManager::apply_pending_access(Index& index) {
+    for (const auto& access : m_pendingAccess) {
+        auto it = index.find(access.first);
+        if (it != index.end()) {
+            it->second.last_access = std::max(it->second.last_access, access.second);
+        }
+    }
+    m_pendingAccess.clear();
+    m_lastAccessFlush = now_ms();
+}
+
+void BoundedFileStorageCacheManager::sync_with_directory(Index& index) const {
+    std::error_code ec;
+    std::unordered_map<std::string, uint64_t> blobs;
+    const auto now = std::filesystem::file_time_type::clock::now();
+    for (const auto& item : std::filesystem::directory_iterator(m_cachePath, ec)) {
+        std::error_code item_ec;
+        if (!item.is_regular_file(item_ec)) {
+            continue;
+        }
+        const auto& path = item.path();
+        if (path.extension() == blob_ext) {
+            blobs[path.stem().string()] = static_cast<uint64_t>(item.file_size(item_ec));
+        } else if (path.extension() == tmp_ext) {
+            const auto write_time = item.last_write_time(item_ec);
+            if (!item_ec && now - write_time > stale_tmp_age) {
+                std::filesystem::remove(path, item_ec);
+            }
+        }
+    }
+    if (ec) {
+        return;
+    }
+    // Drop entries removed by someone else
+    for (auto it = index.begin(); it != index.end();) {
+        it = blobs.count(it->first) ? std::next(it) : index.erase(it);
+    }
+    // Adopt blobs created without the index (e.g. by FileStorageCacheManager),
+    // their access time is unknown, so they are the first candidates for eviction
+    for (const auto& blob : blobs) {
+        auto& entry = index[blob.first];
+        entry.size = blob.second;
+    }
+}
+
+void BoundedFileStorageCacheManager::evict(Index& index, const std::string& keep_id) const {
+    uint64_t total_size = 0;
+    for (const auto& item : index) {
+        total_size += item.second.size;
+    }
+    if (total_size <= m_sizeLimit) {
+        return;
+    }
+
+    std::vector<Index::const_iterator> lru;
+    lru.reserve(index.size());
+    for (auto it = index.cbegin(); it != index.cend(); ++it) {
+        lru.push_back(it);
+    }
+    std::sort(lru.begin(), lru.end(), [&keep_id](const Index::const_iterator& a, const Index::const_iterator& b) {
+        // Entry which is just written is evicted last
+        const bool a_kept = a->first == keep_id;
+        const bool b_kept = b->first == keep_id;
+        if (a_kept != b_kept) {
+            return b_kept;
+        }
+        return a->second.last_access < b->second.last_access;
+    });
+
+    for (const auto& it : lru) {
+        if (total_size <= m_sizeLimit) {
+            break;
+        }
+        std::error_code ec;
+        std::filesystem::remove(get_blob_file(it->first), ec);
+        if (ec) {
+            // Blob may still be opened by a reader (Windows), keep it in index and retry on next eviction
+            continue;
+        }
+        total_size -= it->second.size;
+        index.erase(it);
+    }
+}
+
+void BoundedFileStorageCacheManager::write_cache_entry(const std::string& id, StreamWriter writer) {
+    // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
+    ScopedLocale plocal_C(LC_ALL, "C");
+    const auto blob_file = get_blob_file(id);
+    const auto tmp_file = m_cachePath / (id + blob_ext + "." + unique_suffix() + tmp_ext);
+    try {
+        std::ofstream stream(tmp_file, std::ios_base::binary | std::ofstream::out);
+        OPENVINO_ASSERT(stream.is_open(), "Cannot create cache file: ", tmp_file.string());
+        writer(stream);
+        stream.close();
+        OPENVINO_ASSERT(!stream.fail(), "Cannot write cache file: ", tmp_file.string());
+    } catch (...) {
+        std::error_code ec;
+        std::filesystem::remove(tmp_file, ec);
+        throw;
+    }
+
+    std::error_code ec;
+    const auto size = static_cast<uint64_t>(std::filesystem::file_size(tmp_file, ec));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    FileLock file_lock(m_cachePath / lock_file_name);
+    OPENVINO_ASSERT(file_lock.is_locked(),
+                    "Cannot lock cache directory: ",
+                    m_cachePath.string());
+
+    // Publish complete blob, readers see either previous entry or the new one
+    std::filesystem::rename(tmp_file, blob_file, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_file, ec);
+        OPENVINO_THROW("Cannot publish cache file: ", blob_file.string());
+    }
+
+    auto index = load_index();
+    sync_with_directory(index);
+    apply_pending_access(index);
+    index[id] = Entry{size, now_ms()};
+    evict(index, id);
+    store_index(index);
+}
+
+void BoundedFileStorageCacheManager::read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) {
+    // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
+    ScopedLocale plocal_C(LC_ALL, "C");
+    const auto blob_file = get_blob_file(id);
+    ov::Tensor compiled_blob;
+    std::ifstream blob_stream;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        FileLock file_lock(m_cachePath / lock_file_name);
+        std::error_code ec;
+        if (!std::filesystem::exists(blob_file, ec)) {
+            return;
+        }
+        // Blob is only opened (or mapped) under the lock, so it can't be evicted in between; once opened,
+        // its content stays valid even if the file is removed by another process afterwards. The content
+        // is copied after the lock is released, so large blobs don't block other users of the cache.
+        if (enable_mmap) {
+            compiled_blob = read_tensor_data(blob_file, element::u8, PartialShape::dynamic(1), 0, true);
+        } else {
+            blob_stream.open(blob_file, std::ios_base::binary);
+            if (!blob_stream.is_open()) {
+                return;
+            }
+        }
+        const auto now = now_ms();
+        m_pendingAccess[id] = now;
+        if (file_lock.is_locked() && now - m_lastAccessFlush >= access_flush_interval_ms) {
+            auto index = load_index();
+            apply_pending_access(index);
+            store_index(index);
+        }
+    }
+    if (!enable_mmap) {
+        blob_stream.seekg(0, std::ios_base::end);
+        const auto size = static_cast<size_t>(blob_stream.tellg());
+        blob_stream.seekg(0, std::ios_base::beg);
+        compiled_blob = ov::Tensor(element::u8, ov::Shape{size});
+        blob_stream.read(static_cast<char*>(compiled_blob.data()), static_cast<std::streamsize>(size));
+        OPENVINO_ASSERT(blob_stream.good(), "Cannot read cache file: ", blob_file.string());
+        blob_stream.close();
+    }
+    SharedStreamBuffer buf{reinterpret_cast<char*>(compiled_blob.data()), compiled_blob.get_byte_size()};
+    std::istream stream(&buf);
+    reader(stream, compiled_blob);
+}
+
+void BoundedFileStorageCacheManager::remove_cache_entry(const std::string& id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    FileLock file_lock(m_cachePath / lock_file_name);
+    std::error_code ec;
+    std::filesystem::remove(get_blob_file(id), ec);
+    m_pendingAccess.erase(id);
+    if (file_lock.is_locked()) {
+        auto index = load_index();
+        if (index.erase(id)) {
+            apply_pending_access(index);
+            store_index(index);
+        }
+    }
+}
+
+}  // namespace ov
@@ -12,10 +12,13 @@
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "openvino/util/file_path.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
 
@@ -159,4 +162,58 @@ private:
     }
 };
 
+/**
+ * @brief File storage-based Implementation of ICacheManager with a bounded size
+ *
+ * Stores one `<id>.blob` file per entry like FileStorageCacheManager, but additionally:
+ *  - publishes entries atomically: blob is written to a temporary file and renamed once complete,
+ *    so concurrent readers never observe a partially written blob;
+ *  - keeps an on-disk index with size and last access time of every entry;
+ *  - evicts least recently used entries once the total size of the cache exceeds the size limit;
+ *  - serializes index updates between threads and processes sharing the cache directory with a lock file.
+ *
+ */
+class BoundedFileStorageCacheManager final : public ICacheManager {
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param cachePath Cache directory
+     * @param sizeLimit Upper bound for the total size of all blobs in the directory, in bytes
+     */
+    BoundedFileStorageCacheManager(std::string cachePath, uint64_t sizeLimit);
+
+    /**
+     * @brief Destructor
+     *
+     */
+    ~BoundedFileStorageCacheManager() override;
+
+private:
+    struct Entry {
+        uint64_t size = 0;
+        uint64_t last_access = 0;
+    };
+    using Index = std::unordered_map<std::string, Entry>;
+
+    void write_cache_entry(const std::string& id, StreamWriter writer) override;
+    void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override;
+    void remove_cache_entry(const std::string& id) override;
+
+    ov::util::Path get_blob_file(const std::string& id) const;
+    Index load_index() const;
+    void store_index(const Index& index) const;
+    void evict(Index& index, const std::string& keep_id) const;
+    void sync_with_directory(Index& index) const;
+    void apply_pending_access(Index& index);
+
+    ov::util::Path m_cachePath;
+    uint64_t m_sizeLimit;
+    // Serializes access between threads of the process, the lock file serializes access between processes
+    mutable std::mutex m_mutex;
+    // Last access times of the read entries which are not written to the index yet
+    std::unordered_map<std::string, uint64_t> m_pendingAccess;
+    uint64_t m_lastAccessFlush = 0;
+};
+
 }  // namespace ov
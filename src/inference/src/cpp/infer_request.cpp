@@ -232,7 +232,20 @@ std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
 }
 
 void InferRequest::start_async() {
-    OV_INFER_REQ_CALL_STATEMENT(_impl->start_async());
+    start_async(ov::hint::Priority::DEFAULT);
+}
+
+void InferRequest::start_async(ov::hint::Priority priority) {
+    OV_INFER_REQ_CALL_STATEMENT({
+        _impl->set_priority(priority);
+        try {
+            _impl->start_async();
+        } catch (...) {
+            // the failed submission hasn't taken the priority, it must not be left for the next inference
+            _impl->set_priority(ov::hint::Priority::DEFAULT);
+            throw;
+        }
+    });
 }
 
 void InferRequest::wait() {
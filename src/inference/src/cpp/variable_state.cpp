@@ -49,4 +49,11 @@ void VariableState::set_state(const Tensor& state) {
     OV_VARIABLE_CALL_STATEMENT(_impl->set_state(get_tensor_impl(state)));
 }
 
+void VariableState::fork_from(const VariableState& source) {
+    OV_VARIABLE_CALL_STATEMENT({
+        OPENVINO_ASSERT(source._impl != nullptr, "Source VariableState was not initialized.");
+        _impl->fork_from(source._impl);
+    });
+}
+
 }  // namespace ov
@@ -204,8 +204,10 @@ void clean_batch_properties(const std::string& deviceName, ov::AnyMap& config, c
     }
 }
 
-static const auto core_properties_names =
-    ov::util::make_array(ov::cache_dir.name(), ov::enable_mmap.name(), ov::force_tbb_terminate.name());
+static const auto core_properties_names = ov::util::make_array(ov::cache_dir.name(),
+                                                               ov::cache_size_limit.name(),
+                                                               ov::enable_mmap.name(),
+                                                               ov::force_tbb_terminate.name());
 
 static const auto auto_batch_properties_names =
     ov::util::make_array(ov::auto_batch_timeout.name(), ov::hint::allow_auto_batching.name());
@@ -1229,6 +1231,8 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
         return decltype(ov::force_tbb_terminate)::value_type(flag);
     } else if (name == ov::cache_dir.name()) {
         return ov::Any(coreConfig.get_cache_dir());
+    } else if (name == ov::cache_size_limit.name()) {
+        return decltype(ov::cache_size_limit)::value_type(coreConfig.get_cache_size_limit());
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
@@ -1355,6 +1359,13 @@ void ov::CoreImpl::set_property_for_device(const ov::AnyMap& configMap, const st
             if (it != config.end()) {
                 config.erase(it);
             }
+
+            // cache size limit is applied to the whole cache, not to a particular device
+            it = config.find(ov::cache_size_limit.name());
+            if (it != config.end()) {
+                coreConfig.set({*it});
+                config.erase(it);
+            }
         }
 
         if (!config.empty()) {
@@ -1640,19 +1651,33 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         std::lock_guard<std::mutex> lock(other._cacheConfigMutex);
         _cacheConfig = other._cacheConfig;
         _cacheConfigPerDevice = other._cacheConfigPerDevice;
+        _cacheSizeLimit = other._cacheSizeLimit;
     }
     _flag_enable_mmap = other._flag_enable_mmap;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config) {
-    auto it = config.find(ov::cache_dir.name());
+    auto it = config.find(ov::cache_size_limit.name());
+    if (it != config.end()) {
+        std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+        _cacheSizeLimit = it->second.as<uint64_t>();
+        // re-create cache managers with the new limit, unless cache_dir is set at the same time
+        if (config.find(ov::cache_dir.name()) == config.end()) {
+            _cacheConfig = CoreConfig::CacheConfig::create(_cacheConfig._cacheDir, _cacheSizeLimit);
+            for (auto& deviceCfg : _cacheConfigPerDevice) {
+                deviceCfg.second = CoreConfig::CacheConfig::create(deviceCfg.second._cacheDir, _cacheSizeLimit);
+            }
+        }
+    }
+
+    it = config.find(ov::cache_dir.name());
     if (it != config.end()) {
         std::lock_guard<std::mutex> lock(_cacheConfigMutex);
         // fill global cache config
-        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+        _cacheConfig = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _cacheSizeLimit);
         // sets cache config per-device if it's not set explicitly before
         for (auto& deviceCfg : _cacheConfigPerDevice) {
-            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>());
+            deviceCfg.second = CoreConfig::CacheConfig::create(it->second.as<std::string>(), _cacheSizeLimit);
         }
     }
 
@@ -1681,14 +1706,14 @@ void ov::CoreConfig::remove_core(ov::AnyMap& config) {
 }
 
 void ov::CoreConfig::remove_core_skip_cache_dir(ov::AnyMap& config) {
-    for (const auto& name : {ov::enable_mmap.name(), ov::force_tbb_terminate.name()}) {
+    for (const auto& name : {ov::cache_size_limit.name(), ov::enable_mmap.name(), ov::force_tbb_terminate.name()}) {
         config.erase(name);
     }
 }
 
 void ov::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
     std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir);
+    _cacheConfigPerDevice[name] = CoreConfig::CacheConfig::create(dir, _cacheSizeLimit);
 }
 
 std::string ov::CoreConfig::get_cache_dir() const {
@@ -1696,6 +1721,11 @@ std::string ov::CoreConfig::get_cache_dir() const {
     return _cacheConfig._cacheDir;
 }
 
+uint64_t ov::CoreConfig::get_cache_size_limit() const {
+    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+    return _cacheSizeLimit;
+}
+
 bool ov::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
@@ -1707,7 +1737,7 @@ ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov
     // cache_dir is enabled locally in compile_model only
     if (parsedConfig.count(ov::cache_dir.name())) {
         const auto& cache_dir_val = parsedConfig.at(ov::cache_dir.name()).as<std::string>();
-        const auto& tempConfig = CoreConfig::CacheConfig::create(cache_dir_val);
+        const auto& tempConfig = CoreConfig::CacheConfig::create(cache_dir_val, get_cache_size_limit());
         // if plugin does not explicitly support cache_dir, and if plugin is not virtual, we need to remove
         // it from config
         if (!util::contains(plugin.get_property(ov::supported_properties), ov::cache_dir) &&
@@ -1725,7 +1755,7 @@ ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov
     return _cacheConfigPerDevice.count(plugin.get_name()) ? _cacheConfigPerDevice.at(plugin.get_name()) : _cacheConfig;
 }
 
-ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::string& dir) {
+ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::string& dir, uint64_t size_limit) {
     std::shared_ptr<ov::ICacheManager> cache_manager = nullptr;
 
     if (!dir.empty()) {
@@ -1734,7 +1764,11 @@ ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::strin
 #else
         ov::util::create_directory_recursive(dir);
 #endif
-        cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir);
+        if (size_limit > 0) {
+            cache_manager = std::make_shared<ov::BoundedFileStorageCacheManager>(dir, size_limit);
+        } else {
+            cache_manager = std::make_shared<ov::FileStorageCacheManager>(dir);
+        }
     }
 
     return {dir, std::move(cache_manager)};
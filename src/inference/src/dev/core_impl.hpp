@@ -32,7 +32,7 @@ public:
         std::string _cacheDir;
         std::shared_ptr<ov::ICacheManager> _cacheManager;
 
-        static CacheConfig create(const std::string& dir);
+        static CacheConfig create(const std::string& dir, uint64_t size_limit = 0);
     };
 
     void set(const ov::AnyMap& config);
@@ -48,6 +48,8 @@ public:
 
     std::string get_cache_dir() const;
 
+    uint64_t get_cache_size_limit() const;
+
     bool get_enable_mmap() const;
 
     CacheConfig get_cache_config_for_device(const ov::Plugin& plugin, ov::AnyMap& parsedConfig) const;
@@ -63,6 +65,7 @@ private:
     mutable std::mutex _cacheConfigMutex;
     CacheConfig _cacheConfig;
     std::map<std::string, CacheConfig> _cacheConfigPerDevice;
+    uint64_t _cacheSizeLimit = 0;
     bool _flag_enable_mmap = true;
 };
 
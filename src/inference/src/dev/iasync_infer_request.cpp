@@ -5,6 +5,7 @@
 #include "openvino/runtime/iasync_infer_request.hpp"
 
 #include <memory>
+#include <utility>
 
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
@@ -102,6 +103,11 @@ void ov::IAsyncInferRequest::set_callback(std::function<void(std::exception_ptr)
     m_callback = std::move(callback);
 }
 
+void ov::IAsyncInferRequest::set_priority(ov::hint::Priority priority) {
+    check_state();
+    m_priority = priority;
+}
+
 std::vector<ov::SoPtr<ov::IVariableState>> ov::IAsyncInferRequest::query_state() const {
     check_state();
     return m_sync_request->query_state();
@@ -120,15 +126,20 @@ void ov::IAsyncInferRequest::run_first_stage(const Pipeline::iterator itBeginSta
                                              const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
     auto& firstStageExecutor = std::get<Stage_e::EXECUTOR>(*itBeginStage);
     OPENVINO_ASSERT(nullptr != firstStageExecutor);
-    firstStageExecutor->run(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)));
+    // the priority is taken by this inference only, the next one runs with the default priority unless it's set again
+    const auto priority = std::exchange(m_priority, ov::hint::Priority::DEFAULT);
+    firstStageExecutor->run_with_priority(
+        make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor), priority),
+        priority);
 }
 
 ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
     const Pipeline::iterator itStage,
     const Pipeline::iterator itEndStage,
-    const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
+    const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor,
+    const ov::hint::Priority priority) {
     return std::bind(
-        [this, itStage, itEndStage](std::shared_ptr<ov::threading::ITaskExecutor>& callbackExecutor) mutable {
+        [this, itStage, itEndStage, priority](std::shared_ptr<ov::threading::ITaskExecutor>& callbackExecutor) mutable {
             std::exception_ptr currentException = nullptr;
             auto& thisStage = *itStage;
             auto itNextStage = itStage + 1;
@@ -140,7 +151,9 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::EXECUTOR>(nextStage);
                     OPENVINO_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(make_next_stage_task(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    nextStageExecutor->run_with_priority(
+                        make_next_stage_task(itNextStage, itEndStage, std::move(callbackExecutor), priority),
+                        priority);
                 }
             } catch (...) {
                 currentException = std::current_exception();
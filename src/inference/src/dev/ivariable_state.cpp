@@ -5,6 +5,7 @@
 #include "openvino/runtime/ivariable_state.hpp"
 
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 
 ov::IVariableState::IVariableState(const std::string& name) : m_name(name) {}
 
@@ -25,3 +26,12 @@ void ov::IVariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
 ov::SoPtr<ov::ITensor> ov::IVariableState::get_state() const {
     return m_state;
 }
+
+void ov::IVariableState::fork_from(const std::shared_ptr<IVariableState>& source) {
+    OPENVINO_ASSERT(source, "Source variable state is not initialized");
+    const auto& src = source->get_state();
+    OPENVINO_ASSERT(src, "Source variable state ", source->get_name(), " has no value");
+    auto copy = ov::make_tensor(src->get_element_type(), src->get_shape());
+    src->copy_to(copy);
+    set_state(ov::SoPtr<ov::ITensor>{copy, nullptr});
+}
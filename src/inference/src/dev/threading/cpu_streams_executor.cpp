@@ -4,8 +4,10 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -25,6 +27,42 @@
 namespace ov {
 namespace threading {
 struct CPUStreamsExecutor::Impl {
+    // Pending tasks of one stream thread by priority, the other stream threads steal them when they have no own tasks
+    struct TaskQueue {
+        static constexpr int priorities = static_cast<int>(ov::hint::Priority::HIGH) + 1;
+
+        void Push(Task task, ov::hint::Priority priority) {
+            const auto p = static_cast<size_t>(priority);
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tasks[p].emplace_back(std::move(task));
+            _sizes[p] = _tasks[p].size();
+        }
+
+        bool Pop(int priority, Task& task) {
+            // the size is checked first to not lock the queues with no tasks
+            if (_sizes[priority] == 0) {
+                return false;
+            }
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_tasks[priority].empty()) {
+                return false;
+            }
+            task = std::move(_tasks[priority].front());
+            _tasks[priority].pop_front();
+            _sizes[priority] = _tasks[priority].size();
+            return true;
+        }
+
+        std::mutex _mutex;
+        std::array<std::deque<Task>, priorities> _tasks;
+        std::array<std::atomic<size_t>, priorities> _sizes{};
+        // NUMA node of the stream which owns the queue, known after the first task of the stream
+        std::atomic<int> _numaNodeId{-1};
+    };
+
+    // executor and queue index of the current stream thread
+    static thread_local std::pair<const Impl*, size_t> t_worker;
+
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -354,35 +392,72 @@ struct CPUStreamsExecutor::Impl {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
                 _cpu_ids_all.insert(_cpu_ids_all.end(), processor_ids[streamId].begin(), processor_ids[streamId].end());
             }
+            _queues.emplace_back(new TaskQueue);
+        }
+        for (auto streamId = 0; streamId < streams_num; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
+                t_worker = {this, static_cast<size_t>(streamId)};
+                auto& queue = *_queues[streamId];
                 for (bool stopped = false; !stopped;) {
                     Task task;
-                    {
+                    if (!Pop(streamId, task)) {
                         std::unique_lock<std::mutex> lock(_mutex);
+                        ++_sleeping;
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return _pending > 0 || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                        --_sleeping;
+                        // the pending tasks are executed before the stop
+                        stopped = stopped && _pending == 0;
+                        continue;
                     }
+                    auto stream = _streams.local();
+                    queue._numaNodeId = stream->_numaNodeId;
+                    Execute(task, *stream);
                 }
             });
         }
         _streams.set_thread_ids_map(_threads);
     }
 
-    void Enqueue(Task task) {
-        {
+    // Tasks are pushed to the queue of the current stream thread, so the following stages of the request are
+    // executed on the same stream if it is free, the tasks from the other threads are distributed round-robin
+    void Enqueue(Task task, ov::hint::Priority priority) {
+        const size_t idx = t_worker.first == this ? t_worker.second : _nextQueue++ % _queues.size();
+        // the task is counted before it is published, so a worker which takes it at once never sees the counter
+        // wrap around; a worker which sees the counter first retries until the push is done
+        ++_pending;
+        _queues[idx]->Push(std::move(task), priority);
+        if (_sleeping > 0) {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _queueCondVar.notify_one();
+        }
+    }
+
+    // Takes a task of the highest priority available: from the own queue of the stream, then steals from the streams
+    // of the same NUMA node and only then from the other NUMA nodes
+    bool Pop(size_t idx, Task& task) {
+        if (_pending == 0) {
+            return false;
+        }
+        const int numaNodeId = _queues[idx]->_numaNodeId;
+        for (int priority = TaskQueue::priorities - 1; priority >= 0; --priority) {
+            if (_queues[idx]->Pop(priority, task)) {
+                --_pending;
+                return true;
+            }
+            for (const bool sameNode : {true, false}) {
+                for (size_t i = 1; i < _queues.size(); ++i) {
+                    auto& victim = *_queues[(idx + i) % _queues.size()];
+                    if ((victim._numaNodeId == numaNodeId) == sameNode && victim.Pop(priority, task)) {
+                        --_pending;
+                        return true;
+                    }
+                }
+            }
         }
-        _queueCondVar.notify_one();
+        return false;
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -450,9 +525,13 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    std::vector<std::unique_ptr<TaskQueue>> _queues;
+    std::atomic<size_t> _nextQueue{0};
+    std::atomic<size_t> _pending{0};
+    // number of the stream threads waiting for the tasks, the _mutex is locked to notify them only
+    std::atomic<size_t> _sleeping{0};
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
@@ -462,6 +541,8 @@ struct CPUStreamsExecutor::Impl {
     std::mutex _cpu_ids_mutex;
 };
 
+thread_local std::pair<const CPUStreamsExecutor::Impl*, size_t> CPUStreamsExecutor::Impl::t_worker{nullptr, 0};
+
 int CPUStreamsExecutor::get_stream_id() {
     if (!_impl->_streams.find_thread_id()) {
         return 0;
@@ -525,10 +606,14 @@ void CPUStreamsExecutor::execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run_with_priority(std::move(task), ov::hint::Priority::DEFAULT);
+}
+
+void CPUStreamsExecutor::run_with_priority(Task task, ov::hint::Priority priority) {
     if (0 == _impl->_config.get_streams()) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
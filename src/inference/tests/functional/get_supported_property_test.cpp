@@ -125,6 +125,17 @@ TEST(PropertyTest, SetCacheDirPropertyCoreNoThrow) {
     EXPECT_EQ(value.as<std::string>(), std::string("./tmp_cache_dir"));
 }
 
+TEST(PropertyTest, SetCacheSizeLimitPropertyCoreNoThrow) {
+    ov::Core core;
+
+    uint64_t value = 1;
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::cache_size_limit.name()).as<uint64_t>());
+    EXPECT_EQ(value, 0);
+    OV_ASSERT_NO_THROW(core.set_property(ov::cache_size_limit(1024)));
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::cache_size_limit.name()).as<uint64_t>());
+    EXPECT_EQ(value, 1024);
+}
+
 TEST(PropertyTest, SetTBBForceTerminatePropertyCoreNoThrow) {
     ov::Core core;
 
@@ -32,3 +32,9 @@ TEST_F(VariableStateOVTests, throwsOnUninitializedSetState) {
     ov::Tensor tensor;
     ASSERT_THROW(state.set_state(tensor), ov::Exception);
 }
+
+TEST_F(VariableStateOVTests, throwsOnUninitializedForkFrom) {
+    ov::VariableState state;
+    ov::VariableState source;
+    ASSERT_THROW(state.fork_from(source), ov::Exception);
+}
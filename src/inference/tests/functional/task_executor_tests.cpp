@@ -4,7 +4,9 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <future>
+#include <mutex>
 #include <thread>
 
 #include "common_test_utils/test_assertions.hpp"
@@ -127,6 +129,87 @@ TEST_P(TaskExecutorTests, canRunMultipleTasksFromMultipleThreads) {
             thread.join();
 }
 
+TEST_P(TaskExecutorTests, canRunTasksWithDifferentPriorities) {
+    auto taskExecutor = GetParam()();
+    std::atomic_int sharedVar = {0};
+    const std::vector<ov::hint::Priority> priorities = {ov::hint::Priority::LOW,
+                                                        ov::hint::Priority::MEDIUM,
+                                                        ov::hint::Priority::HIGH};
+    std::vector<Future> futures;
+    for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        for (auto&& priority : priorities) {
+            auto p = std::make_shared<std::packaged_task<void()>>([&] {
+                ++sharedVar;
+            });
+            futures.emplace_back(p->get_future());
+            taskExecutor->run_with_priority(
+                [p] {
+                    (*p)();
+                },
+                priority);
+        }
+    }
+
+    for (auto&& f : futures)
+        f.wait();
+    for (auto&& f : futures)
+        OV_ASSERT_NO_THROW(f.get());
+    ASSERT_EQ(MAX_NUMBER_OF_TASKS_IN_QUEUE * static_cast<int>(priorities.size()), sharedVar);
+}
+
+TEST(CPUStreamsExecutorPriorityTests, higherPriorityTaskRunsFirst) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1});
+    std::promise<void> started, release;
+    auto blocker = async(taskExecutor, [&] {
+        started.set_value();
+        release.get_future().wait();
+    });
+    // the only stream is busy, so both tasks wait in its queue
+    started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<ov::hint::Priority> order;
+    std::vector<Future> futures;
+    for (auto&& priority : {ov::hint::Priority::LOW, ov::hint::Priority::HIGH}) {
+        auto p = std::make_shared<std::packaged_task<void()>>([&, priority] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(priority);
+        });
+        futures.emplace_back(p->get_future());
+        taskExecutor->run_with_priority(
+            [p] {
+                (*p)();
+            },
+            priority);
+    }
+    release.set_value();
+
+    OV_ASSERT_NO_THROW(blocker.get());
+    for (auto&& f : futures)
+        OV_ASSERT_NO_THROW(f.get());
+    const std::vector<ov::hint::Priority> expected = {ov::hint::Priority::HIGH, ov::hint::Priority::LOW};
+    ASSERT_EQ(expected, order);
+}
+
+TEST(CPUStreamsExecutorPriorityTests, idleStreamStealsTasks) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2, 1});
+    std::thread::id ownerId, thiefId;
+    bool stolen = false;
+    auto owner = async(taskExecutor, [&] {
+        ownerId = std::this_thread::get_id();
+        // the task spawned by the stream goes to its own queue, and the stream stays busy until the task is done,
+        // so only the other stream can execute it
+        auto spawned = async(taskExecutor, [&] {
+            thiefId = std::this_thread::get_id();
+        });
+        stolen = spawned.wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+    });
+
+    OV_ASSERT_NO_THROW(owner.get());
+    ASSERT_TRUE(stolen);
+    ASSERT_NE(ownerId, thiefId);
+}
+
 TEST_P(TaskExecutorTests, executorNotReleasedUntilTasksAreDone) {
     std::mutex mutex_block_emulation;
     std::condition_variable cv_block_emulation;
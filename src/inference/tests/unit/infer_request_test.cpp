@@ -12,6 +12,7 @@
 #include "common_test_utils/test_assertions.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
 #include "unit_test_utils/mocks/openvino/runtime/mock_iasync_infer_request.hpp"
 
 using namespace ::testing;
@@ -56,6 +57,21 @@ TEST_F(OVInferRequestBaseTests, canReportErrorInStartAsync) {
     OV_EXPECT_THROW_HAS_SUBSTRING(request.start_async(), std::runtime_error, "compare");
 }
 
+TEST_F(OVInferRequestBaseTests, canForwardStartAsyncWithPriority) {
+    InSequence sequence;
+    EXPECT_CALL(*mock_impl.get(), set_priority(ov::hint::Priority::HIGH)).Times(1);
+    EXPECT_CALL(*mock_impl.get(), start_async()).Times(1);
+    OV_ASSERT_NO_THROW(request.start_async(ov::hint::Priority::HIGH));
+}
+
+TEST_F(OVInferRequestBaseTests, canResetPriorityOnErrorInStartAsync) {
+    InSequence sequence;
+    EXPECT_CALL(*mock_impl.get(), set_priority(ov::hint::Priority::HIGH)).Times(1);
+    EXPECT_CALL(*mock_impl.get(), start_async()).WillOnce(Throw(std::runtime_error("compare")));
+    EXPECT_CALL(*mock_impl.get(), set_priority(ov::hint::Priority::DEFAULT)).Times(1);
+    OV_EXPECT_THROW_HAS_SUBSTRING(request.start_async(ov::hint::Priority::HIGH), std::runtime_error, "compare");
+}
+
 // wait
 TEST_F(OVInferRequestBaseTests, canForwardWait) {
     EXPECT_CALL(*mock_impl.get(), wait()).WillOnce(Return());
@@ -148,3 +164,49 @@ TEST_F(OVInferRequestBaseTests, canReportErrorInSetCompletionCallback) {
     EXPECT_CALL(*mock_impl.get(), set_callback(_)).WillOnce(Throw(std::runtime_error("compare")));
     OV_EXPECT_THROW_HAS_SUBSTRING(request.set_callback(nullptr), std::runtime_error, "compare");
 }
+
+namespace {
+
+// Runs the tasks at once and records the priorities they are submitted with
+struct PriorityRecordingExecutor : public ov::threading::ITaskExecutor {
+    void run(ov::threading::Task task) override {
+        run_with_priority(std::move(task), ov::hint::Priority::DEFAULT);
+    }
+    void run_with_priority(ov::threading::Task task, ov::hint::Priority priority) override {
+        priorities.push_back(priority);
+        task();
+    }
+    std::vector<ov::hint::Priority> priorities;
+};
+
+class PipelineAsyncInferRequest : public ov::IAsyncInferRequest {
+public:
+    explicit PipelineAsyncInferRequest(const std::shared_ptr<ov::threading::ITaskExecutor>& executor)
+        : ov::IAsyncInferRequest(nullptr, nullptr, nullptr) {
+        m_pipeline = {{executor, [] {}}, {executor, [] {}}};
+        m_sync_pipeline = {{executor, [] {}}};
+    }
+    void check_tensors() const override {}
+};
+
+}  // namespace
+
+// priority
+TEST(OVInferRequestPriorityTests, priorityAppliesToOneInference) {
+    auto executor = std::make_shared<PriorityRecordingExecutor>();
+    ov::InferRequest request;
+    request.*get(InferRequest_Impl()) = std::make_shared<PipelineAsyncInferRequest>(executor);
+
+    // every stage of the prioritized inference runs with its priority, the inferences after it with the default one
+    request.start_async(ov::hint::Priority::HIGH);
+    request.wait();
+    request.infer();
+    request.start_async();
+    request.wait();
+    const std::vector<ov::hint::Priority> expected{ov::hint::Priority::HIGH,
+                                                   ov::hint::Priority::HIGH,
+                                                   ov::hint::Priority::DEFAULT,
+                                                   ov::hint::Priority::DEFAULT,
+                                                   ov::hint::Priority::DEFAULT};
+    EXPECT_EQ(executor->priorities, expected);
+}
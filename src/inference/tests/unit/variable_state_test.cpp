@@ -93,6 +93,25 @@ TEST_F(VariableStateTests, VariableStateInternalCanSaveStateByReference) {
     ASSERT_FLOAT_EQ(saver->data<float>()[2], 123);
 }
 
+TEST_F(VariableStateTests, VariableStateInternalCanForkState) {
+    std::shared_ptr<ov::IVariableState> pSource(new VariableStateMockImpl("VariableStateMockImpl"));
+    std::shared_ptr<ov::IVariableState> pState(new VariableStateMockImpl("VariableStateMockImpl"));
+    float data[] = {123, 124, 125};
+    state_tensor = ov::make_tensor(ov::element::f32, {3}, data);
+
+    pSource->set_state(state_tensor);
+    pState->fork_from(pSource);
+
+    // the forked state is independent of the source one
+    data[0] = 121;
+    auto saver = pState->get_state();
+
+    ASSERT_NE(saver, nullptr);
+    ASSERT_FLOAT_EQ(saver->data<float>()[0], 123);
+    ASSERT_FLOAT_EQ(saver->data<float>()[1], 124);
+    ASSERT_FLOAT_EQ(saver->data<float>()[2], 125);
+}
+
 // Tests for InferRequest::QueryState
 TEST_F(VariableStateTests, InferRequestCanConvertOneVariableStateFromCppToAPI) {
     std::vector<ov::SoPtr<ov::IVariableState>> toReturn(1);
@@ -175,6 +194,23 @@ TEST_F(VariableStateTests, InfReqVariableStateCanPropagateSetState) {
     ASSERT_FLOAT_EQ(saver->data<float>()[2], 125);
 }
 
+TEST_F(VariableStateTests, InfReqVariableStateCanPropagateForkFrom) {
+    auto source_variable_state = make_shared<ov::MockIVariableState>();
+    std::vector<ov::SoPtr<ov::IVariableState>> toReturn{mock_variable_state};
+    std::vector<ov::SoPtr<ov::IVariableState>> sourceToReturn{source_variable_state};
+    auto source_infer_request = make_shared<ov::MockIAsyncInferRequest>();
+    ov::InferRequest source_req;
+    source_req.*get(InferRequest_Impl()) = source_infer_request;
+    std::shared_ptr<ov::IVariableState> saver;
+
+    EXPECT_CALL(*mock_infer_request.get(), query_state()).WillRepeatedly(Return(toReturn));
+    EXPECT_CALL(*source_infer_request.get(), query_state()).WillRepeatedly(Return(sourceToReturn));
+    EXPECT_CALL(*mock_variable_state.get(), fork_from(_)).WillOnce(SaveArg<0>(&saver));
+
+    EXPECT_NO_THROW(req.query_state().front().fork_from(source_req.query_state().front()));
+    ASSERT_EQ(saver, source_variable_state);
+}
+
 TEST_F(VariableStateTests, InfReqVariableStateCanPropagateGetLastState) {
     std::vector<ov::SoPtr<ov::IVariableState>> toReturn;
 
@@ -65,6 +65,7 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
                 std::pair<AsyncInferRequest*, ov::threading::Task> t;
                 t.first = _this;
                 t.second = std::move(task);
+                workerInferRequest->update_arrival_stats();
                 workerInferRequest->_tasks.push(t);
                 // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
                 const int sz = static_cast<int>(workerInferRequest->_tasks.size());
@@ -112,6 +113,8 @@ std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->get_profiling_info();
+    else if (SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        return m_sync_request->m_partial_batch_request->get_profiling_info();
     else
         return m_request_without_batch->get_profiling_info();
 }
@@ -120,6 +123,8 @@ std::vector<ov::SoPtr<ov::IVariableState>> AsyncInferRequest::query_state() cons
     check_state();
     if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->query_state();
+    else if (SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+        return m_sync_request->m_partial_batch_request->query_state();
     else
         return m_request_without_batch->query_state();
 }
@@ -9,6 +9,34 @@
 
 namespace ov {
 namespace autobatch_plugin {
+namespace {
+// weight of the latest sample in the smoothed statistics of the adaptive timeout
+constexpr double stats_smoothing = 0.125;
+}  // namespace
+
+void CompiledModel::WorkerInferRequest::update_arrival_stats() {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    if (_last_arrival != std::chrono::steady_clock::time_point{}) {
+        add_inter_arrival_sample(std::chrono::duration<double, std::milli>(now - _last_arrival).count());
+    }
+    _last_arrival = now;
+}
+
+void CompiledModel::WorkerInferRequest::update_batch_latency_stats() {
+    const auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(_stats_mutex);
+    add_batch_latency_sample(std::chrono::duration<double, std::milli>(now - _batch_start).count());
+}
+
+void CompiledModel::WorkerInferRequest::add_inter_arrival_sample(double interval) {
+    _inter_arrival = _inter_arrival < 0 ? interval : _inter_arrival + stats_smoothing * (interval - _inter_arrival);
+}
+
+void CompiledModel::WorkerInferRequest::add_batch_latency_sample(double latency) {
+    _batch_latency = _batch_latency == 0 ? latency : _batch_latency + stats_smoothing * (latency - _batch_latency);
+}
+
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const ov::AnyMap& config,
@@ -17,18 +45,41 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::set<std::size_t>& batched_outputs,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                              const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                             const ov::SoPtr<ov::IRemoteContext>& context)
+                             const ov::SoPtr<ov::IRemoteContext>& context,
+                             const PartialBatchModels& compiled_models_partial_batch)
     : ov::ICompiledModel(model, plugin, context),
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
       m_compiled_model_with_batch(compiled_model_with_batch),
-      m_compiled_model_without_batch(compiled_model_without_batch) {
+      m_compiled_model_without_batch(compiled_model_without_batch),
+      m_compiled_models_partial_batch(compiled_models_partial_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     m_device_info = device_info;
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto target = config.find(latency_target.name());
+    if (target != config.end())
+        m_latency_target = target->second.as<std::uint32_t>();
+}
+
+std::uint32_t CompiledModel::choose_time_out(WorkerInferRequest& worker,
+                                             std::uint32_t time_out,
+                                             std::uint32_t target) {
+    if (target) {
+        std::lock_guard<std::mutex> lock(worker._stats_mutex);
+        // the first request of the batch waits for the whole timeout and then for the batch execution
+        double window = target - worker._batch_latency;
+        // no need to wait much longer than the batch is expected to be collected at the observed rate (twice as long
+        // to tolerate the jitter of the arrivals), so the requests don't wait for nothing when the rate drops
+        if (worker._inter_arrival >= 0)
+            window = std::min(window, 2.0 * worker._batch_size * worker._inter_arrival);
+        // at least 1 ms to not spin when the target can't be met anyway
+        time_out = std::min(time_out, static_cast<std::uint32_t>(std::max(1.0, window)));
+    }
+    worker._time_out = time_out;
+    return time_out;
 }
 
 CompiledModel::~CompiledModel() {
@@ -63,12 +114,18 @@ CompiledModel::GetWorkerInferRequest() const {
         if (workerRequestPtr->_infer_request_batched._so == nullptr)
             workerRequestPtr->_infer_request_batched._so = m_compiled_model_with_batch._so;
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
+        for (const auto& partial : m_compiled_models_partial_batch) {
+            ov::SoPtr<ov::IAsyncInferRequest> request = {partial.second->create_infer_request(), partial.second._so};
+            workerRequestPtr->_infer_requests_partial.emplace_back(static_cast<int>(partial.first), request);
+        }
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_is_wakeup = false;
+        workerRequestPtr->_time_out = m_time_out.load();
         workerRequestPtr->_infer_request_batched->set_callback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                workerRequestPtr->update_batch_latency_stats();
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
@@ -84,7 +141,10 @@ CompiledModel::GetWorkerInferRequest() const {
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(m_time_out));
+                    status = workerRequestPtr->_cond.wait_for(
+                        lock,
+                        std::chrono::milliseconds(
+                            choose_time_out(*workerRequestPtr, m_time_out.load(), m_latency_target.load())));
                     if ((status != std::cv_status::timeout) && (workerRequestPtr->_is_wakeup == false))
                         continue;
                     workerRequestPtr->_is_wakeup = false;
@@ -104,22 +164,79 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_sync_request->m_batched_request_status =
                                 ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        workerRequestPtr->_executed_requests += sz;
+                        workerRequestPtr->_executions++;
+                        {
+                            std::lock_guard<std::mutex> lock(workerRequestPtr->_stats_mutex);
+                            workerRequestPtr->_batch_start = std::chrono::steady_clock::now();
+                        }
                         workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
-                        // timeout to collect the batch is over, have to execute the requests in the batch1 mode
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        // popping all tasks collected by the moment of the time-out and execute each with batch1
+                        // timeout to collect the batch is over, popping all tasks collected by the moment of the
+                        // time-out and execute them with the largest partial batches that fit, the rest with batch1
+                        std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>> tasks(sz);
+                        for (auto& t : tasks) {
+                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        }
+                        // {partial request, first task of the batch}
+                        std::vector<std::pair<size_t, int>> partial_batches;
+                        int batched = 0;
+                        for (size_t i = 0; i < workerRequestPtr->_infer_requests_partial.size(); i++) {
+                            while (sz - batched >= workerRequestPtr->_infer_requests_partial[i].first) {
+                                partial_batches.emplace_back(i, batched);
+                                batched += workerRequestPtr->_infer_requests_partial[i].first;
+                            }
+                        }
+                        const int launched = static_cast<int>(partial_batches.size()) + sz - batched;
+                        workerRequestPtr->_executed_requests += sz;
+                        workerRequestPtr->_executions++;
+                        {
+                            std::lock_guard<std::mutex> lock(workerRequestPtr->_stats_mutex);
+                            workerRequestPtr->_batch_start = std::chrono::steady_clock::now();
+                        }
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                        for (const auto& partial_batch : partial_batches) {
+                            // the partial request is reused only when the whole batch is completed, so it is
+                            // captured by reference, the outputs are copied before notifying the requests
+                            auto& partial = workerRequestPtr->_infer_requests_partial[partial_batch.first];
+                            std::vector<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
+                                batch_tasks(tasks.begin() + partial_batch.second,
+                                            tasks.begin() + partial_batch.second + partial.first);
+                            for (size_t b = 0; b < batch_tasks.size(); b++) {
+                                auto& sync_request = batch_tasks[b].first->m_sync_request;
+                                sync_request->copy_inputs_to(partial.second, b, batch_tasks.size());
+                                sync_request->m_partial_batch_request = partial.second;
+                                sync_request->m_batched_request_status =
+                                    ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                            }
+                            partial.second->set_callback(
+                                [batch_tasks, &partial, launched, &arrived, &all_completed](std::exception_ptr p) {
+                                    for (size_t b = 0; b < batch_tasks.size(); b++) {
+                                        auto& sync_request = batch_tasks[b].first->m_sync_request;
+                                        if (p)
+                                            sync_request->m_exception_ptr = p;
+                                        else
+                                            sync_request->copy_outputs_from(partial.second, b, batch_tasks.size());
+                                    }
+                                    for (const auto& t : batch_tasks) {
+                                        t.second();
+                                    }
+                                    if (launched == ++arrived) {
+                                        all_completed.set_value();
+                                    }
+                                });
+                            partial.second->start_async();
+                        }
+                        for (int n = batched; n < sz; n++) {
+                            const auto& t = tasks[n];
                             t.first->m_request_without_batch->set_callback(
-                                [t, sz, &arrived, &all_completed](std::exception_ptr p) {
+                                [t, launched, &arrived, &all_completed](std::exception_ptr p) {
                                     if (p)
                                         t.first->m_sync_request->m_exception_ptr = p;
                                     t.second();
-                                    if (sz == ++arrived) {
+                                    if (launched == ++arrived) {
                                         all_completed.set_value();
                                     }
                                 });
@@ -129,6 +246,8 @@ CompiledModel::GetWorkerInferRequest() const {
                             t.first->m_request_without_batch->start_async();
                         }
                         all_completed_future.get();
+                        // the requests which waited for the timeout are delayed by this execution, not by the full one
+                        workerRequestPtr->update_batch_latency_stats();
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
                 }
@@ -170,11 +289,16 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == latency_target.name()) {
+            m_latency_target = property.second.as<std::uint32_t>();
+            m_config[latency_target.name()] = property.second.as<std::uint32_t>();
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and the ",
+                           latency_target.name());
         }
     }
 }
@@ -212,10 +336,37 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{partial_batching.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{latency_target.name(), ov::PropertyMutability::RW},
+                ov::PropertyName{adaptive_timeout.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{batch_fill.name(), ov::PropertyMutability::RO}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == partial_batching) {
+            return !m_compiled_models_partial_batch.empty();
+        } else if (name == latency_target) {
+            uint32_t target = m_latency_target;
+            return target;
+        } else if (name == adaptive_timeout) {
+            std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+            if (m_worker_requests.empty()) {
+                uint32_t time_out = m_time_out;
+                return time_out;
+            }
+            uint64_t time_out = 0;
+            for (const auto& w : m_worker_requests)
+                time_out += w->_time_out;
+            return static_cast<uint32_t>(time_out / m_worker_requests.size());
+        } else if (name == batch_fill) {
+            std::lock_guard<std::mutex> lock(m_worker_requests_mutex);
+            uint64_t requests = 0, executions = 0;
+            for (const auto& w : m_worker_requests) {
+                requests += w->_executed_requests;
+                executions += w->_executions;
+            }
+            return executions ? static_cast<float>(requests) / (executions * m_device_info.device_batch_size) : 0.f;
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
 #include <thread>
 
@@ -23,6 +24,8 @@ public:
     struct WorkerInferRequest {
         ov::SoPtr<ov::IAsyncInferRequest> _infer_request_batched;
         int _batch_size;
+        // requests of the smaller batch sizes (descending) to execute the partially collected batch on timeout
+        std::vector<std::pair<int, ov::SoPtr<ov::IAsyncInferRequest>>> _infer_requests_partial;
         ov::threading::ThreadSafeQueueWithSize<std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task>>
             _tasks;
         std::vector<ov::threading::Task> _completion_tasks;
@@ -31,8 +34,27 @@ public:
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
         bool _is_wakeup;
+
+        // statistics for the adaptive timeout (see ov::autobatch_plugin::latency_target), smoothed intervals in ms
+        std::mutex _stats_mutex;
+        std::chrono::steady_clock::time_point _last_arrival;
+        std::chrono::steady_clock::time_point _batch_start;
+        double _inter_arrival = -1;
+        double _batch_latency = 0;
+        std::atomic<std::uint32_t> _time_out = {0};
+        std::atomic<std::uint64_t> _executed_requests = {0};
+        std::atomic<std::uint64_t> _executions = {0};
+
+        void update_arrival_stats();
+        void update_batch_latency_stats();
+        // add the measured samples (in ms) to the smoothed statistics, _stats_mutex must be held
+        void add_inter_arrival_sample(double interval);
+        void add_batch_latency_sample(double latency);
     };
 
+    // models compiled for the smaller batch sizes (descending), see ov::autobatch_plugin::partial_batching
+    using PartialBatchModels = std::vector<std::pair<uint32_t, ov::SoPtr<ov::ICompiledModel>>>;
+
     CompiledModel(const std::shared_ptr<ov::Model>& model,
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   const ov::AnyMap& config,
@@ -41,7 +63,8 @@ public:
                   const std::set<std::size_t>& batched_outputs,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_with_batch,
                   const ov::SoPtr<ov::ICompiledModel>& compiled_model_without_batch,
-                  const ov::SoPtr<ov::IRemoteContext>& context);
+                  const ov::SoPtr<ov::IRemoteContext>& context,
+                  const PartialBatchModels& compiled_models_partial_batch = {});
 
     void set_property(const ov::AnyMap& properties) override;
 
@@ -51,6 +74,9 @@ public:
 
     std::shared_ptr<const ov::Model> get_runtime_model() const override;
 
+    // timeout to collect the next batch of the worker, adapted to the latency target if it is set (non-zero)
+    static std::uint32_t choose_time_out(WorkerInferRequest& worker, std::uint32_t time_out, std::uint32_t target);
+
     void export_model(std::ostream& model) const override;
 
     virtual ~CompiledModel();
@@ -72,13 +98,15 @@ protected:
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
-    std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    std::atomic<std::uint32_t> m_time_out = {0};        // in ms
+    std::atomic<std::uint32_t> m_latency_target = {0};  // in ms
 
     const std::set<std::size_t> m_batched_inputs;
     const std::set<std::size_t> m_batched_outputs;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
+    PartialBatchModels m_compiled_models_partial_batch;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
@@ -22,7 +22,9 @@ namespace autobatch_plugin {
 std::vector<ov::PropertyName> supported_configKeys = {
     ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
     ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RW},
-    ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW}};
+    ov::PropertyName{ov::enable_profiling.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{partial_batching.name(), ov::PropertyMutability::RW},
+    ov::PropertyName{latency_target.name(), ov::PropertyMutability::RW}};
 
 inline ov::AnyMap merge_properties(ov::AnyMap config, const ov::AnyMap& user_config) {
     for (auto&& kvp : user_config) {
@@ -119,6 +121,8 @@ Plugin::Plugin() {
     set_device_name("BATCH");
     m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
     m_plugin_config.insert(ov::enable_profiling(false));
+    m_plugin_config.insert(partial_batching(false));
+    m_plugin_config.insert(latency_target(0));
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
@@ -268,28 +272,46 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
             compiled_model_config.insert(c);
     }
+    auto compile_model_with_batch = [&](uint32_t batch_size) {
+        auto reshaped = model->clone();
+        auto inputs = reshaped->inputs();
+        std::map<std::size_t, ov::PartialShape> partial_shapes;
+        for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
+            auto input_shape = inputs[input_id].get_shape();
+            if (batched_inputs.find(input_id) != batched_inputs.end()) {
+                input_shape[0] = batch_size;
+            }
+            partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+        }
+
+        reshaped->reshape(partial_shapes);
+        return context ? core->compile_model(reshaped, context, device_config_no_auto_batch)
+                       : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+    };
     ov::SoPtr<ov::ICompiledModel> compiled_model_with_batch;
-    auto reshaped = model->clone();
     if (meta_device.device_batch_size > 1 && batched_inputs.size()) {
         try {
-            auto inputs = reshaped->inputs();
-            std::map<std::size_t, ov::PartialShape> partial_shapes;
-            for (size_t input_id = 0; input_id < inputs.size(); input_id++) {
-                auto input_shape = inputs[input_id].get_shape();
-                if (batched_inputs.find(input_id) != batched_inputs.end()) {
-                    input_shape[0] = meta_device.device_batch_size;
-                }
-                partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
-            }
-
-            reshaped->reshape(partial_shapes);
-            compiled_model_with_batch = context
-                                            ? core->compile_model(reshaped, context, device_config_no_auto_batch)
-                                            : core->compile_model(reshaped, device_name, device_config_no_auto_batch);
+            compiled_model_with_batch = compile_model_with_batch(meta_device.device_batch_size);
         } catch (const ov::Exception&) {
             meta_device.device_batch_size = 1;
         }
     }
+    CompiledModel::PartialBatchModels compiled_models_partial_batch;
+    const auto partial = full_properties.find(partial_batching.name());
+    if (compiled_model_with_batch && partial != full_properties.end() && partial->second.as<bool>()) {
+        // powers of 2 below the batch size, so any number of the collected requests is covered by at most one
+        // request of each size (and at most one batch1 request)
+        uint32_t batch_size = 1;
+        while (batch_size * 2 < meta_device.device_batch_size)
+            batch_size *= 2;
+        for (; batch_size > 1; batch_size /= 2) {
+            try {
+                compiled_models_partial_batch.emplace_back(batch_size, compile_model_with_batch(batch_size));
+            } catch (const ov::Exception&) {
+                // the requests are executed with the rest of the sizes (or batch1)
+            }
+        }
+    }
 
     ov::SoPtr<ov::IRemoteContext> device_context;
     if (!context) {
@@ -311,7 +333,8 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
                                            batched_outputs,
                                            compiled_model_with_batch,
                                            compiled_model_without_batch,
-                                           device_context);
+                                           device_context,
+                                           compiled_models_partial_batch);
 }
 
 ov::SupportedOpsMap Plugin::query_model(const std::shared_ptr<const ov::Model>& model,
@@ -17,6 +17,30 @@
 namespace ov {
 namespace autobatch_plugin {
 
+/**
+ * @brief Enables the execution of the partially collected batches: the batch is additionally compiled for the smaller
+ * (power of 2) batch sizes, so the requests collected by the timeout are executed with the largest of them that fit
+ * rather than one by one. Costs the extra compilations and the memory of the extra compiled models.
+ */
+static constexpr ov::Property<bool, ov::PropertyMutability::RW> partial_batching{"AUTO_BATCH_PARTIAL_BATCHING"};
+
+/**
+ * @brief Target latency of the requests (ms) for the adaptive timeout, 0 (default) disables it. The timeout to collect
+ * the batch is chosen from the observed intervals between the requests and the latency of the batch execution, so the
+ * batch is collected as long as the target latency allows it. ov::auto_batch_timeout bounds the chosen timeout.
+ */
+static constexpr ov::Property<uint32_t, ov::PropertyMutability::RW> latency_target{"AUTO_BATCH_LATENCY_TARGET"};
+
+/**
+ * @brief Timeout to collect the batch (ms) chosen by the adaptive timeout (averaged over the batched requests)
+ */
+static constexpr ov::Property<uint32_t, ov::PropertyMutability::RO> adaptive_timeout{"AUTO_BATCH_ADAPTIVE_TIMEOUT"};
+
+/**
+ * @brief Achieved batch fill: the average number of requests executed at once divided by the batch size
+ */
+static constexpr ov::Property<float, ov::PropertyMutability::RO> batch_fill{"AUTO_BATCH_BATCH_FILL"};
+
 struct DeviceInformation {
     std::string device_name;
     ov::AnyMap device_config;
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mock_common.hpp"
+
+using ov::autobatch_plugin::CompiledModel;
+
+class AdaptiveTimeoutTest : public ::testing::Test {
+public:
+    static constexpr std::uint32_t time_out = 1000;
+    static constexpr int samples = 50;
+
+    CompiledModel::WorkerInferRequest m_worker;
+
+    void SetUp() override {
+        m_worker._batch_size = 4;
+    }
+
+    // the smoothed statistics converge to the steady values
+    void feed(double inter_arrival, double batch_latency) {
+        std::lock_guard<std::mutex> lock(m_worker._stats_mutex);
+        for (int i = 0; i < samples; i++) {
+            if (inter_arrival >= 0)
+                m_worker.add_inter_arrival_sample(inter_arrival);
+            if (batch_latency >= 0)
+                m_worker.add_batch_latency_sample(batch_latency);
+        }
+    }
+
+    std::uint32_t choose(std::uint32_t target, std::uint32_t max_time_out = time_out) {
+        return CompiledModel::choose_time_out(m_worker, max_time_out, target);
+    }
+};
+
+TEST_F(AdaptiveTimeoutTest, NoTargetKeepsTimeout) {
+    feed(10, 20);
+    EXPECT_EQ(choose(0), time_out);
+    EXPECT_EQ(m_worker._time_out, time_out);
+}
+
+TEST_F(AdaptiveTimeoutTest, FollowsLatencyTarget) {
+    // requests arrive every 100 ms, so the batch of 4 is expected in 400 ms, and it runs for 20 ms
+    feed(100, 20);
+    // the first request of the batch waits for the target minus the batch latency
+    EXPECT_EQ(choose(100), 80u);
+    EXPECT_EQ(m_worker._time_out, 80u);
+    // the looser target, the longer wait
+    EXPECT_EQ(choose(300), 280u);
+    // but not much longer than the batch is expected to be collected
+    EXPECT_EQ(choose(2000), 800u);
+    // and never longer than AUTO_BATCH_TIMEOUT
+    EXPECT_EQ(choose(2000, 500), 500u);
+}
+
+TEST_F(AdaptiveTimeoutTest, FollowsMeasuredLatency) {
+    feed(100, 20);
+    EXPECT_EQ(choose(100), 80u);
+    // the batch execution slows down, the wait shrinks
+    feed(-1, 60);
+    EXPECT_EQ(choose(100), 40u);
+    // the target can't be met, the worker doesn't spin
+    feed(-1, 200);
+    EXPECT_EQ(choose(100), 1u);
+    // the batch execution speeds up again, the wait grows
+    feed(-1, 10);
+    EXPECT_EQ(choose(100), 89u);
+}
+
+TEST_F(AdaptiveTimeoutTest, FollowsArrivalRate) {
+    feed(100, 20);
+    EXPECT_EQ(choose(2000), 800u);
+    // the traffic rises, the batch is collected sooner
+    feed(10, -1);
+    EXPECT_EQ(choose(2000), 80u);
+    // the traffic drops, the target bounds the wait
+    feed(1000, -1);
+    EXPECT_EQ(choose(2000, 5000), 1980u);
+}
@@ -205,6 +205,63 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyOutputTensorTestCase) {
     EXPECT_NO_THROW(req->copy_outputs_if_needed());
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyTensorsToPartialBatchTestCase) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  0,
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    m_auto_batch_infer_requests.emplace_back(req);
+
+    const size_t partial_batch_size = 2;
+    auto partial_model = m_model->clone();
+    std::map<std::size_t, ov::PartialShape> partial_shapes;
+    for (size_t input_id = 0; input_id < partial_model->inputs().size(); input_id++) {
+        auto input_shape = partial_model->inputs()[input_id].get_shape();
+        input_shape[0] = partial_batch_size;
+        partial_shapes.insert({input_id, ov::PartialShape(input_shape)});
+    }
+    partial_model->reshape(partial_shapes);
+    auto partial_compile_model = std::make_shared<NiceMock<MockICompiledModel>>(partial_model, m_auto_batch_plugin);
+    auto partial_sync_request = std::make_shared<NiceMock<MockISyncInferRequest>>(partial_compile_model);
+    ov::SoPtr<ov::IAsyncInferRequest> partial_request = {
+        std::make_shared<NiceMock<MockIAsyncInferRequest>>(partial_sync_request, m_executor, nullptr),
+        {}};
+
+    for (const auto& input : req->get_inputs()) {
+        auto tensor = req->get_tensor(input);
+        std::memset(tensor->data(), 1, tensor->get_byte_size());
+        auto partial_tensor = partial_request->get_tensor(input);
+        std::memset(partial_tensor->data(), 0, partial_tensor->get_byte_size());
+    }
+    EXPECT_NO_THROW(req->copy_inputs_to(partial_request, 1, partial_batch_size));
+    for (const auto& input : req->get_inputs()) {
+        auto partial_tensor = partial_request->get_tensor(input);
+        const auto* data = static_cast<const uint8_t*>(partial_tensor->data());
+        const size_t item_size = partial_tensor->get_byte_size() / partial_batch_size;
+        EXPECT_EQ(std::count(data, data + item_size, 0), static_cast<std::ptrdiff_t>(item_size));
+        EXPECT_EQ(std::count(data + item_size, data + 2 * item_size, 1), static_cast<std::ptrdiff_t>(item_size));
+    }
+
+    for (const auto& output : req->get_outputs()) {
+        auto partial_tensor = partial_request->get_tensor(output);
+        const size_t item_size = partial_tensor->get_byte_size() / partial_batch_size;
+        std::memset(partial_tensor->data(), 2, item_size);
+        std::memset(static_cast<uint8_t*>(partial_tensor->data()) + item_size, 3, item_size);
+    }
+    EXPECT_NO_THROW(req->copy_outputs_from(partial_request, 1, partial_batch_size));
+    for (const auto& output : req->get_outputs()) {
+        auto tensor = req->get_tensor(output);
+        const auto* data = static_cast<const uint8_t*>(tensor->data());
+        EXPECT_EQ(std::count(data, data + tensor->get_byte_size(), 3),
+                  static_cast<std::ptrdiff_t>(tensor->get_byte_size()));
+    }
+}
+
 TEST_P(AutoBatchRequestTest, AutoBatchRequestGetProfilingInfoTestCase) {
     prepare_input(m_model, m_batch_size);
     create_worker(m_batch_size);
@@ -4,22 +4,87 @@
 
 #include "async_infer_request.hpp"
 
-struct RequestExecutor : ov::threading::ITaskExecutor {
-    explicit RequestExecutor(ov::SoPtr<ov::IAsyncInferRequest>& request) : m_request(request) {
-        m_request->set_callback([this](std::exception_ptr exception_ptr) mutable {
-            m_exception_ptr = std::move(exception_ptr);
-            auto task = std::move(m_task);
-            task();
-        });
+#include <atomic>
+#include <mutex>
+
+namespace {
+// Starts every subrequest as soon as the subrequests producing its inputs are completed, so independent subgraphs are
+// executed concurrently. The task is run when all subrequests are completed, the subrequests depending on a failed one
+// are not started.
+struct SubgraphsExecutor : ov::threading::ITaskExecutor {
+    SubgraphsExecutor(std::vector<ov::SoPtr<ov::IAsyncInferRequest>>& requests,
+                      const std::vector<std::vector<size_t>>& consumers,
+                      const std::vector<size_t>& num_producers)
+        : m_requests(requests),
+          m_consumers(consumers),
+          m_num_producers(num_producers),
+          m_pending(new std::atomic<size_t>[requests.size()]) {
+        for (size_t i = 0; i < m_requests.size(); i++) {
+            m_requests[i]->set_callback([this, i](std::exception_ptr exception_ptr) mutable {
+                if (exception_ptr) {
+                    fail(std::move(exception_ptr));
+                }
+                complete(i);
+            });
+        }
     }
     void run(ov::threading::Task task) override {
         m_task = std::move(task);
-        m_request->start_async();
+        m_exception_ptr = nullptr;
+        m_failed = false;
+        m_remaining = m_requests.size();
+        std::vector<size_t> ready;
+        for (size_t i = 0; i < m_requests.size(); i++) {
+            m_pending[i] = m_num_producers[i];
+            if (m_num_producers[i] == 0) {
+                ready.push_back(i);
+            }
+        }
+        for (auto i : ready) {
+            start(i);
+        }
     };
-    ov::SoPtr<ov::IAsyncInferRequest>& m_request;
+    void start(size_t idx) {
+        if (m_failed) {
+            complete(idx);
+            return;
+        }
+        try {
+            m_requests[idx]->start_async();
+        } catch (...) {
+            fail(std::current_exception());
+            complete(idx);
+        }
+    }
+    void fail(std::exception_ptr exception_ptr) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_exception_ptr) {
+            m_exception_ptr = std::move(exception_ptr);
+        }
+        m_failed = true;
+    }
+    void complete(size_t idx) {
+        for (auto consumer : m_consumers[idx]) {
+            if (--m_pending[consumer] == 0) {
+                start(consumer);
+            }
+        }
+        if (--m_remaining == 0) {
+            auto task = std::move(m_task);
+            task();
+        }
+    }
+    std::vector<ov::SoPtr<ov::IAsyncInferRequest>>& m_requests;
+    const std::vector<std::vector<size_t>>& m_consumers;
+    const std::vector<size_t>& m_num_producers;
+    std::unique_ptr<std::atomic<size_t>[]> m_pending;
+    std::atomic<size_t> m_remaining{0};
+    std::atomic<bool> m_failed{false};
+    std::mutex m_mutex;
     std::exception_ptr m_exception_ptr;
     ov::threading::Task m_task;
 };
+}  // namespace
 
 ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::hetero::InferRequest>& request,
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
@@ -27,14 +92,14 @@ ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::heter
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
     m_pipeline.clear();
-    for (auto&& request : m_infer_request->m_subrequests) {
-        auto request_executor = std::make_shared<RequestExecutor>(request);
-        m_pipeline.emplace_back(request_executor, [request_executor] {
-            if (nullptr != request_executor->m_exception_ptr) {
-                std::rethrow_exception(request_executor->m_exception_ptr);
-            }
-        });
-    }
+    auto subgraphs_executor = std::make_shared<SubgraphsExecutor>(m_infer_request->m_subrequests,
+                                                                  m_infer_request->m_subrequest_consumers,
+                                                                  m_infer_request->m_subrequest_num_producers);
+    m_pipeline.emplace_back(subgraphs_executor, [subgraphs_executor] {
+        if (nullptr != subgraphs_executor->m_exception_ptr) {
+            std::rethrow_exception(subgraphs_executor->m_exception_ptr);
+        }
+    });
 }
 
 ov::hetero::AsyncInferRequest::~AsyncInferRequest() {
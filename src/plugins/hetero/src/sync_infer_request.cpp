@@ -7,12 +7,14 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 
 #include "compiled_model.hpp"
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "plugin.hpp"
 
@@ -35,6 +37,7 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
     }
 
     std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> temp_tensor_map;
+    std::set<std::pair<size_t, size_t>> dependencies;
     for (const auto& kvp : compiled_model->m_mapping_info._submodels_input_to_prev_output) {
         const auto& submodel_idx_in = kvp.first.first;
         const auto& port_idx_in = kvp.first.second;
@@ -42,15 +45,32 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         const auto& port_idx_out = kvp.second.second;
 
         const auto& output_port = m_subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
-        const auto& output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
         if (temp_tensor_map.find(output_port) == temp_tensor_map.end()) {
-            temp_tensor_map[output_port] = {
-                ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
-                nullptr};
+            auto output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
+            if (!output_tensor._so) {
+                output_tensor._so = m_subrequests[submodel_idx_out]._so;
+            }
+            // host memory of the producer is handed off to the consumer as is, the rest goes through a host tensor
+            if (std::dynamic_pointer_cast<ov::IRemoteTensor>(output_tensor._ptr) ||
+                output_port.get_partial_shape().is_dynamic()) {
+                temp_tensor_map[output_port] = {
+                    ov::make_tensor(output_tensor->get_element_type(), output_tensor->get_shape()),
+                    nullptr};
+                m_subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
+            } else {
+                temp_tensor_map[output_port] = output_tensor;
+            }
         }
-        m_subrequests[submodel_idx_out]->set_tensor(output_port, temp_tensor_map[output_port]);
         const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
         m_subrequests[submodel_idx_in]->set_tensor(input_port, temp_tensor_map[output_port]);
+        dependencies.emplace(submodel_idx_out, submodel_idx_in);
+    }
+
+    m_subrequest_consumers.resize(m_subrequests.size());
+    m_subrequest_num_producers.resize(m_subrequests.size(), 0);
+    for (const auto& dependency : dependencies) {
+        m_subrequest_consumers[dependency.first].push_back(dependency.second);
+        m_subrequest_num_producers[dependency.second]++;
     }
 }
 
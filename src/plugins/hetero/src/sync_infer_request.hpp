@@ -52,6 +52,9 @@ private:
 
     std::vector<ov::SoPtr<ov::IAsyncInferRequest>> m_subrequests;
     std::map<ov::Output<const ov::Node>, size_t> m_port_to_subrequest_idx;
+    // for each subrequest: the subrequests consuming its outputs and the number of the subrequests producing its inputs
+    std::vector<std::vector<size_t>> m_subrequest_consumers;
+    std::vector<size_t> m_subrequest_num_producers;
 };
 
 }  // namespace hetero
@@ -201,6 +201,30 @@ std::shared_ptr<ov::Model> ov::hetero::tests::HeteroTests::create_model_with_mul
     result->set_friendly_name("res");
     return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
 }
+
+std::shared_ptr<ov::Model> ov::hetero::tests::HeteroTests::create_model_with_independent_subgraphs() {
+    auto param1 = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::PartialShape{1, 3, 2, 2});
+    param1->set_friendly_name("input1");
+    auto const_value1 = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {1});
+    const_value1->set_friendly_name("const_val1");
+    auto add = std::make_shared<ov::opset11::Add>(param1, const_value1);
+    add->set_friendly_name("add");
+    auto reshape_val = ov::opset11::Constant::create(ov::element::i64, ov::Shape{3}, {1, 3, 4});
+    reshape_val->set_friendly_name("reshape_val");
+    auto reshape = std::make_shared<ov::opset11::Reshape>(add, reshape_val, true);
+    reshape->set_friendly_name("reshape");
+    auto result1 = std::make_shared<ov::opset11::Result>(reshape);
+    result1->set_friendly_name("res1");
+    auto param2 = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::PartialShape{1, 3, 2, 2});
+    param2->set_friendly_name("input2");
+    auto const_value2 = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 1, 1, 1}, {1});
+    const_value2->set_friendly_name("const_val2");
+    auto subtract = std::make_shared<ov::opset11::Subtract>(param2, const_value2);
+    subtract->set_friendly_name("sub");
+    auto result2 = std::make_shared<ov::opset11::Result>(subtract);
+    result2->set_friendly_name("res2");
+    return std::make_shared<ov::Model>(ov::ResultVector{result1, result2}, ov::ParameterVector{param1, param2});
+}
 // Mock plugins
 
 class MockCompiledModel : public ov::ICompiledModel {
@@ -28,6 +28,7 @@ public:
     std::shared_ptr<ov::Model> create_model_with_subtract_shapeof_reshape(bool dynamic = false);
     std::shared_ptr<ov::Model> create_model_with_independent_parameter(bool dynamic = false);
     std::shared_ptr<ov::Model> create_model_with_multi_add();
+    std::shared_ptr<ov::Model> create_model_with_independent_subgraphs();
     ov::Tensor create_and_fill_tensor(const ov::element::Type& type, const ov::Shape& shape);
 
 private:
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/test_constants.hpp"
+#include "hetero_tests.hpp"
+
+using namespace ov::hetero::tests;
+
+TEST_F(HeteroTests, infer_independent_subgraphs_async) {
+    auto model = create_model_with_independent_subgraphs();
+    auto compiled_model =
+        core.compile_model(model, ov::test::utils::DEVICE_HETERO, ov::device::priorities("MOCK0,MOCK1"));
+    // several requests are in flight at once
+    std::vector<ov::InferRequest> infer_requests;
+    std::vector<std::pair<ov::Tensor, ov::Tensor>> input_tensors;
+    for (size_t i = 0; i < 3; i++) {
+        infer_requests.push_back(compiled_model.create_infer_request());
+        auto input_tensor1 =
+            create_and_fill_tensor(compiled_model.input(0).get_element_type(), compiled_model.input(0).get_shape());
+        auto input_tensor2 =
+            create_and_fill_tensor(compiled_model.input(1).get_element_type(), compiled_model.input(1).get_shape());
+        input_tensor1.data<int64_t>()[0] = static_cast<int64_t>(i);
+        input_tensor2.data<int64_t>()[0] = static_cast<int64_t>(i * 2);
+        infer_requests.back().set_input_tensor(0, input_tensor1);
+        infer_requests.back().set_input_tensor(1, input_tensor2);
+        input_tensors.emplace_back(input_tensor1, input_tensor2);
+    }
+    for (auto& infer_request : infer_requests) {
+        OV_ASSERT_NO_THROW(infer_request.start_async());
+    }
+    for (size_t i = 0; i < infer_requests.size(); i++) {
+        OV_ASSERT_NO_THROW(infer_requests[i].wait());
+        auto output_tensor1 = infer_requests[i].get_output_tensor(0);
+        auto output_tensor2 = infer_requests[i].get_output_tensor(1);
+        ASSERT_EQ(output_tensor1.get_size(), input_tensors[i].first.get_size());
+        ASSERT_EQ(output_tensor2.get_size(), input_tensors[i].second.get_size());
+        for (size_t j = 0; j < output_tensor1.get_size(); j++) {
+            EXPECT_EQ(output_tensor1.data<int64_t>()[j], input_tensors[i].first.data<int64_t>()[j] + 1);
+            EXPECT_EQ(output_tensor2.data<int64_t>()[j], input_tensors[i].second.data<int64_t>()[j] - 1);
+        }
+    }
+}
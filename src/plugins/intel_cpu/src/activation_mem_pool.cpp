@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "activation_mem_pool.h"
+
+#include <common/utils.hpp>
+#include <iterator>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+constexpr int cacheLineSize = 64;
+}  // namespace
+
+const ActivationMemoryPool::Ptr& ActivationMemoryPool::instance() {
+    // compiled models keep the pointer, so the pool outlives all of them
+    static const Ptr pool = std::make_shared<ActivationMemoryPool>();
+    return pool;
+}
+
+ActivationMemoryPool::~ActivationMemoryPool() {
+    for (auto&& arena : m_arenas) {
+        dnnl::impl::free(arena.first);
+    }
+}
+
+std::pair<void*, size_t> ActivationMemoryPool::acquire(size_t size) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_free.lower_bound(size);
+    if (it != m_free.end()) {
+        auto arena = std::make_pair(it->second, it->first);
+        m_free.erase(it);
+        return arena;
+    }
+
+    if (!m_free.empty()) {
+        // all the free arenas are too small, the biggest of them is replaced with a bigger one
+        auto biggest = std::prev(m_free.end());
+        dnnl::impl::free(biggest->second);
+        m_arenas.erase(biggest->second);
+        m_size -= biggest->first;
+        m_free.erase(biggest);
+    }
+
+    void* ptr = dnnl::impl::malloc(size, cacheLineSize);
+    OPENVINO_ASSERT(ptr, "Failed to allocate ", size, " bytes of memory");
+    m_arenas.emplace(ptr, size);
+    m_size += size;
+    return {ptr, size};
+}
+
+void ActivationMemoryPool::release(void* ptr) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_arenas.find(ptr);
+    OPENVINO_ASSERT(it != m_arenas.end(), "The memory doesn't belong to the activation memory pool");
+    m_free.emplace(it->second, ptr);
+}
+
+size_t ActivationMemoryPool::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_size;
+}
+
+}  // namespace ov::intel_cpu
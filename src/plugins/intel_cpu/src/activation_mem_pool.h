@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Process wide pool of the memory arenas for the intermediate tensors.
+ * A compiled model created with ov::intel_cpu::shared_activation_memory leases an arena from the pool for the time of
+ * an inference instead of keeping its own one, so the resident memory follows the number of the concurrent inferences
+ * rather than the number of the loaded models. The arenas are never returned to the system, the pool holds as many of
+ * them as there were concurrent leases at peak.
+ */
+class ActivationMemoryPool {
+public:
+    using Ptr = std::shared_ptr<ActivationMemoryPool>;
+
+    static const Ptr& instance();
+
+    ActivationMemoryPool() = default;
+    ~ActivationMemoryPool();
+
+    ActivationMemoryPool(const ActivationMemoryPool&) = delete;
+    ActivationMemoryPool& operator=(const ActivationMemoryPool&) = delete;
+
+    /**
+     * @brief Leases the smallest free arena of at least size bytes. When there is none, the biggest free arena is
+     * replaced with a new one of the requested size, so the number of the arenas doesn't grow
+     * @return pointer to the arena and its size
+     */
+    std::pair<void*, size_t> acquire(size_t size);
+
+    /**
+     * @brief Returns the leased arena to the pool
+     */
+    void release(void* ptr);
+
+    /**
+     * @brief Total size of the arenas, both free and leased, in bytes
+     */
+    size_t size() const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::multimap<size_t, void*> m_free;         // free arenas by size
+    std::unordered_map<void*, size_t> m_arenas;  // all the arenas
+    size_t m_size = 0;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
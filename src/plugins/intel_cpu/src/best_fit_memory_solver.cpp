@@ -0,0 +1,184 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "best_fit_memory_solver.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <tuple>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+constexpr int64_t not_placed = -1;
+// the refinement converges in a few passes, the limit only bounds the compilation time for degenerate cases
+constexpr size_t max_compaction_passes = 8;
+
+int64_t duration(const ov::MemorySolver::Box& box) {
+    return static_cast<int64_t>(box.finish) - box.start + 1;
+}
+}  // namespace
+
+BestFitMemorySolver::BestFitMemorySolver(std::vector<Box> boxes) : m_boxes(std::move(boxes)) {
+    ov::MemorySolver::normalize_boxes(m_boxes);
+}
+
+int64_t BestFitMemorySolver::bestFitOffset(size_t idx, const std::vector<int64_t>& offsets, bool lowest) const {
+    const auto& box = m_boxes[idx];
+    std::vector<std::pair<int64_t, int64_t>> alive;  // [offset, end) of the placed boxes alive together with the box
+    for (size_t i = 0; i < m_boxes.size(); i++) {
+        const auto& other = m_boxes[i];
+        if (i == idx || offsets[i] == not_placed || other.start > box.finish || other.finish < box.start) {
+            continue;
+        }
+        alive.emplace_back(offsets[i], offsets[i] + other.size);
+    }
+    std::sort(alive.begin(), alive.end());
+
+    int64_t best_offset = not_placed;
+    int64_t best_gap = std::numeric_limits<int64_t>::max();
+    int64_t gap_start = 0;
+    for (const auto& [begin, end] : alive) {
+        const int64_t gap = begin - gap_start;
+        if (gap >= box.size && gap < best_gap) {
+            best_offset = gap_start;
+            best_gap = gap;
+            if (lowest) {
+                break;
+            }
+        }
+        gap_start = std::max(gap_start, end);
+    }
+    return best_offset == not_placed ? gap_start : best_offset;
+}
+
+int64_t BestFitMemorySolver::place(const Order& order, std::vector<int64_t>& offsets, bool lowest) const {
+    offsets.assign(m_boxes.size(), not_placed);
+    int64_t total = 0;
+    for (auto idx : order) {
+        offsets[idx] = bestFitOffset(idx, offsets, lowest);
+        total = std::max(total, offsets[idx] + m_boxes[idx].size);
+    }
+    return total;
+}
+
+int64_t BestFitMemorySolver::compact(std::vector<int64_t>& offsets) const {
+    auto arenaSize = [&]() {
+        int64_t total = 0;
+        for (size_t i = 0; i < m_boxes.size(); i++) {
+            total = std::max(total, offsets[i] + m_boxes[i].size);
+        }
+        return total;
+    };
+
+    int64_t total = arenaSize();
+    Order order(m_boxes.size());
+    for (size_t pass = 0; pass < max_compaction_passes; pass++) {
+        // the boxes at the top of the arena go first, as they define its size
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+            return offsets[l] + m_boxes[l].size > offsets[r] + m_boxes[r].size;
+        });
+        bool moved = false;
+        for (auto idx : order) {
+            const int64_t old_offset = offsets[idx];
+            offsets[idx] = not_placed;
+            const int64_t new_offset = bestFitOffset(idx, offsets, true);
+            offsets[idx] = std::min(old_offset, new_offset);
+            moved = moved || new_offset < old_offset;
+        }
+        if (!moved) {
+            break;
+        }
+        total = arenaSize();
+    }
+    return total;
+}
+
+int64_t BestFitMemorySolver::solve(bool refine) {
+    m_offsets.clear();
+    if (m_boxes.empty()) {
+        return 0;
+    }
+
+    using Less = std::function<bool(const Box&, const Box&)>;
+    std::vector<Less> criteria{[](const Box& l, const Box& r) {
+        return std::make_tuple(l.size, duration(l)) > std::make_tuple(r.size, duration(r));
+    }};
+    if (refine) {
+        criteria.emplace_back([](const Box& l, const Box& r) {
+            return std::make_tuple(l.size * duration(l), l.size) > std::make_tuple(r.size * duration(r), r.size);
+        });
+        criteria.emplace_back([](const Box& l, const Box& r) {
+            return std::make_tuple(duration(l), l.size) > std::make_tuple(duration(r), r.size);
+        });
+    }
+
+    int64_t best_total = std::numeric_limits<int64_t>::max();
+    std::vector<int64_t> best_offsets;
+    std::vector<int64_t> offsets;
+    Order order(m_boxes.size());
+    for (const auto& less : criteria) {
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+            return less(m_boxes[l], m_boxes[r]);
+        });
+        // the refinement also starts from the lowest fit placement, which is what ov::MemorySolver does
+        for (bool lowest : {false, true}) {
+            if (lowest && !refine) {
+                break;
+            }
+            int64_t total = place(order, offsets, lowest);
+            if (refine) {
+                total = compact(offsets);
+            }
+            if (total < best_total) {
+                best_total = total;
+                best_offsets = offsets;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < m_boxes.size(); i++) {
+        m_offsets[m_boxes[i].id] = best_offsets[i];
+    }
+    return best_total;
+}
+
+int64_t BestFitMemorySolver::get_offset(int64_t id) const {
+    auto it = m_offsets.find(id);
+    OPENVINO_ASSERT(it != m_offsets.end(), "There is no box with id ", id);
+    return it->second;
+}
+
+int64_t maxLiveSize(std::vector<ov::MemorySolver::Box> boxes) {
+    ov::MemorySolver::normalize_boxes(boxes);
+
+    auto finishCmp = [](const ov::MemorySolver::Box& l, const ov::MemorySolver::Box& r) {
+        return l.finish > r.finish;
+    };
+    std::priority_queue<ov::MemorySolver::Box, std::vector<ov::MemorySolver::Box>, decltype(finishCmp)> alive(
+        finishCmp);
+
+    int64_t current_size = 0;
+    int64_t max_size = 0;
+    for (const auto& box : boxes) {
+        while (!alive.empty() && alive.top().finish < box.start) {
+            current_size -= alive.top().size;
+            alive.pop();
+        }
+        current_size += box.size;
+        alive.push(box);
+        max_size = std::max(max_size, current_size);
+    }
+    return max_size;
+}
+
+}  // namespace ov::intel_cpu
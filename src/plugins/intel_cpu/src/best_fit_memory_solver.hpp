@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/memory_solver.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Alternative to ov::MemorySolver which packs the boxes into a single arena by the "greedy by size" strategy
+ * with the best fit offsets: the boxes are placed from the biggest to the smallest one, every box goes to the
+ * smallest gap between the boxes which are alive at the same time where it fits, instead of the lowest such gap.
+ * The optional refinement pass tries several placement orders and then repeatedly moves the boxes to the lower gaps
+ * while the arena shrinks, it is still a heuristic and costs several times more than the plain placement.
+ * The interface mirrors ov::MemorySolver.
+ */
+class BestFitMemorySolver {
+public:
+    using Box = ov::MemorySolver::Box;
+
+    explicit BestFitMemorySolver(std::vector<Box> boxes);
+
+    /**
+     * @brief Assigns the offsets to the boxes
+     * @param refine - run the refinement pass
+     * @return size of the arena in the units of the box size
+     */
+    int64_t solve(bool refine);
+
+    int64_t get_offset(int64_t id) const;
+
+private:
+    using Order = std::vector<size_t>;
+
+    int64_t place(const Order& order, std::vector<int64_t>& offsets, bool lowest) const;
+    int64_t compact(std::vector<int64_t>& offsets) const;
+    // the smallest gap where the box fits or the lowest one if lowest is set, the top of the placed boxes otherwise
+    int64_t bestFitOffset(size_t idx, const std::vector<int64_t>& offsets, bool lowest) const;
+
+    std::vector<Box> m_boxes;
+    std::unordered_map<int64_t, int64_t> m_offsets;
+};
+
+/**
+ * @brief Lower bound of the arena size for the given boxes: the maximal total size of the boxes alive at the same time
+ */
+int64_t maxLiveSize(std::vector<ov::MemorySolver::Box> boxes);
+
+}  // namespace ov::intel_cpu
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 
@@ -12,12 +14,35 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Lookup counters of a cache
+ */
+struct CacheStatistics {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    CacheStatistics& operator+=(const CacheStatistics& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        return *this;
+    }
+};
+
 class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t { Hit, Miss };
 
 public:
     virtual ~CacheEntryBase() = default;
+
+    virtual CacheStatistics getStatistics() const = 0;
+
+    /**
+     * @brief Removes all the records, the lookup counters are kept
+     */
+    virtual void clear() = 0;
 };
 
 /**
@@ -25,8 +50,9 @@ public:
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide bool put(KeyType, ValueType) returning whether a
+ * record was evicted and ValueType get(const KeyType&) interface and must have constructor of type ImplType(size_t).
+ * CacheEntry is thread safe as long as ImplType is.
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -51,6 +77,7 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -58,15 +85,36 @@ public:
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            _misses.fetch_add(1, std::memory_order_relaxed);
             retVal = builder(key);
-            if (retVal != retEmpty)
-                _impl.put(key, retVal);
+            if (retVal != retEmpty && _impl.put(key, retVal)) {
+                _evictions.fetch_add(1, std::memory_order_relaxed);
+            }
+        } else {
+            _hits.fetch_add(1, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
 
+    CacheStatistics getStatistics() const override {
+        CacheStatistics stats;
+        stats.hits = _hits.load(std::memory_order_relaxed);
+        stats.misses = _misses.load(std::memory_order_relaxed);
+        stats.evictions = _evictions.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void clear() override {
+        _impl.evict(_impl.getCapacity());
+    }
+
 public:
     ImplType _impl;
+
+private:
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+    std::atomic<uint64_t> _evictions{0};
 };
 
 }  // namespace intel_cpu
@@ -8,4 +8,25 @@ namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::MultiCache(const MultiCache& other) : _capacity(other._capacity), _threadSafe(other._threadSafe) {
+    std::shared_lock<std::shared_mutex> lock(other._storageMutex);
+    _storage = other._storage;
+}
+
+CacheStatistics MultiCache::getStatistics() const {
+    CacheStatistics stats;
+    std::shared_lock<std::shared_mutex> lock(_storageMutex);
+    for (const auto& entry : _storage) {
+        stats += entry.second->getStatistics();
+    }
+    return stats;
+}
+
+void MultiCache::clear() {
+    std::shared_lock<std::shared_mutex> lock(_storageMutex);
+    for (const auto& entry : _storage) {
+        entry.second->clear();
+    }
+}
+
 }  // namespace ov::intel_cpu
@@ -6,9 +6,12 @@
 
 #include <atomic>
 #include <functional>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include "cache_entry.h"
+#include "sharded_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -16,23 +19,28 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention By default this implementation IS NOT THREAD SAFE! Thread safe instance, which may be shared between
+ * several streams, is created by passing threadSafe = true to the constructor. Its records are stored in
+ * ShardedLruCache.
  */
 
 class MultiCache {
 public:
-    template <typename KeyType, typename ValueType>
-    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template <typename KeyType, typename ValueType, typename ImplType = LruCache<KeyType, ValueType>>
+    using EntryTypeT = CacheEntry<KeyType, ValueType, ImplType>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
-    template <typename KeyType, typename ValueType>
-    using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+    template <typename KeyType, typename ValueType, typename ImplType = LruCache<KeyType, ValueType>>
+    using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType, ImplType>>;
 
 public:
     /**
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param threadSafe defines whether the cache may be accessed from several threads concurrently
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false) : _capacity(capacity), _threadSafe(threadSafe) {}
+
+    MultiCache(const MultiCache& other);
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -47,19 +55,40 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
+        if (_threadSafe) {
+            auto entry = getEntry<KeyType, ValueType, ShardedLruCache<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Returns lookup counters accumulated over all the entries
+     */
+    CacheStatistics getStatistics() const;
+
+    /**
+     * @brief Removes the records of all the entries to free the memory they hold
+     */
+    void clear();
+
+    bool isThreadSafe() const noexcept {
+        return _threadSafe;
+    }
+
 private:
     template <typename T>
     size_t getTypeId();
-    template <typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template <typename KeyType, typename ValueType, typename ImplType = LruCache<KeyType, ValueType>>
+    EntryPtr<KeyType, ValueType, ImplType> getEntry();
 
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _threadSafe;
+    // guards the entries table only, the entries themselves are thread safe if _threadSafe is set
+    mutable std::shared_mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -69,10 +98,18 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template <typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template <typename KeyType, typename ValueType, typename ImplType>
+MultiCache::EntryPtr<KeyType, ValueType, ImplType> MultiCache::getEntry() {
+    using EntryType = EntryTypeT<KeyType, ValueType, ImplType>;
     size_t id = getTypeId<EntryType>();
+    {
+        std::shared_lock<std::shared_mutex> lock(_storageMutex);
+        auto itr = _storage.find(id);
+        if (itr != _storage.end()) {
+            return std::static_pointer_cast<EntryType>(itr->second);
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(_storageMutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
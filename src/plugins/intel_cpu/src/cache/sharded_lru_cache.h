@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The key space is split into several shards by the key hash, every shard is an independent LruCache guarded by its
+ * own mutex, so concurrent lookups of different keys rarely contend on the same lock.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note LRU order is maintained per shard, so the evicted record is the least recently used one within its shard.
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template <typename Key, typename Value>
+class ShardedLruCache {
+public:
+    static constexpr size_t maxShards = 16;
+
+    explicit ShardedLruCache(size_t capacity) : _capacity(capacity) {
+        const size_t numShards = std::max<size_t>(1, std::min(maxShards, capacity));
+        const size_t shardCapacity = (capacity + numShards - 1) / numShards;
+        _shards.reserve(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            _shards.emplace_back(std::make_unique<Shard>(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     * @return true if a record was evicted to free space for the new one
+     */
+    bool put(const Key& key, const Value& val) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+    Value get(const Key& key) {
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records from every shard
+     * @param n number of records to be evicted per shard, can be greater than capacity
+     */
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->cache.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+        std::mutex mutex;
+        LruCache<Key, Value> cache;
+    };
+
+    Shard& getShard(const Key& key) {
+        size_t h = key.hash();
+        // the low bits are also used by the unordered_map inside the shard, so mix the high bits in
+        h ^= h >> 16;
+        return *_shards[h % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -45,6 +45,12 @@ struct ImmediateSerialExecutor : public ov::threading::ITaskExecutor {
 };
 
 CompiledModel::~CompiledModel() {
+    // the watchdog thread may be releasing the memory of the graphs right now
+    m_idleWatchdog.reset();
+    if (m_weightsTicket) {
+        // the graphs are still alive, so are the cached weights
+        m_weightsTicket.retention->retain(m_weightsTicket, m_model, m_socketWeights);
+    }
     if (m_has_sub_compiled_models) {
         m_sub_compiled_models.clear();
         m_sub_memory_manager->_memorys_table.clear();
@@ -56,15 +62,35 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             WeightsRetention::Ticket weights_ticket,
+                             const RepackedWeights::Ptr& repacked_weights)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_weightsTicket(std::move(weights_ticket)),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
+    // the runtime model of the previous compiled model owns the weights some of the reclaimed keys refer to, it is
+    // kept until the objects the graphs don't use are unpinned, so these addresses are not reused in between
+    std::shared_ptr<const ov::Model> reclaimedModel;
+    if (m_weightsTicket) {
+        // the weights repacked by the previous compiled model of the same model are taken from its caches
+        if (auto retained = m_weightsTicket.retention->reclaim(m_weightsTicket)) {
+            m_socketWeights = std::move(retained->weights);
+            reclaimedModel = std::move(retained->model);
+        }
+    }
+    if (repacked_weights) {
+        // the weights repacked before export, the unused ones are released once the graphs are created
+        repacked_weights->prefill(m_socketWeights, m_model);
+    }
+    if (m_cfg.rtCacheShared) {
+        m_sharedRtParamsCache = std::make_shared<MultiCache>(m_cfg.rtCacheCapacity, true);
+    }
     const auto& core = m_plugin->get_core();
     if (!core) {
         OPENVINO_THROW("Unable to get API version. Core is unavailable");
@@ -102,6 +128,7 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     std::vector<Task> tasks;
     tasks.resize(streams);
     m_graphs.resize(streams);
+    m_rtParamsCaches.resize(streams);
     if (executor_config.get_streams() != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
@@ -126,6 +153,12 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     } else {
         CompiledModel::get_graph();
     }
+    // the graphs hold the reclaimed weights they need, the rest is freed
+    m_socketWeights.unpin();
+    reclaimedModel.reset();
+    if (m_weightsTicket) {
+        m_weightsTicket.retention->track(m_socketWeights);
+    }
     if (m_cfg.numSubStreams > 0) {
         m_has_sub_compiled_models = true;
         auto sub_cfg = m_cfg;
@@ -152,6 +185,12 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                 std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
         }
     }
+    if (m_cfg.idleMemoryReleaseTimeout > 0) {
+        m_idleWatchdog = std::make_unique<IdleWatchdog>(std::chrono::milliseconds(m_cfg.idleMemoryReleaseTimeout),
+                                                        [this] {
+                                                            return try_release_memory();
+                                                        });
+    }
 }
 
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
@@ -184,12 +223,21 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                                                          m_socketWeights[socketId],
                                                          isQuantizedFlag,
                                                          streamsExecutor,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_sharedRtParamsCache);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.Init(model, ctx);
                 graphLock._graph.Activate();
+                {
+                    // the stream cache is the params cache itself unless the latter is shared, the slot of the graph
+                    // is taken by the context of the graph which is ready, a failed attempt leaves nothing behind
+                    std::lock_guard<std::mutex> lock{*m_mutex.get()};
+                    m_rtParamsCaches[graph_idx] = ctx->getStreamParamsCache();
+                }
+                // nothing is inferred yet, the leased memory is not needed
+                ctx->returnSharedMemory();
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -245,6 +293,90 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return m_loaded_from_cache;
     }
 
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        CacheStatistics stats;
+        {
+            std::lock_guard<std::mutex> lock{*m_mutex};
+            if (m_sharedRtParamsCache) {
+                stats += m_sharedRtParamsCache->getStatistics();
+            }
+            for (const auto& cache : m_rtParamsCaches) {
+                if (cache) {
+                    stats += cache->getStatistics();
+                }
+            }
+        }
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type{{"HITS", stats.hits},
+                                                                                 {"MISSES", stats.misses},
+                                                                                 {"EVICTIONS", stats.evictions}};
+    }
+
+    if (name == ov::intel_cpu::memory_solver_statistics) {
+        const auto footprint =
+            get_graph()._graph.getGraphContext()->getAuxiliaryNetworkMemoryControl()->footprint();
+        return decltype(ov::intel_cpu::memory_solver_statistics)::value_type{
+            {"SOLVED_SIZE", footprint.solved_size},
+            {"OPTIMAL_SIZE", footprint.optimal_size}};
+    }
+
+    if (name == ov::intel_cpu::weights_cache_statistics) {
+        WeightsSharing::Statistics stats;
+        for (const auto& item : m_socketWeights.dumpStatistics()) {
+            stats += item.second;
+        }
+        return decltype(ov::intel_cpu::weights_cache_statistics)::value_type{
+            {"SIZE", stats.total_size},
+            {"OBJECTS", stats.total_memory_objects},
+            {"HITS", stats.hits},
+            {"MISSES", stats.misses}};
+    }
+
+    if (name == ov::intel_cpu::memory_release_statistics) {
+        MemoryReleaseStatistics stats;
+        for (auto&& graph : m_graphs) {
+            std::lock_guard<std::mutex> lock(graph._mutex);
+            if (graph.IsReady()) {
+                stats += graph.getGraphContext()->getAuxiliaryNetworkMemoryControl()->releaseStatistics();
+            }
+        }
+        return decltype(ov::intel_cpu::memory_release_statistics)::value_type{
+            {"RELEASES", stats.releases},
+            {"REALLOCATIONS", stats.reallocations},
+            {"REALLOCATION_TIME_US", stats.reallocation_time_us}};
+    }
+
+    if (name == ov::intel_cpu::shapes_plan_cache_statistics) {
+        CacheStatistics stats;
+        for (auto&& graph : m_graphs) {
+            std::lock_guard<std::mutex> lock(graph._mutex);
+            if (graph.IsReady()) {
+                stats += graph.GetShapesPlanCacheStatistics();
+            }
+        }
+        return decltype(ov::intel_cpu::shapes_plan_cache_statistics)::value_type{{"HITS", stats.hits},
+                                                                                 {"MISSES", stats.misses},
+                                                                                 {"EVICTIONS", stats.evictions}};
+    }
+
+    if (name == ov::intel_cpu::latency_percentiles) {
+        std::map<std::string, LatencyHistogram> histograms;
+        for (auto&& graph : m_graphs) {
+            std::lock_guard<std::mutex> lock(graph._mutex);
+            if (graph.IsReady()) {
+                graph.GetLatencyHistograms(histograms);
+            }
+        }
+        decltype(ov::intel_cpu::latency_percentiles)::value_type percentiles;
+        for (const auto& [nodeName, histogram] : histograms) {
+            percentiles[nodeName + "/P50"] = histogram.percentile(50.0);
+            percentiles[nodeName + "/P90"] = histogram.percentile(90.0);
+            percentiles[nodeName + "/P99"] = histogram.percentile(99.0);
+            percentiles[nodeName + "/MAX"] = histogram.max();
+            percentiles[nodeName + "/COUNT"] = histogram.count();
+        }
+        return percentiles;
+    }
+
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
@@ -315,6 +447,12 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         const bool perfCount = config.collectPerfCounters;
         return static_cast<decltype(ov::enable_profiling)::value_type>(perfCount);
     }
+    if (name == ov::intel_cpu::memory_solver_mode) {
+        return decltype(ov::intel_cpu::memory_solver_mode)::value_type(config.memorySolverMode);
+    }
+    if (name == ov::intel_cpu::latency_histograms) {
+        return static_cast<decltype(ov::intel_cpu::latency_histograms)::value_type>(config.collectLatencyHistograms);
+    }
     if (name == ov::hint::inference_precision) {
         return decltype(ov::hint::inference_precision)::value_type(config.inferencePrecision);
     }
@@ -383,21 +521,64 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
+void CompiledModel::set_property(const ov::AnyMap& properties) {
+    // restarting the latency measurement window is the only change allowed after the compilation
+    for (const auto& [name, value] : properties) {
+        if (name != ov::intel_cpu::latency_histograms.name() || !m_cfg.collectLatencyHistograms || !value.as<bool>()) {
+            OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
+                                           "Set property to Core::compile_model during compilation");
+        }
+    }
+    if (properties.empty()) {
+        return;
+    }
+    for (auto&& graph : m_graphs) {
+        std::lock_guard<std::mutex> lock(graph._mutex);
+        if (graph.IsReady()) {
+            graph.ResetPerfData();
+        }
+    }
+}
+
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt);
+    ModelSerializer serializer(modelStream,
+                               m_cfg.cacheEncrypt,
+                               m_cfg.cacheRepackedWeights ? m_socketWeights[0] : nullptr);
     serializer << m_model;
 }
 
 void CompiledModel::release_memory() {
+    OPENVINO_ASSERT(try_release_memory(),
+                    "Attempt to call release_memory() on a compiled model in a busy state. Please ensure that all "
+                    "infer requests are completed before releasing memory.");
+}
+
+bool CompiledModel::try_release_memory() {
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(m_graphs.size());
     for (auto&& graph : m_graphs) {
         // try to lock mutex, since it may be already locked (e.g by an infer request)
-        std::unique_lock<std::mutex> lock(graph._mutex, std::try_to_lock);
-        OPENVINO_ASSERT(lock.owns_lock(),
-                        "Attempt to call release_memory() on a compiled model in a busy state. Please ensure that all "
-                        "infer requests are completed before releasing memory.");
-        auto ctx = graph.getGraphContext();
-        ctx->releaseMemory();
+        locks.emplace_back(graph._mutex, std::try_to_lock);
+        if (!locks.back().owns_lock()) {
+            return false;
+        }
+    }
+    for (auto&& graph : m_graphs) {
+        // the memory is allocated again by the next inference
+        if (graph.IsReady()) {
+            graph.getGraphContext()->releaseMemory();
+        }
+    }
+    std::lock_guard<std::mutex> lock{*m_mutex};
+    if (m_sharedRtParamsCache) {
+        m_sharedRtParamsCache->clear();
+    }
+    for (const auto& cache : m_rtParamsCaches) {
+        if (cache) {
+            cache->clear();
+        }
     }
+    return true;
 }
 
 }  // namespace ov::intel_cpu
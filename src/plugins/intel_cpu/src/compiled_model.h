@@ -15,6 +15,8 @@
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "sub_memory_manager.hpp"
+#include "utils/idle_watchdog.hpp"
+#include "utils/serialize.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -36,7 +38,9 @@ public:
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   Config cfg,
                   const bool loaded_from_cache,
-                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                  WeightsRetention::Ticket weights_ticket = {},
+                  const RepackedWeights::Ptr& repacked_weights = nullptr);
 
     ~CompiledModel();
 
@@ -48,10 +52,7 @@ public:
 
     ov::Any get_property(const std::string& name) const override;
 
-    void set_property(const ov::AnyMap& properties) override {
-        OPENVINO_THROW_NOT_IMPLEMENTED("It's not possible to set property of an already compiled model. "
-                                       "Set property to Core::compile_model during compilation");
-    };
+    void set_property(const ov::AnyMap& properties) override;
 
     void release_memory() override;
 
@@ -63,6 +64,9 @@ private:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     friend class CompiledModelHolder;
 
+    // releases the intermediate memory and the runtime parameters caches, returns false if any graph is busy
+    bool try_release_memory();
+
     const std::shared_ptr<ov::Model> m_model;
     const std::shared_ptr<const ov::IPlugin> m_plugin;
     std::shared_ptr<ov::threading::ITaskExecutor> m_task_executor = nullptr;      //!< Holds a task executor
@@ -79,6 +83,13 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // hands the weights caches over to the plugin wide store on release, if set
+    WeightsRetention::Ticket m_weightsTicket;
+    // runtime parameters cache shared between the streams, if enabled
+    MultiCachePtr m_sharedRtParamsCache;
+    // runtime parameters caches of the streams, one slot per graph which is set once the graph is ready, guarded by
+    // m_mutex
+    mutable std::vector<MultiCachePtr> m_rtParamsCaches;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -93,6 +104,8 @@ private:
     std::vector<std::shared_ptr<CompiledModel>> m_sub_compiled_models;
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
     bool m_has_sub_compiled_models = false;
+    // releases the memory after ov::intel_cpu::idle_memory_release_timeout without inferences, if the timeout is set
+    std::unique_ptr<IdleWatchdog> m_idleWatchdog;
 };
 
 // This class provides safe access to the internal CompiledModel structures and helps to decouple SyncInferRequest and
@@ -143,6 +156,20 @@ public:
         return m_id;
     }
 
+    // holds the idle memory release countdown of the compiled model while the inference runs
+    void notify_infer_start() {
+        if (m_compiled_model->m_idleWatchdog) {
+            m_compiled_model->m_idleWatchdog->begin();
+        }
+    }
+
+    // restarts the idle memory release countdown of the compiled model
+    void notify_infer_done() {
+        if (m_compiled_model->m_idleWatchdog) {
+            m_compiled_model->m_idleWatchdog->end();
+        }
+    }
+
 private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
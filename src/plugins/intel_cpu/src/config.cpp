@@ -269,6 +269,26 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_shared.name() == key) {
+            try {
+                rtCacheShared = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_shared.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::latency_histograms.name() == key) {
+            try {
+                collectLatencyHistograms = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::latency_histograms.name(),
+                               ". Expected only true/false");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -422,6 +442,98 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
                                ov::intel_cpu::value_cache_quant_mode.name(),
                                ". Expected AUTO/BY_CHANNEL/BY_HIDDEN");
             }
+        } else if (key == ov::intel_cpu::kv_cache_paged_block_size.name()) {
+            try {
+                kvCachePagedBlockSize = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_paged_block_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::shared_activation_memory.name()) {
+            try {
+                sharedActivationMemory = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::shared_activation_memory.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::snippets_shared_code_cache.name()) {
+            try {
+                snippetsSharedCodeCache = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::snippets_shared_code_cache.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::snippets_brgemm_tuning.name()) {
+            try {
+                snippetsBrgemmTuning = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::snippets_brgemm_tuning.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::snippets_brgemm_tuning_file.name()) {
+            snippetsBrgemmTuningFile = val.as<std::string>();
+        } else if (key == ov::intel_cpu::idle_memory_release_timeout.name()) {
+            try {
+                idleMemoryReleaseTimeout = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::idle_memory_release_timeout.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::weights_cache_budget.name()) {
+            try {
+                weightsCacheBudget = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::weights_cache_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::cache_repacked_weights.name()) {
+            try {
+                cacheRepackedWeights = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cache_repacked_weights.name(),
+                               ". Expected only true/false");
+            }
+        } else if (key == ov::intel_cpu::shapes_plan_cache_capacity.name()) {
+            try {
+                shapesPlanCacheCapacity = val.as<uint64_t>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::shapes_plan_cache_capacity.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::memory_solver_mode.name()) {
+            try {
+                memorySolverMode = val.as<ov::intel_cpu::MemorySolverMode>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::memory_solver_mode.name(),
+                               ". Expected GREEDY/BEST_FIT/BEST_FIT_REFINED");
+            }
         } else if (key == ov::cache_encryption_callbacks.name()) {
             try {
                 const auto& encryption_callbacks = val.as<EncryptionCallbacks>();
@@ -499,6 +611,11 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
 
     this->modelType = modelType;
 
+    // histograms are collected together with the regular profiling counters
+    if (collectLatencyHistograms) {
+        collectPerfCounters = true;
+    }
+
     CPU_DEBUG_CAP_ENABLE(applyDebugCapsProperties());
     updateProperties();
 }
@@ -46,6 +46,7 @@ struct Config {
     enum class ModelType { CNN, LLM, Unknown };
 
     bool collectPerfCounters = false;
+    bool collectLatencyHistograms = false;
     bool exclusiveAsyncRequests = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot = {};
@@ -73,10 +74,23 @@ struct Config {
     // TODO: Executor cache may leads to incorrect behavior on oneDNN ACL primitives
     size_t rtCacheCapacity = 0ul;
 #endif
+    bool rtCacheShared = false;
     size_t keyCacheGroupSize = 0ul;
     size_t valueCacheGroupSize = 0ul;
     CacheQuantMode keyCacheQuantMode = CacheQuantMode::AUTO;
     CacheQuantMode valueCacheQuantMode = CacheQuantMode::AUTO;
+    size_t kvCachePagedBlockSize = 0ul;
+    ov::intel_cpu::MemorySolverMode memorySolverMode = ov::intel_cpu::MemorySolverMode::GREEDY;
+    bool sharedActivationMemory = false;
+    bool snippetsSharedCodeCache = false;
+    // the cache directory of the device, where the code of snippetsSharedCodeCache is persisted, it's not a property
+    std::string snippetsCodeCacheDir = {};
+    bool snippetsBrgemmTuning = false;
+    std::string snippetsBrgemmTuningFile = {};
+    uint64_t idleMemoryReleaseTimeout = 0ul;
+    uint64_t weightsCacheBudget = 0ul;
+    bool cacheRepackedWeights = false;
+    uint64_t shapesPlanCacheCapacity = 16ul;
     ov::threading::IStreamsExecutor::Config streamExecutorConfig;
     int streams = 1;
     bool streamsChanged = false;
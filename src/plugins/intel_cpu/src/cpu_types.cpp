@@ -256,6 +256,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"RoPE", Type::RoPE},
         {"GatherCompressed", Type::Gather},
         {"CausalMaskPreprocess", Type::CausalMaskPreprocess},
+        {"LLMSampling", Type::LLMSampling},
         {"EmbeddingBagPacked", Type::EmbeddingBagPacked},
         {"EmbeddingBagOffsets", Type::EmbeddingBagOffsets},
         {"LLMMLP", Type::LLMMLP},
@@ -389,6 +390,7 @@ std::string NameFromType(const Type type) {
         CASE(PagedAttention);
         CASE(RoPE);
         CASE(CausalMaskPreprocess);
+        CASE(LLMSampling);
         CASE(LLMMLP);
         CASE(QKVProjection);
         CASE(RMS);
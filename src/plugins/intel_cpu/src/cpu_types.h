@@ -130,6 +130,7 @@ enum class Type {
     PagedAttention,
     RoPE,
     CausalMaskPreprocess,
+    LLMSampling,
     LLMMLP,
     QKVProjection,
     RMS,
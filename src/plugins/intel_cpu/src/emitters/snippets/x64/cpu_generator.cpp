@@ -4,7 +4,11 @@
 
 #include "cpu_generator.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <map>
 #include <memory>
+#include <vector>
 
 #include "emitters/plugin/x64/jit_conversion_emitters.hpp"
 #include "emitters/plugin/x64/jit_dnnl_ext_emitters.hpp"
@@ -161,6 +165,89 @@ public:
     void generate() override {}
 };
 
+namespace {
+// Sanity limit of the size of the code read by CompiledSnippetCPU::read()
+constexpr size_t MAX_SNIPPET_CODE_SIZE = size_t(1) << 30;
+
+// The absolute addresses of the code are kept as the map from their offsets in the code to the offsets they point to
+using CodeRelocations = std::map<size_t, size_t>;
+
+// The addresses don't overlap and don't point inside each other, so the code can be replayed with the labels
+bool is_valid(const CodeRelocations& relocations, size_t code_size) {
+    size_t end = 0;
+    for (const auto& [offset, target] : relocations) {
+        if (offset < end || code_size < sizeof(uint64_t) || offset > code_size - sizeof(uint64_t) ||
+            target > code_size) {
+            return false;
+        }
+        end = offset + sizeof(uint64_t);
+    }
+    return std::all_of(relocations.begin(), relocations.end(), [&relocations](const auto& relocation) {
+        auto site = relocations.upper_bound(relocation.second);
+        return site == relocations.begin() || relocation.second >= std::prev(site)->first + sizeof(uint64_t) ||
+               relocation.second == std::prev(site)->first;
+    });
+}
+
+void write_size(std::ostream& stream, size_t value) {
+    const auto data = static_cast<uint64_t>(value);
+    stream.write(reinterpret_cast<const char*>(&data), sizeof(data));
+}
+
+bool read_size(std::istream& stream, size_t& value) {
+    uint64_t data = 0;
+    stream.read(reinterpret_cast<char*>(&data), sizeof(data));
+    value = static_cast<size_t>(data);
+    return static_cast<bool>(stream);
+}
+}  // namespace
+
+// Replays the code written by CompiledSnippetCPU::write(), its absolute addresses are emitted as the addresses of the
+// labels, which are bound to the new location of the code when it's ready
+class jit_snippet_binary : public dnnl::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet_binary)
+
+    ~jit_snippet_binary() override = default;
+
+    jit_snippet_binary(std::vector<uint8_t> code, CodeRelocations relocations)
+        : jit_generator(jit_name()),
+          code(std::move(code)),
+          relocations(std::move(relocations)) {}
+
+    void generate() override {
+        std::map<size_t, Xbyak::Label> targets;
+        for (const auto& relocation : relocations) {
+            targets[relocation.second];
+        }
+        auto target = targets.begin();
+        auto site = relocations.begin();
+        size_t offset = 0;
+        while (offset < code.size()) {
+            if (target != targets.end() && target->first == offset) {
+                L(target->second);
+                target++;
+            }
+            if (site != relocations.end() && site->first == offset) {
+                putL(targets[site->second]);
+                offset += sizeof(uint64_t);
+                site++;
+            } else {
+                db(code[offset]);
+                offset++;
+            }
+        }
+        // the address of the end of the code
+        if (target != targets.end()) {
+            L(target->second);
+        }
+    }
+
+private:
+    const std::vector<uint8_t> code;
+    const CodeRelocations relocations;
+};
+
 intel_cpu::CPUTargetMachine::CPUTargetMachine(dnnl::impl::cpu::x64::cpu_isa_t host_isa,
                                               ov::intel_cpu::MultiCacheWeakPtr cache)
     : TargetMachine(std::make_shared<CPURuntimeConfigurator>(cache)),
@@ -418,6 +505,77 @@ bool intel_cpu::CompiledSnippetCPU::empty() const {
     return get_code_size() == 0;
 }
 
+bool intel_cpu::CompiledSnippetCPU::write(std::ostream& stream) const {
+    const uint8_t* code = get_code();
+    const size_t size = get_code_size();
+    // The functions out of the code are called by the absolute addresses kept in the registers or in the memory, i.e.
+    // by the indirect near or far call: FF /2 or FF /3. The bytes of the other instructions can look the same, such
+    // code isn't written either.
+    for (size_t offset = 0; offset + 1 < size; offset++) {
+        const auto reg = (code[offset + 1] >> 3) & 7;
+        if (code[offset] == 0xFF && (reg == 2 || reg == 3)) {
+            return false;
+        }
+    }
+    // The code refers to its constant tables by 64-bit absolute addresses, as the addresses don't fit into 32 bits.
+    // The 64-bit values pointing into the code are taken as such addresses.
+    const auto base = reinterpret_cast<uintptr_t>(code);
+    CodeRelocations relocations;
+    for (size_t offset = 0; offset + sizeof(uint64_t) <= size;) {
+        uint64_t value = 0;
+        std::memcpy(&value, code + offset, sizeof(value));
+        if (value >= base && value <= base + size) {
+            relocations[offset] = static_cast<size_t>(value - base);
+            offset += sizeof(value);
+        } else {
+            offset++;
+        }
+    }
+    if (!is_valid(relocations, size)) {
+        return false;
+    }
+
+    write_size(stream, size);
+    stream.write(reinterpret_cast<const char*>(code), static_cast<std::streamsize>(size));
+    write_size(stream, relocations.size());
+    for (const auto& [offset, target] : relocations) {
+        write_size(stream, offset);
+        write_size(stream, target);
+    }
+    return true;
+}
+
+std::shared_ptr<intel_cpu::CompiledSnippetCPU> intel_cpu::CompiledSnippetCPU::read(std::istream& stream) {
+    size_t size = 0;
+    if (!read_size(stream, size) || size == 0 || size > MAX_SNIPPET_CODE_SIZE) {
+        return nullptr;
+    }
+    std::vector<uint8_t> code(size);
+    stream.read(reinterpret_cast<char*>(code.data()), static_cast<std::streamsize>(size));
+    size_t count = 0;
+    if (!stream || !read_size(stream, count) || count > size / sizeof(uint64_t)) {
+        return nullptr;
+    }
+    CodeRelocations relocations;
+    for (size_t i = 0; i < count; i++) {
+        size_t offset = 0;
+        size_t target = 0;
+        if (!read_size(stream, offset) || !read_size(stream, target)) {
+            return nullptr;
+        }
+        relocations[offset] = target;
+    }
+    if (relocations.size() != count || !is_valid(relocations, size)) {
+        return nullptr;
+    }
+
+    auto h = std::make_unique<jit_snippet_binary>(std::move(code), std::move(relocations));
+    if (h->create_kernel() != dnnl::impl::status::success) {
+        return nullptr;
+    }
+    return std::make_shared<CompiledSnippetCPU>(std::unique_ptr<dnnl::impl::cpu::x64::jit_generator>(h.release()));
+}
+
 intel_cpu::CPUGenerator::CPUGenerator(dnnl::impl::cpu::x64::cpu_isa_t isa_, ov::intel_cpu::MultiCacheWeakPtr cache)
     : Generator(std::make_shared<CPUTargetMachine>(isa_, std::move(cache))) {}
 intel_cpu::CPUGenerator::CPUGenerator(const std::shared_ptr<CPUTargetMachine>& target) : Generator(target) {}
@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <istream>
+#include <ostream>
+
 #include "cache/multi_cache.h"
 #include "cpu/x64/jit_generator.hpp"
 #include "emitters/snippets/jit_snippets_call_args.hpp"
@@ -25,6 +28,20 @@ public:
     [[nodiscard]] size_t get_code_size() const override;
     [[nodiscard]] bool empty() const override;
     explicit CompiledSnippetCPU(std::unique_ptr<dnnl::impl::cpu::x64::jit_generator> h);
+
+    /**
+     * @brief Writes the code, so it can be loaded by another process with read(). Only the code which doesn't refer to
+     * anything out of itself can be written: its absolute addresses are the addresses of its own constant tables, which
+     * are written as offsets and bound to the new location on read. The code calling functions, e.g. the Brgemm
+     * kernels or the math library, isn't written.
+     * @return false if the code can't be written, nothing is written to the stream then
+     */
+    bool write(std::ostream& stream) const;
+    /**
+     * @brief Loads the code written by write()
+     * @return nullptr if the stream doesn't contain the code written by write()
+     */
+    static std::shared_ptr<CompiledSnippetCPU> read(std::istream& stream);
 };
 
 class CPUTargetMachine : public snippets::TargetMachine {
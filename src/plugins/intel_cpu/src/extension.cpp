@@ -21,6 +21,7 @@
 #include "snippets/op/subgraph.hpp"
 #include "transformations/cpu_opset/common/op/causal_mask_preprocess.hpp"
 #include "transformations/cpu_opset/common/op/leaky_relu.hpp"
+#include "transformations/cpu_opset/common/op/llm_sampling.hpp"
 #include "transformations/cpu_opset/common/op/ngram.hpp"
 #include "transformations/cpu_opset/common/op/power_static.hpp"
 #include "transformations/cpu_opset/common/op/read_value_with_subgraph.hpp"
@@ -84,6 +85,7 @@ OPENVINO_CREATE_EXTENSIONS(std::vector<ov::Extension::Ptr>({
     std::make_shared<ov::OpExtension<ov::intel_cpu::LeakyReluNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::PowerStaticNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::CausalMaskPreprocessNode>>(),
+    std::make_shared<ov::OpExtension<ov::intel_cpu::LLMSamplingNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::SwishNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::SDPAWithTransposeReshape>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::NgramNode>>(),
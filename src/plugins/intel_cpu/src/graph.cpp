@@ -26,6 +26,7 @@
 #include "graph_context.h"
 #include "graph_dumper.h"
 #include "graph_optimizer.h"
+#include "hash_builder.hpp"
 #include "infer_request.h"
 #include "itt.h"
 #include "memory_control.hpp"
@@ -359,6 +360,12 @@ void Graph::Activate() {
 
     CreatePrimitivesAndExecConstants();
 
+    if (getConfig().collectLatencyHistograms) {
+        for (auto& graphNode : graphNodes) {
+            graphNode->PerfCounter().enable_histogram();
+        }
+    }
+
 #ifndef CPU_DEBUG_CAPS
     for (auto& graphNode : graphNodes) {
         graphNode->cleanup();
@@ -879,10 +886,67 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
     } else {
         status = Status::ReadyStatic;
     }
+    InitShapesPlanCache();
 
     return syncNodesInds;
 }
 
+size_t Graph::InputShapesKey::hash() const {
+    size_t seed = 0;
+    for (const auto& item : dims) {
+        seed = hash::combine(seed, item);
+    }
+    return seed;
+}
+
+bool Graph::InputShapesKey::operator==(const InputShapesKey& rhs) const {
+    return dims == rhs.dims;
+}
+
+void Graph::InitShapesPlanCache() {
+    m_shapesPlanCache.reset();
+    const auto capacity = getConfig().shapesPlanCacheCapacity;
+    if (!IsDynamic() || capacity == 0) {
+        return;
+    }
+    // the shapes of the state are not a part of the key
+    const bool hasState = std::any_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->getType() == Type::MemoryInput;
+    });
+    const bool definedByInputs =
+        std::all_of(m_executableGraphNodes.begin(), m_executableGraphNodes.end(), [](const NodePtr& node) {
+            return !node->isDynamicNode() || node->outputShapesDefinedByInputShapes();
+        });
+    if (!hasState && definedByInputs) {
+        m_shapesPlanCache = std::make_unique<ShapesPlanCache>(capacity);
+    }
+}
+
+Graph::InputShapesKey Graph::GetInputShapesKey() const {
+    InputShapesKey key;
+    key.dims.reserve(inputNodesMap.size());
+    for (const auto& input : inputNodesMap) {
+        key.dims.push_back(input.second->getDstMemoryAtPort(0)->getShape().getDims());
+    }
+    return key;
+}
+
+std::shared_ptr<const Graph::ShapesPlan> Graph::MakeShapesPlan() const {
+    auto plan = std::make_shared<ShapesPlan>(m_executableGraphNodes.size());
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        const auto& node = m_executableGraphNodes[i];
+        if (!node->isDynamicNode()) {
+            continue;
+        }
+        auto dims = node->getOutputMemoryDims();
+        if (!dims) {
+            return nullptr;
+        }
+        (*plan)[i] = std::move(*dims);
+    }
+    return plan;
+}
+
 static void ResolveInOutInPlaceEdges(const std::vector<EdgePtr>& edges) {
     for (const auto& edge : edges) {
         if (edge->getStatus() == Edge::Status::Uninitialized) {
@@ -1341,16 +1405,20 @@ void Graph::InferStatic(SyncInferRequest* request, int numaId) {
 
 namespace {
 
+// the output shapes of the executable nodes known in advance, nullptr if the shape inference is required
+using ShapesPlan = std::vector<std::vector<VectorDims>>;
+
 class UpdateNodesSeq {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, const ShapesPlan* plan = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_plan(plan) {}
 
     void operator()(size_t stopIndx) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                node->updateShapes(m_plan ? &(*m_plan)[prepareCounter] : nullptr);
                 node->updateDynamicParams();
             }
         }
@@ -1359,6 +1427,7 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    const ShapesPlan* m_plan;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1369,14 +1438,15 @@ using UpdateNodes = UpdateNodesSeq;
 
 class UpdateNodesBase {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, const ShapesPlan* plan = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_plan(plan) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    node->updateShapes(m_plan ? &(*m_plan)[i] : nullptr);
                 }
                 m_prepareCounter.store(i, std::memory_order_release);
             }
@@ -1409,6 +1479,7 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    const ShapesPlan* m_plan;
 };
 
 #    if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -1631,11 +1702,28 @@ void Graph::Infer(SyncInferRequest* request) {
 
     switch (status) {
     case Status::ReadyDynamic:
-        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
-        break;
-    case Status::ReadyDynamicSeq:
-        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
+    case Status::ReadyDynamicSeq: {
+        InputShapesKey key;
+        std::shared_ptr<const ShapesPlan> plan;
+        if (m_shapesPlanCache) {
+            key = GetInputShapesKey();
+            plan = m_shapesPlanCache->plans.get(key);
+            (plan ? m_shapesPlanCache->hits : m_shapesPlanCache->misses).fetch_add(1, std::memory_order_relaxed);
+        }
+        if (status == Status::ReadyDynamic) {
+            InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes, plan.get()));
+        } else {
+            InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes, plan.get()));
+        }
+        if (m_shapesPlanCache && !plan) {
+            if (auto new_plan = MakeShapesPlan()) {
+                if (m_shapesPlanCache->plans.put(key, new_plan)) {
+                    m_shapesPlanCache->evictions.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
         break;
+    }
     case Status::ReadyStatic:
         InferStatic(request, numaId);
         break;
@@ -1748,6 +1836,31 @@ void Graph::GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
     }
 }
 
+void Graph::GetLatencyHistograms(std::map<std::string, LatencyHistogram>& histograms) const {
+    for (const auto& graphNode : graphNodes) {
+        const auto* histogram = graphNode->PerfCounter().histogram();
+        if (histogram && histogram->count() > 0) {
+            histograms[graphNode->getName()].merge(*histogram);
+        }
+    }
+}
+
+CacheStatistics Graph::GetShapesPlanCacheStatistics() const {
+    CacheStatistics stats;
+    if (m_shapesPlanCache) {
+        stats.hits = m_shapesPlanCache->hits.load(std::memory_order_relaxed);
+        stats.misses = m_shapesPlanCache->misses.load(std::memory_order_relaxed);
+        stats.evictions = m_shapesPlanCache->evictions.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void Graph::ResetPerfData() {
+    for (const auto& graphNode : graphNodes) {
+        graphNode->PerfCounter().reset();
+    }
+}
+
 void Graph::CreateEdge(const NodePtr& parent, const NodePtr& child, int parentPort, int childPort) {
     assert(parentPort >= 0 && childPort >= 0);
 
@@ -4,12 +4,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "cache/cache_entry.h"
+#include "cache/lru_cache.h"
 #include "config.h"
 #include "cpu_memory.h"
 #include "edge.h"
@@ -20,6 +23,7 @@
 #include "nodes/input.h"
 #include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/so_ptr.hpp"
+#include "perf_count.h"
 #include "proxy_mem_blk.h"
 
 namespace ov {
@@ -151,6 +155,11 @@ public:
     void assignStates(const std::vector<MemStatePtr>& state);
 
     void GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const;
+    // merges the latency histograms of the executed nodes into the map by the node name
+    void GetLatencyHistograms(std::map<std::string, LatencyHistogram>& histograms) const;
+    // lookups of the shapes plans cache by the inferences, all zeros if the graph doesn't use the cache
+    CacheStatistics GetShapesPlanCacheStatistics() const;
+    void ResetPerfData();
 
     void CreateEdge(const NodePtr& parent, const NodePtr& child, int parentPort = 0, int childPort = 0);
     void RemoveEdge(const EdgePtr& edge);
@@ -369,6 +378,34 @@ private:
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
 
+    // input shapes of the graph, the key of the shapes plans cache
+    struct InputShapesKey {
+        std::vector<VectorDims> dims;
+
+        size_t hash() const;
+        bool operator==(const InputShapesKey& rhs) const;
+    };
+    // output shapes of the executable nodes (empty for the static ones) for the given input shapes of the graph
+    using ShapesPlan = std::vector<std::vector<VectorDims>>;
+    struct ShapesPlanCache {
+        explicit ShapesPlanCache(size_t capacity) : plans(capacity) {}
+
+        LruCache<InputShapesKey, std::shared_ptr<const ShapesPlan>> plans;
+        // the counters are read by the compiled model while the stream infers
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> evictions{0};
+    };
+
+    // the shape inference of a dynamic graph is skipped for the input shapes seen recently, it's possible only if the
+    // output shapes of every node are defined by the input shapes of the graph. prepareParams() still runs for the
+    // nodes which input shapes differ from the previous inference, as their executors are not a part of the plan
+    void InitShapesPlanCache();
+    InputShapesKey GetInputShapesKey() const;
+    std::shared_ptr<const ShapesPlan> MakeShapesPlan() const;
+
+    std::unique_ptr<ShapesPlanCache> m_shapesPlanCache;
+
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
 };
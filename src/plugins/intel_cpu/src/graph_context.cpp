@@ -5,6 +5,7 @@
 
 #include <utility>
 
+#include "activation_mem_pool.h"
 #include "config.h"
 #include "memory_control.hpp"
 #include "nodes/memory.hpp"
@@ -15,16 +16,22 @@ GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           MultiCachePtr rtParamsCache)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
+      m_rtParamsCache(rtParamsCache ? std::move(rtParamsCache)
+                                    : std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
+      m_rtStreamParamsCache(m_rtParamsCache->isThreadSafe() ? std::make_shared<MultiCache>(m_config.rtCacheCapacity)
+                                                            : m_rtParamsCache),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_subMemoryManager(std::move(sub_memory_manager)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
+      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>(
+          m_config.memorySolverMode,
+          m_config.sharedActivationMemory ? ActivationMemoryPool::instance() : nullptr)),
       m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
@@ -31,7 +31,8 @@ public:
                  WeightsSharing::Ptr w_cache,
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 MultiCachePtr rtParamsCache = nullptr);
 
     const Config& getConfig() const {
         return m_config;
@@ -45,6 +46,11 @@ public:
         return m_rtParamsCache;
     }
 
+    // Cache of the objects which hold the mutable state of the stream (e.g. scratch buffers), never shared
+    MultiCachePtr getStreamParamsCache() const {
+        return m_rtStreamParamsCache;
+    }
+
     DnnlScratchPadPtr getScratchPad() const {
         return m_rtScratchPads[m_numaNodeId];
     }
@@ -87,12 +93,12 @@ public:
         m_auxiliaryNetworkMemoryControl->releaseMemory();
     }
 
+    void returnSharedMemory() const {
+        m_auxiliaryNetworkMemoryControl->returnSharedMemory();
+    }
+
     void allocateMemory() const {
-        for (const auto& controlUnit : m_auxiliaryNetworkMemoryControl->controlUnits()) {
-            if (!controlUnit->allocated()) {
-                controlUnit->allocateMemory();
-            }
-        }
+        m_auxiliaryNetworkMemoryControl->allocateMemory();
     }
 
 private:
@@ -100,8 +106,10 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
-    // primitive cache
+    // primitive cache, may be shared between the streams
     MultiCachePtr m_rtParamsCache;
+    // the same as m_rtParamsCache if it's not shared between the streams
+    MultiCachePtr m_rtStreamParamsCache;
     // global scratch pad
     DnnlScratchPadPtr m_rtScratchPad;
 
@@ -11,6 +11,7 @@
 #include "nodes/conv.h"
 #include "nodes/deconv.h"
 #include "nodes/eltwise.h"
+#include "nodes/embedding_bag.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/fullyconnected.h"
 #include "nodes/input.h"
@@ -37,8 +38,10 @@
 #    endif
 #endif
 #include <algorithm>
+#include <functional>
 #include <list>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <set>
 #include <string>
@@ -81,6 +84,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph& graph) {
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndTableDecompression");
+    FuseEmbeddingBagAndTableDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMultiplyAndAdd");
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
@@ -870,6 +877,152 @@ void GraphOptimizer::FuseFCAndConvertOnWeights(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndTableDecompression(Graph& graph) {
+    // This optimization fuses the decompression of the constant embedding table (Convert -> [Subtract] -> [Multiply])
+    // into the EmbeddingBag nodes, so the compressed rows are dequantized on the fly instead of keeping the whole
+    // table in f32
+
+    auto isSuitableEltwise = [](const NodePtr& node, Algorithm algorithm) {
+        return node->getType() == Type::Eltwise && node->getAlgorithm() == algorithm && node->isConstant() &&
+               node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+    auto isSuitableConvert = [](const NodePtr& node) {
+        return node->getType() == Type::Convert && node->isConstant() && node->getChildEdges().size() == 1 &&
+               one_of(node->getOriginalInputPrecisionAtPort(0),
+                      ov::element::f16,
+                      ov::element::bf16,
+                      ov::element::u8,
+                      ov::element::i8) &&
+               node->getOriginalOutputPrecisionAtPort(0) == ov::element::f32;
+    };
+    // Returns the port of Multiply the table comes to, the other port is the scale
+    auto getDataPort = [&](const NodePtr& multiply) -> std::optional<size_t> {
+        for (size_t port = 0; port < 2; port++) {
+            const auto parent = multiply->getParentEdgeAt(port)->getParent();
+            if ((isSuitableEltwise(parent, Algorithm::EltwiseSubtract) || isSuitableConvert(parent)) &&
+                parent->getOutputShapeAtPort(0) == multiply->getOutputShapeAtPort(0)) {
+                return port;
+            }
+        }
+        return std::nullopt;
+    };
+    // Reads the scale or the zero point, which is either a scalar or has one value per row of the table
+    auto getDecompressionValues = [](const NodePtr& node,
+                                     const VectorDims& tableDims) -> std::optional<std::vector<float>> {
+        auto constant = node;
+        if (constant->getType() == Type::Convert && constant->isConstant()) {
+            constant = constant->getParentEdgeAt(0)->getParent();
+        }
+        const auto input = std::dynamic_pointer_cast<node::Input>(constant);
+        if (!input || !input->isConstant() || node->getOutputShapeAtPort(0).isDynamic()) {
+            return std::nullopt;
+        }
+
+        const auto& dims = node->getOutputShapeAtPort(0).getStaticDims();
+        const auto size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<>());
+        const bool perRow = size == tableDims[0] && dims.size() == tableDims.size() && dims[0] == tableDims[0];
+        if (size != 1 && !perRow) {
+            return std::nullopt;
+        }
+
+        const auto memory = input->getMemoryPtr();
+        std::vector<float> values(size);
+        cpu_convert(memory->getData(), values.data(), memory->getDesc().getPrecision(), ov::element::f32, size);
+        return values;
+    };
+    std::function<void(const NodePtr&)> dropUnused = [&](const NodePtr& node) {
+        if (!node->getChildEdges().empty() || node->getType() == Type::Input) {
+            return;
+        }
+        std::vector<NodePtr> parents;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            parents.push_back(node->getParentEdgeAt(i)->getParent());
+        }
+        graph.DropNode(node);
+        for (const auto& parent : parents) {
+            dropUnused(parent);
+        }
+    };
+
+    auto& graphNodes = graph.GetNodes();
+    for (const auto& node : graphNodes) {
+        if (!one_of(node->getType(), Type::EmbeddingBagPacked, Type::EmbeddingBagOffsets, Type::EmbeddingSegmentsSum)) {
+            continue;
+        }
+        const auto embeddingBag = std::dynamic_pointer_cast<node::EmbeddingBag>(node);
+        if (!embeddingBag) {
+            continue;
+        }
+
+        NodePtr multiply = nullptr;
+        NodePtr subtract = nullptr;
+        auto parent = node->getParentEdgeAt(0)->getParent();
+        std::optional<size_t> dataPort;
+        if (isSuitableEltwise(parent, Algorithm::EltwiseMultiply)) {
+            multiply = parent;
+            dataPort = getDataPort(multiply);
+            if (!dataPort) {
+                continue;
+            }
+            parent = multiply->getParentEdgeAt(*dataPort)->getParent();
+        }
+        if (isSuitableEltwise(parent, Algorithm::EltwiseSubtract)) {
+            subtract = parent;
+            // The zero point is subtracted from the table, so the table has to be the first input
+            parent = subtract->getParentEdgeAt(0)->getParent();
+        }
+
+        const auto convert = parent;
+        if (!isSuitableConvert(convert)) {
+            continue;
+        }
+        const auto table = convert->getParentEdgeAt(0)->getParent();
+        const auto tablePrecision = convert->getOriginalInputPrecisionAtPort(0);
+        const auto& tableShape = convert->getInputShapeAtPort(0);
+        if (table->getType() != Type::Input || !table->isConstant() || tableShape.isDynamic()) {
+            continue;
+        }
+        const auto& tableDims = tableShape.getStaticDims();
+        // The eltwise operations must not broadcast the table
+        if ((multiply && multiply->getOutputShapeAtPort(0) != tableShape) ||
+            (subtract && subtract->getOutputShapeAtPort(0) != tableShape)) {
+            continue;
+        }
+
+        const bool isIntegerTable = one_of(tablePrecision, ov::element::u8, ov::element::i8);
+        if (isIntegerTable != static_cast<bool>(multiply) || (!isIntegerTable && subtract)) {
+            continue;
+        }
+
+        std::optional<std::vector<float>> scale;
+        std::optional<std::vector<float>> zeroPoint = std::vector<float>{};
+        if (multiply) {
+            scale = getDecompressionValues(multiply->getParentEdgeAt(1 - *dataPort)->getParent(), tableDims);
+        }
+        if (subtract) {
+            zeroPoint = getDecompressionValues(subtract->getParentEdgeAt(1)->getParent(), tableDims);
+        }
+        if ((multiply && !scale) || !zeroPoint) {
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndTableDecompression);
+
+        if (scale) {
+            embeddingBag->fuseTableDecompression(std::move(*scale), std::move(*zeroPoint));
+        }
+        node->setOriginalInputPrecisionAtPort(0, tablePrecision);
+
+        const auto tableEdge = node->getParentEdgeAt(0);
+        const auto inNum = convert->getParentEdgeAt(0)->getInputNum();
+        const auto outNum = tableEdge->getOutputNum();
+        const auto decompression = tableEdge->getParent();
+        graph.RemoveEdge(tableEdge);
+        graph.CreateEdge(table, node, inNum, outNum);
+        dropUnused(decompression);
+    }
+}
+
 void GraphOptimizer::FuseFCAndTransposeOnWeights(Graph& graph) {
 #if defined(OV_CPU_WITH_SHL)
     return;
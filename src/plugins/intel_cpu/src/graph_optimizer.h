@@ -26,6 +26,7 @@ private:
     void MergeEltwiseAndConvert(Graph& graph);
     void MergeConvertAndEltwise(Graph& graph);
     void FuseFCAndConvertOnWeights(Graph& graph);
+    void FuseEmbeddingBagAndTableDecompression(Graph& graph);
     void FuseFCAndTransposeOnWeights(Graph& graph);
     void FuseFullyConnectedAndSimpleOperation(Graph& graph);
     void FuseMatMulAndSimpleOperation(Graph& graph);
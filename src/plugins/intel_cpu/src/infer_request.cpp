@@ -80,6 +80,25 @@ void SyncInferRequest::infer() {
     auto&& graph = graphLock._graph;
     auto message = ov::threading::message_manager();
 
+    // the memory leased from the shared pool is given back as soon as the inference is over, also when it has failed
+    struct SharedMemoryLease {
+        ~SharedMemoryLease() {
+            context->returnSharedMemory();
+        }
+        GraphContext::CPtr context;
+    } sharedMemoryLease{graph.getGraphContext()};
+
+    // the idle countdown is held while the inference runs and restarts once it's over, also when it has failed
+    struct InferActivity {
+        explicit InferActivity(CompiledModelHolder& compiledModel) : compiledModel(compiledModel) {
+            compiledModel.notify_infer_start();
+        }
+        ~InferActivity() {
+            compiledModel.notify_infer_done();
+        }
+        CompiledModelHolder& compiledModel;
+    } inferActivity{m_compiled_model};
+
     throw_if_canceled();
     if (m_asyncRequest->m_has_sub_infers) {
         sub_streams_infer();
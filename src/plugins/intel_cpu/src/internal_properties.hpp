@@ -15,6 +15,34 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines whether all streams of a compiled model share one thread safe CPU runtime parameters cache instead of
+ * keeping a cache per stream. With the shared cache primitives and executors built for a dynamic shape by one stream
+ * are reused by the others.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_runtime_cache_shared{"CPU_RUNTIME_CACHE_SHARED"};
+
+/**
+ * @brief Read-only lookup counters of the CPU runtime parameters cache of a compiled model accumulated over all the
+ * streams: "HITS", "MISSES" and "EVICTIONS".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Enables per node latency histograms at nanosecond resolution, implies ov::enable_profiling. Setting the
+ * property to true on a compiled model clears the collected histograms and profiling counters to start a new
+ * measurement window.
+ */
+static constexpr Property<bool, PropertyMutability::RW> latency_histograms{"CPU_LATENCY_HISTOGRAMS"};
+
+/**
+ * @brief Read-only per node latency percentiles in nanoseconds accumulated over all the streams of a compiled model.
+ * The keys are "<node name>/P50", "<node name>/P90", "<node name>/P99", "<node name>/MAX" and "<node name>/COUNT".
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> latency_percentiles{
+    "CPU_LATENCY_PERCENTILES"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -62,6 +90,162 @@ inline std::istream& operator>>(std::istream& is, SnippetsMode& mode) {
  */
 static constexpr Property<SnippetsMode, PropertyMutability::RW> snippets_mode{"SNIPPETS_MODE"};
 
+/**
+ * @brief Enum to define the algorithms packing the intermediate tensors of static shapes into a single memory arena.
+ */
+enum class MemorySolverMode {
+    GREEDY = 0,            //!<  Biggest tensors first, every tensor at the lowest free offset
+    BEST_FIT = 1,          //!<  Biggest tensors first, every tensor into the smallest gap where it fits
+    BEST_FIT_REFINED = 2,  //!<  Best of several placement orders improved by moving the tensors to lower gaps
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const MemorySolverMode& mode) {
+    switch (mode) {
+    case MemorySolverMode::GREEDY:
+        return os << "GREEDY";
+    case MemorySolverMode::BEST_FIT:
+        return os << "BEST_FIT";
+    case MemorySolverMode::BEST_FIT_REFINED:
+        return os << "BEST_FIT_REFINED";
+    default:
+        OPENVINO_THROW("Unsupported memory solver mode value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, MemorySolverMode& mode) {
+    std::string str;
+    is >> str;
+    if (str == "GREEDY") {
+        mode = MemorySolverMode::GREEDY;
+    } else if (str == "BEST_FIT") {
+        mode = MemorySolverMode::BEST_FIT;
+    } else if (str == "BEST_FIT_REFINED") {
+        mode = MemorySolverMode::BEST_FIT_REFINED;
+    } else {
+        OPENVINO_THROW("Unsupported memory solver mode: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Define the algorithm packing the intermediate tensors of static shapes into a single memory arena.
+ * @param GREEDY - default, the fastest one
+ * @param BEST_FIT - usually gives a smaller arena for the models with many tensors of different sizes
+ * @param BEST_FIT_REFINED - the smallest arena of the three for the price of several times longer planning
+ */
+static constexpr Property<MemorySolverMode, PropertyMutability::RW> memory_solver_mode{"CPU_MEMORY_SOLVER_MODE"};
+
+/**
+ * @brief Read-only footprint of the memory arena planned for the intermediate tensors of static shapes in bytes:
+ * "SOLVED_SIZE" - the size of the arena, "OPTIMAL_SIZE" - the maximal total size of the tensors alive at the same
+ * time, which is the lower bound for any solver.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> memory_solver_statistics{
+    "CPU_MEMORY_SOLVER_STATISTICS"};
+
+/**
+ * @brief Defines whether the memory for the intermediate tensors of static shapes is leased from a process wide pool
+ * for the time of an inference instead of being owned by the compiled model. With many compiled models loaded and only
+ * a few of them running at a time the resident memory follows the number of the concurrent inferences.
+ */
+static constexpr Property<bool, PropertyMutability::RW> shared_activation_memory{"CPU_SHARED_ACTIVATION_MEMORY"};
+
+/**
+ * @brief Defines whether the code generated for the Snippets subgraphs of static shapes is kept in a process wide cache
+ * and reused by the other compiled models with the same subgraphs, shapes and precisions instead of being generated
+ * again for each of them. With ov::cache_dir set for the device, the code which doesn't call other kernels is also kept
+ * in that directory and read by the other processes.
+ */
+static constexpr Property<bool, PropertyMutability::RW> snippets_shared_code_cache{"CPU_SNIPPETS_SHARED_CODE_CACHE"};
+
+/**
+ * @brief Read-only lookup counters of the process wide cache of ov::intel_cpu::snippets_shared_code_cache: "HITS" - the
+ * code taken by a compiled model from the cache, "MISSES" - the code generated, "EVICTIONS" - the code dropped from the
+ * cache, which keeps a fixed number of the latest used subgraphs.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO>
+    snippets_shared_code_cache_statistics{"CPU_SNIPPETS_SHARED_CODE_CACHE_STATISTICS"};
+
+/**
+ * @brief Defines whether the blocking parameters of the static f32 Brgemms in the Snippets subgraphs are selected by
+ * timing a small set of candidates on the target machine at compile time instead of the fixed heuristic. The winners
+ * are kept in a process wide table keyed by the shape, precision and ISA.
+ */
+static constexpr Property<bool, PropertyMutability::RW> snippets_brgemm_tuning{"CPU_SNIPPETS_BRGEMM_TUNING"};
+
+/**
+ * @brief Path to the file where the Brgemm blocking parameters tuned with ov::intel_cpu::snippets_brgemm_tuning are
+ * persisted and loaded from on the next compilations. Empty (default) keeps them in the process only.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> snippets_brgemm_tuning_file{
+    "CPU_SNIPPETS_BRGEMM_TUNING_FILE"};
+
+/**
+ * @brief Time in milliseconds after the last inference when the compiled model gives its intermediate memory and the
+ * runtime parameters caches back. The memory is allocated again on the next inference. 0 (default) keeps the memory
+ * until ov::CompiledModel::release_memory is called explicitly.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> idle_memory_release_timeout{
+    "CPU_IDLE_MEMORY_RELEASE_TIMEOUT"};
+
+/**
+ * @brief Read-only counters of the intermediate memory release: "RELEASES" - number of the releases, either explicit or
+ * on the idle timeout, "REALLOCATIONS" - number of the inferences which allocated the released memory again,
+ * "REALLOCATION_TIME_US" - total time spent on these allocations in microseconds.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> memory_release_statistics{
+    "CPU_MEMORY_RELEASE_STATISTICS"};
+
+/**
+ * @brief Plugin wide budget in bytes for the repacked weights. With a non-zero value the weights caches of a released
+ * compiled model are kept, and a compiled model of a model with the same content and properties takes them back
+ * instead of repacking the weights. The budget covers the weights of the live compiled models too, the least recently
+ * released caches are evicted to stay within it. 0 (default) frees the repacked weights with the compiled model.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> weights_cache_budget{"CPU_WEIGHTS_CACHE_BUDGET"};
+
+/**
+ * @brief Read-only statistics of the plugin wide store of the released weights caches: "BUDGET", "RETAINED_SIZE" and
+ * "LIVE_SIZE" (the weights of the live compiled models) in bytes, "RETAINED_MODELS" - number of the kept caches,
+ * "REUSES" - number of the caches taken back by compiled models, "EVICTIONS" - number of the dropped caches.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> retained_weights_statistics{
+    "CPU_RETAINED_WEIGHTS_STATISTICS"};
+
+/**
+ * @brief Read-only statistics of the weights cache of a compiled model summed over the sockets: "SIZE" - bytes of the
+ * cached weights in use, "OBJECTS" - number of them, "HITS" and "MISSES" - lookups of the cache, a miss means the
+ * weights were repacked.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> weights_cache_statistics{
+    "CPU_WEIGHTS_CACHE_STATISTICS"};
+
+/**
+ * @brief Stores the repacked weights of the compiled model in the exported blob, so the import uses them instead of
+ * repacking the weights again. The weights are used only on a machine with the same ISA, otherwise they are skipped.
+ * Makes the blob bigger by the size of the repacked weights. Default is false.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cache_repacked_weights{"CPU_CACHE_REPACKED_WEIGHTS"};
+
+/**
+ * @brief Number of the recent input shapes of a dynamic graph, for which the output shapes of the nodes are memorized.
+ * The shape inference is skipped for such input shapes. It's used only for the graphs which output shapes are
+ * defined by the input shapes, i.e. without data dependent shapes and states. 0 disables the memorization. Default
+ * is 16.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> shapes_plan_cache_capacity{
+    "CPU_SHAPES_PLAN_CACHE_CAPACITY"};
+
+/**
+ * @brief Read-only lookup counters of the shapes plans caches of a compiled model accumulated over all the streams:
+ * "HITS" - the inferences which skipped the shape inference, "MISSES" - the inferences which ran it, "EVICTIONS" - the
+ * plans dropped to keep ov::intel_cpu::shapes_plan_cache_capacity of them.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> shapes_plan_cache_statistics{
+    "CPU_SHAPES_PLAN_CACHE_STATISTICS"};
+
 /**
  * @brief Enum to define possible cache quant schema hints.
  */
@@ -117,4 +301,11 @@ static constexpr Property<CacheQuantMode, PropertyMutability::RW> key_cache_quan
  */
 static constexpr Property<CacheQuantMode, PropertyMutability::RW> value_cache_quant_mode{"VALUE_CACHE_QUANT_MODE"};
 
+/**
+ * @brief Number of tokens per block of the paged storage of the stateful KV cache. With a non-zero value the cache of
+ * ScaledDotProductAttention states grows block by block in place instead of being reallocated and copied, and the
+ * blocks are returned to the system on the state reset. 0 (default) keeps the cache in a single contiguous buffer.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> kv_cache_paged_block_size{"KV_CACHE_PAGED_BLOCK_SIZE"};
+
 }  // namespace ov::intel_cpu
@@ -4,11 +4,15 @@
 
 #include "memory_control.hpp"
 
+#include <chrono>
 #include <cstddef>
+#include <functional>
 #include <memory>
-#include <queue>
+#include <tuple>
 #include <utility>
 
+#include "activation_mem_pool.h"
+#include "best_fit_memory_solver.hpp"
 #include "openvino/runtime/memory_solver.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -50,7 +54,13 @@ private:
     ptrdiff_t m_offset = 0;
 };
 
-class MemoryBlockWithRelease : public IMemoryBlockObserver {
+// a memory block which memory can be freed without destroying the block, so the memory objects stay valid
+class IReleasableMemoryBlock : public IMemoryBlockObserver {
+public:
+    virtual void free() = 0;
+};
+
+class MemoryBlockWithRelease : public IReleasableMemoryBlock {
 public:
     MemoryBlockWithRelease() {
         auto pInternalMem = make_unique<MemoryBlockWithReuse>();
@@ -76,7 +86,7 @@ public:
     void unregisterMemory(Memory* memPtr) override {
         m_pBlock->unregisterMemory(memPtr);
     }
-    void free() {
+    void free() override {
         m_pInternalMem->free();
     }
 
@@ -89,6 +99,86 @@ private:
     MemoryBlockWithReuse* m_pInternalMem;
 };
 
+// The memory is leased from the process wide pool on resize and returned there on free
+class PooledMemoryBlock : public IMemoryBlock {
+public:
+    explicit PooledMemoryBlock(ActivationMemoryPool::Ptr pool) : m_pool(std::move(pool)) {
+        OPENVINO_ASSERT(m_pool, "Activation memory pool is uninitialized");
+    }
+    ~PooledMemoryBlock() override {
+        free();
+    }
+
+    [[nodiscard]] void* getRawPtr() const noexcept override {
+        return m_ptr;
+    }
+    void setExtBuff([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) override {
+        OPENVINO_THROW("Unexpected setExtBuff call to PooledMemoryBlock");
+    }
+    bool resize(size_t size) override {
+        if (size == 0 || (m_ptr && size <= m_size)) {
+            return false;
+        }
+        free();
+        std::tie(m_ptr, m_size) = m_pool->acquire(size);
+        // the memory objects still point to the previous lease, so they are updated only if the data has moved
+        const bool moved = m_ptr != m_lastPtr;
+        m_lastPtr = m_ptr;
+        return moved;
+    }
+    [[nodiscard]] bool hasExtBuffer() const noexcept override {
+        return false;
+    }
+    void free() {
+        if (m_ptr) {
+            m_pool->release(m_ptr);
+            m_ptr = nullptr;
+            m_size = 0;
+        }
+    }
+
+private:
+    ActivationMemoryPool::Ptr m_pool;
+    void* m_ptr = nullptr;
+    void* m_lastPtr = nullptr;
+    size_t m_size = 0;
+};
+
+class PooledMemoryBlockWithRelease : public IReleasableMemoryBlock {
+public:
+    explicit PooledMemoryBlockWithRelease(ActivationMemoryPool::Ptr pool) {
+        auto pInternalMem = make_unique<PooledMemoryBlock>(std::move(pool));
+        m_pInternalMem = pInternalMem.get();
+        m_pBlock = std::make_shared<DnnlMemoryBlock>(std::move(pInternalMem));
+    }
+
+    [[nodiscard]] void* getRawPtr() const noexcept override {
+        return m_pBlock->getRawPtr();
+    }
+    void setExtBuff(void* ptr, size_t size) override {
+        m_pBlock->setExtBuff(ptr, size);
+    }
+    bool resize(size_t size) override {
+        return m_pBlock->resize(size);
+    }
+    [[nodiscard]] bool hasExtBuffer() const noexcept override {
+        return m_pBlock->hasExtBuffer();
+    }
+    void registerMemory(Memory* memPtr) override {
+        m_pBlock->registerMemory(memPtr);
+    }
+    void unregisterMemory(Memory* memPtr) override {
+        m_pBlock->unregisterMemory(memPtr);
+    }
+    void free() override {
+        m_pInternalMem->free();
+    }
+
+private:
+    MemoryBlockPtr m_pBlock;
+    PooledMemoryBlock* m_pInternalMem;
+};
+
 #ifdef CPU_DEBUG_CAPS
 class IndividualMemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
@@ -142,6 +232,14 @@ public:
     virtual const MemoryControl::MemorySolution& lastSolution() = 0;
     virtual void allocate() = 0;
     virtual void release() = 0;
+    // returns the memory leased for the time of an inference, true if there was such memory
+    virtual bool returnSharedMemory() {
+        return false;
+    }
+    [[nodiscard]] virtual MemoryFootprint footprint() const {
+        // the memory is not planned in advance
+        return {};
+    }
 };
 
 using MemoryManagerPtr = std::shared_ptr<IMemoryManager>;
@@ -191,6 +289,10 @@ private:
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    MemoryManagerStatic(MemorySolverMode solverMode, ActivationMemoryPool::Ptr pool)
+        : m_pool(std::move(pool)),
+          m_solverMode(solverMode) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -213,18 +315,41 @@ private:
             box.size = div_up(box.size, alignment);
         });
 
-        ov::MemorySolver staticMemSolver(boxes_to_process);
-        m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+        std::function<int64_t(int64_t)> getOffset;
+        if (m_solverMode == MemorySolverMode::GREEDY) {
+            auto staticMemSolver = std::make_shared<ov::MemorySolver>(boxes_to_process);
+            m_totalSize = static_cast<size_t>(staticMemSolver->solve()) * alignment;
+            getOffset = [staticMemSolver](int64_t id) {
+                return staticMemSolver->get_offset(static_cast<int>(id));
+            };
+        } else {
+            auto staticMemSolver = std::make_shared<BestFitMemorySolver>(boxes_to_process);
+            m_totalSize =
+                static_cast<size_t>(staticMemSolver->solve(m_solverMode == MemorySolverMode::BEST_FIT_REFINED)) *
+                alignment;
+            getOffset = [staticMemSolver](int64_t id) {
+                return staticMemSolver->get_offset(id);
+            };
+        }
+        m_optimalSize = static_cast<size_t>(maxLiveSize(m_boxes));
 
-        m_workspace = std::make_shared<MemoryBlockWithRelease>();
+        if (m_pool) {
+            m_workspace = std::make_shared<PooledMemoryBlockWithRelease>(m_pool);
+        } else {
+            m_workspace = std::make_shared<MemoryBlockWithRelease>();
+        }
 
         for (const auto& box : boxes_to_process) {
-            int64_t offset = staticMemSolver.get_offset(box.id);
+            int64_t offset = getOffset(box.id);
             auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset * alignment);
             m_blocks[box.id] = std::move(memoryBlock);
         }
     }
 
+    [[nodiscard]] MemoryFootprint footprint() const override {
+        return {m_totalSize, m_optimalSize};
+    }
+
     void allocate() override {
         if (m_workspace) {
             m_workspace->resize(m_totalSize);
@@ -235,6 +360,13 @@ private:
             m_workspace->free();
         }
     }
+    bool returnSharedMemory() override {
+        if (!m_pool || !m_workspace) {
+            return false;
+        }
+        m_workspace->free();
+        return true;
+    }
 
     static const char* getClassName() {
         return "MemoryManagerStatic";
@@ -243,8 +375,11 @@ private:
 private:
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
-    std::shared_ptr<MemoryBlockWithRelease> m_workspace;
+    std::shared_ptr<IReleasableMemoryBlock> m_workspace;
+    ActivationMemoryPool::Ptr m_pool;  // the workspace is leased from the pool if set
+    MemorySolverMode m_solverMode;
     size_t m_totalSize = 0;
+    size_t m_optimalSize = 0;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
 };
@@ -346,31 +481,12 @@ private:
 };
 
 #ifdef CPU_DEBUG_CAPS
-std::pair<int64_t, int64_t> calculateOptimalMemorySize(std::vector<MemorySolver::Box> boxes) {
-    ov::MemorySolver::normalize_boxes(boxes);
-
-    auto boxCmp = [](const MemorySolver::Box& l, const MemorySolver::Box& r) {
-        return l.finish > r.finish;
-    };
-    std::priority_queue<MemorySolver::Box, std::vector<MemorySolver::Box>, decltype(boxCmp)> pq(boxCmp);
-
-    int64_t current_size = 0;
-    int64_t max_current_size = 0;
+std::pair<int64_t, int64_t> calculateOptimalMemorySize(const std::vector<MemorySolver::Box>& boxes) {
     int64_t max_box_size = 0;
-
     for (const auto& box : boxes) {
         max_box_size = std::max(max_box_size, box.size);
-        current_size += box.size;
-        while (!pq.empty() && pq.top().finish < box.start) {
-            auto&& retire_box = pq.top();
-            current_size -= retire_box.size;
-            pq.pop();
-        }
-        pq.push(box);
-        max_current_size = std::max(max_current_size, current_size);
     }
-
-    return {max_current_size, max_box_size};
+    return {maxLiveSize(boxes), max_box_size};
 }
 
 MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerIO& obj) {
@@ -437,7 +553,7 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets&
         box.size = block->size();
     }
 
-    auto result = calculateOptimalMemorySize(std::move(tmp_boxes));
+    auto result = calculateOptimalMemorySize(tmp_boxes);
     retVal.optimal_total_size = result.first;
     retVal.max_region_size = result.second;
     return retVal;
@@ -476,6 +592,14 @@ public:
         m_memManager->release();
     }
 
+    bool returnSharedMemory() {
+        return m_memManager->returnSharedMemory();
+    }
+
+    [[nodiscard]] MemoryFootprint footprint() const {
+        return m_memManager->footprint();
+    }
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] MemoryStatisticsRecord dumpStatistics() const {
         return m_statDumper(m_memManager);
@@ -515,15 +639,19 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, MemorySolverMode solverMode, std::shared_ptr<ActivationMemoryPool> pool)
+    : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        if (reg.size < 0 || MemoryRegion::RegionType::VARIABLE != reg.type ||
-            MemoryRegion::AllocType::POD != reg.alloc_type) {
-            return false;
-        }
-        return true;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            if (reg.size < 0 || MemoryRegion::RegionType::VARIABLE != reg.type ||
+                MemoryRegion::AllocType::POD != reg.alloc_type) {
+                return false;
+            }
+            return true;
+        },
+        solverMode,
+        std::move(pool)));
 
     // handler for static tensors
     m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
@@ -586,6 +714,25 @@ void MemoryControl::releaseMemory() {
     m_allocated = false;
 }
 
+void MemoryControl::returnSharedMemory() {
+    bool returned = false;
+    for (auto&& handler : m_handlers) {
+        returned = handler->returnSharedMemory() || returned;
+    }
+    if (returned) {
+        // the next inference leases the memory again
+        m_allocated = false;
+    }
+}
+
+MemoryFootprint MemoryControl::footprint() const {
+    MemoryFootprint retVal;
+    for (auto&& handler : m_handlers) {
+        retVal += handler->footprint();
+    }
+    return retVal;
+}
+
 #ifdef CPU_DEBUG_CAPS
 MemoryStatistics MemoryControl::dumpStatistics() const {
     MemoryStatistics profileData;
@@ -597,13 +744,24 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), m_solverMode, m_pool)));
     return m_controlUnits.back();
 }
 
 void NetworkMemoryControl::allocateMemory() {
+    const auto start = std::chrono::steady_clock::now();
     for (auto&& item : m_controlUnits) {
-        item->allocateMemory();
+        if (!item->allocated()) {
+            item->allocateMemory();
+        }
+    }
+    if (m_released) {
+        // the memory leased from the shared pool for every inference is not counted, only the released one
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        m_releaseStats.reallocations++;
+        m_releaseStats.reallocation_time_us +=
+            std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        m_released = false;
     }
 }
 
@@ -611,6 +769,14 @@ void NetworkMemoryControl::releaseMemory() {
     for (auto&& item : m_controlUnits) {
         item->releaseMemory();
     }
+    m_releaseStats.releases++;
+    m_released = true;
+}
+
+void NetworkMemoryControl::returnSharedMemory() {
+    for (auto&& item : m_controlUnits) {
+        item->returnSharedMemory();
+    }
 }
 
 std::vector<std::pair<std::string, MemoryStatistics>> NetworkMemoryControl::dumpStatistics() const {
@@ -626,4 +792,12 @@ std::vector<std::pair<std::string, MemoryStatistics>> NetworkMemoryControl::dump
 #endif  // CPU_DEBUG_CAPS
 }
 
+MemoryFootprint NetworkMemoryControl::footprint() const {
+    MemoryFootprint retVal;
+    for (auto&& item : m_controlUnits) {
+        retVal += item->footprint();
+    }
+    return retVal;
+}
+
 }  // namespace ov::intel_cpu
@@ -5,9 +5,12 @@
 #pragma once
 
 #include "edge.h"
+#include "internal_properties.hpp"
 
 namespace ov::intel_cpu {
 
+class ActivationMemoryPool;
+
 using EdgeCluster = std::vector<EdgePtr>;
 using EdgeClusters = std::vector<EdgeCluster>;
 
@@ -33,6 +36,31 @@ struct MemoryStatisticsRecord {
 
 using MemoryStatistics = std::vector<MemoryStatisticsRecord>;
 
+// footprint of the memory arenas planned in advance, available in all the build configurations
+struct MemoryFootprint {
+    size_t solved_size = 0;   // bytes
+    size_t optimal_size = 0;  // bytes, the lower bound for the solved size
+
+    MemoryFootprint& operator+=(const MemoryFootprint& other) {
+        solved_size += other.solved_size;
+        optimal_size += other.optimal_size;
+        return *this;
+    }
+};
+
+struct MemoryReleaseStatistics {
+    uint64_t releases = 0;
+    uint64_t reallocations = 0;
+    uint64_t reallocation_time_us = 0;
+
+    MemoryReleaseStatistics& operator+=(const MemoryReleaseStatistics& other) {
+        releases += other.releases;
+        reallocations += other.reallocations;
+        reallocation_time_us += other.reallocation_time_us;
+        return *this;
+    }
+};
+
 class MemoryControl {
 public:
     class RegionHandler;
@@ -53,13 +81,17 @@ public:
 
     void allocateMemory();
     void releaseMemory();
+    // returns the memory leased from the shared pool for the time of an inference
+    void returnSharedMemory();
 
     const std::string& getId() const {
         return m_id;
     }
 
+    MemoryFootprint footprint() const;
+
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id, MemorySolverMode solverMode, std::shared_ptr<ActivationMemoryPool> pool);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     MemoryStatistics dumpStatistics() const;
 
@@ -73,20 +105,40 @@ private:
 
 class NetworkMemoryControl {
 public:
-    NetworkMemoryControl() = default;
+    /**
+     * @param solverMode - algorithm packing the intermediate tensors of static shapes
+     * @param pool - if set, the memory for the intermediate tensors of static shapes is leased from the pool for the
+     * time of an inference instead of being owned
+     */
+    explicit NetworkMemoryControl(MemorySolverMode solverMode = MemorySolverMode::GREEDY,
+                                  std::shared_ptr<ActivationMemoryPool> pool = nullptr)
+        : m_solverMode(solverMode),
+          m_pool(std::move(pool)) {}
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
+    // allocates the memory of the control units which don't have it, e.g. after releaseMemory()
     void allocateMemory();
     void releaseMemory();
+    void returnSharedMemory();
 
     std::vector<std::pair<std::string, MemoryStatistics>> dumpStatistics() const;
+    MemoryFootprint footprint() const;
+
+    const MemoryReleaseStatistics& releaseStatistics() const {
+        return m_releaseStats;
+    }
 
     const std::vector<MemoryControl::Ptr>& controlUnits() const {
         return m_controlUnits;
     }
 
 private:
+    MemorySolverMode m_solverMode;
+    std::shared_ptr<ActivationMemoryPool> m_pool;
     std::vector<MemoryControl::Ptr> m_controlUnits;
+    MemoryReleaseStatistics m_releaseStats;
+    // the memory was released and isn't allocated again yet
+    bool m_released = false;
 };
 
 }  // namespace ov::intel_cpu
@@ -6,6 +6,9 @@
 
 #include <nodes/common/cpu_convert.h>
 
+#include <cstring>
+#include <functional>
+#include <numeric>
 #include <utility>
 
 #include "cpu_memory.h"
@@ -105,6 +108,20 @@ void VariableStateBase::reset() {
     reset_state_flag = true;
 }
 
+void VariableStateBase::fork_from(const std::shared_ptr<ov::IVariableState>& source) {
+    OPENVINO_ASSERT(source, "Source variable state is not initialized");
+    auto src = std::dynamic_pointer_cast<VariableStateBase>(source);
+    if (src && src->is_reset_state()) {
+        reset();
+        return;
+    }
+    if (src && src.get() != this && fork_from_impl(*src)) {
+        reset_state_flag = false;
+        return;
+    }
+    ov::IVariableState::fork_from(source);
+}
+
 bool VariableStateBase::is_reset_state() const {
     return reset_state_flag;
 }
@@ -212,11 +229,13 @@ VariableStateKVcache::VariableStateKVcache(const std::string& name,
                                            MemoryDescPtr external_desc,
                                            BlockedMemoryDescPtr dense_internal_desc,
                                            const bool quant_by_channel,
-                                           const size_t group_size)
+                                           const size_t group_size,
+                                           const size_t paged_block_size)
     : VariableStateBase(name, std::move(external_desc)),
       m_dense_internal_desc(std::move(dense_internal_desc)),
       m_quant_by_channel(quant_by_channel),
-      m_group_size(group_size) {
+      m_group_size(group_size),
+      m_paged_block_size(paged_block_size) {
     auto&& shape = get_external_desc()->getShape();
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
@@ -304,7 +323,12 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     // May be optimized by reusing the state tensor underlining memory pointer, but corner cases should be considered
     auto dense_internal_desc = m_dense_internal_desc->cloneWithNewDims(state_desc->getShape().getStaticDims());
 
-    m_internal_mem = std::make_shared<Memory>(get_engine(), dense_internal_desc);
+    if (m_paged_block_size) {
+        release_paged_storage();
+        resize_paged_internal_state(dense_internal_desc);
+    } else {
+        m_internal_mem = std::make_shared<Memory>(get_engine(), dense_internal_desc);
+    }
     Memory external_mem(get_engine(), state_desc, m_state->data());
 
     if (dense_internal_desc->getPrecision() == element::u8) {
@@ -323,9 +347,16 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
         auto S = internal.size(3);
         auto nthr = parallel_get_max_threads();
         std::vector<PlainTensor> buffers(nthr);
+        auto resize_scale_zp = [&](const VectorDims& dims) {
+            if (m_paged_block_size) {
+                resize_paged_scale_zp(dims);
+            } else {
+                m_scale_zp.resize<float>(dims);
+            }
+        };
         if (m_quant_by_channel) {
             size_t group_nums = div_up(L0, m_group_size);
-            m_scale_zp.resize<float>({group_nums * 2, B, H, S});
+            resize_scale_zp({group_nums * 2, B, H, S});
             parallel_for3d(group_nums, B, H, [&](size_t ithr, size_t group_id, size_t b, size_t h) {
                 size_t valid_seq = std::min(m_group_size, L0 - group_id * m_group_size);
                 buffers[ithr].resize<float>({valid_seq, S});
@@ -344,7 +375,7 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
                                          m_scale_zp.ptr<float>(group_id * 2 + 1, b, h));
             });
         } else {
-            m_scale_zp.resize<float>({L0, B, H, 2 * S / m_group_size});
+            resize_scale_zp({L0, B, H, 2 * S / m_group_size});
             parallel_for3d(B, H, L0, [&](size_t ithr, size_t b, size_t h, size_t m) {
                 buffers[ithr].resize<float>({S});
                 cpu_convert(external.ptr_v(m, b, h), buffers[ithr].ptr<float>(), external.m_dt, element::f32, S);
@@ -381,7 +412,100 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
 }
 
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    if (!m_paged_blk) {
+        return;
+    }
+    // return all the blocks of the paged storage, the next inference allocates only the blocks it needs
+    auto dims = m_paged_mem->getStaticDims();
+    dims[m_dense_internal_desc->getOrder()[0]] = 0;
+    m_paged_mem->redefineDesc(m_dense_internal_desc->cloneWithNewDims(dims));
+    release_paged_storage();
+    if (m_paged_scale_zp) {
+        m_scale_zp = PlainTensor();
+    }
+}
+
+void VariableStateKVcache::release_paged_storage() {
+    if (m_paged_blk) {
+        m_paged_blk->release();
+    }
+    if (m_paged_scale_zp) {
+        m_paged_scale_zp->release();
+    }
+}
+
+bool VariableStateKVcache::fork_from_impl(const VariableStateBase& source) {
+    const auto* src = dynamic_cast<const VariableStateKVcache*>(&source);
+    if (!src || !src->m_internal_mem || !src->m_hidden_state) {
+        return false;
+    }
+    const auto src_desc = src->m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    const auto precision = m_dense_internal_desc->getPrecision();
+    if (src_desc->getPrecision() != precision || src_desc->getOrder() != m_dense_internal_desc->getOrder() ||
+        src->m_quant_by_channel != m_quant_by_channel || src->m_group_size != m_group_size) {
+        return false;
+    }
+    const auto& dims = src_desc->getShape().getStaticDims();
+    const auto& order = m_dense_internal_desc->getOrder();
+    const size_t L = dims[order[0]];
+    if (L == 0) {
+        return false;
+    }
+
+    release_paged_storage();
+    auto dense_desc = m_dense_internal_desc->cloneWithNewDims(dims);
+    const bool share_pages = m_paged_block_size && src->is_paged();
+    if (m_paged_block_size) {
+        resize_paged_internal_state(dense_desc);
+    } else {
+        m_internal_mem = std::make_shared<Memory>(get_engine(), dense_desc);
+    }
+
+    // The stored tokens are never written again, except the last incomplete group of by channel quantization which
+    // is requantized together with the next tokens, so the pages below are shared with the source copy-on-write
+    const bool by_channel = precision == element::u8 && m_quant_by_channel;
+    const size_t shared_L = by_channel ? L / m_group_size * m_group_size : L;
+    if (share_pages) {
+        const size_t size = dense_desc->getCurrentMemSize();
+        m_paged_blk->share(*src->m_paged_blk, shared_L * (size / L), size);
+    } else {
+        m_internal_mem->load(*src->m_internal_mem, false, false);
+    }
+
+    if (precision == element::u8) {
+        // [L, B, H, S / group_size * 2] or [L groups * 2, B, H, S]
+        auto rows = [&](size_t len) {
+            return by_channel ? div_up(len, m_group_size) * 2 : len;
+        };
+        const auto& src_scale_zp = src->m_scale_zp;
+        VectorDims scale_zp_dims{rows(L), src_scale_zp.size(1), src_scale_zp.size(2), src_scale_zp.size(3)};
+        if (share_pages) {
+            resize_paged_scale_zp(scale_zp_dims);
+            const size_t row_size = m_scale_zp.stride(0) * sizeof(float);
+            m_paged_scale_zp->share(*src->m_paged_scale_zp, rows(shared_L) * row_size, rows(L) * row_size);
+        } else {
+            if (m_paged_block_size) {
+                resize_paged_scale_zp(scale_zp_dims);
+            } else {
+                m_scale_zp.resize<float>(scale_zp_dims);
+            }
+            parallel_for3d(scale_zp_dims[0], scale_zp_dims[1], scale_zp_dims[2], [&](size_t m, size_t b, size_t h) {
+                std::memcpy(m_scale_zp.ptr<float>(m, b, h),
+                            src_scale_zp.ptr<float>(m, b, h),
+                            scale_zp_dims[3] * sizeof(float));
+            });
+        }
+    }
+
+    // beam table is small, it is always copied
+    auto beam_table_desc =
+        std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32, Shape(src->m_hidden_state->getStaticDims()));
+    m_hidden_state = std::make_shared<Memory>(get_engine(), beam_table_desc);
+    m_hidden_state->load(*src->m_hidden_state, false, false);
+
+    m_internal_mem_max_size = dense_desc->getCurrentMemSize() / precision.size();
+    m_hidden_state_max_size = beam_table_desc->getCurrentMemSize() / beam_table_desc->getPrecision().size();
+    return true;
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -406,6 +530,36 @@ MemoryPtr VariableStateKVcache::internal_state_mem() const {
 
 void VariableStateKVcache::assign_internal_state(const MemoryPtr& mem) {
     m_internal_mem = mem;
+    if (!is_paged()) {
+        // the cache has been moved out of the paged storage
+        m_paged_mem.reset();
+        m_paged_blk = nullptr;
+        m_paged_scale_zp.reset();
+    }
+}
+
+void VariableStateKVcache::resize_paged_internal_state(const MemoryDescPtr& desc) {
+    OPENVINO_ASSERT(m_paged_block_size, "Paged storage is disabled for the state ", get_name());
+    if (!m_paged_mem) {
+        const auto& dims = desc->getShape().getStaticDims();
+        const auto L = std::max<size_t>(dims[m_dense_internal_desc->getOrder()[0]], 1);
+        auto block = std::make_unique<PagedMemoryBlock>(desc->getCurrentMemSize() / L * m_paged_block_size);
+        m_paged_blk = block.get();
+        m_paged_mem = std::make_shared<Memory>(get_engine(), desc, std::make_shared<DnnlMemoryBlock>(std::move(block)));
+    } else {
+        m_paged_mem->redefineDesc(desc);
+    }
+    m_internal_mem = m_paged_mem;
+}
+
+void VariableStateKVcache::resize_paged_scale_zp(const VectorDims& dims) {
+    OPENVINO_ASSERT(m_paged_block_size, "Paged storage is disabled for the state ", get_name());
+    const auto row_size = std::accumulate(dims.begin() + 1, dims.end(), sizeof(float), std::multiplies<>());
+    if (!m_paged_scale_zp) {
+        m_paged_scale_zp = std::make_shared<PagedMemoryBlock>(row_size * m_paged_block_size);
+    }
+    m_paged_scale_zp->resize(row_size * dims[0]);
+    m_scale_zp.resize<float>(dims, static_cast<float*>(m_paged_scale_zp->getRawPtr()));
 }
 
 MemoryPtr VariableStateKVcache::hidden_state_mem() const {
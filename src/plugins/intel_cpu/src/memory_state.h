@@ -8,6 +8,7 @@
 #include "memory_desc/blocked_memory_desc.h"
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/tensor.hpp"
+#include "paged_mem_blk.h"
 #include "utils/plain_tensor.hpp"
 
 namespace ov {
@@ -33,6 +34,7 @@ public:
     void set_state(const ov::SoPtr<ov::ITensor>& state) override final;
     ov::SoPtr<ov::ITensor> get_state() const override;
     void reset() override final;
+    void fork_from(const std::shared_ptr<ov::IVariableState>& source) override final;
     bool is_reset_state() const override final;
     void commit() override final;
 
@@ -41,6 +43,10 @@ protected:
     virtual void reset_impl() = 0;
     virtual void commit_impl() = 0;
     virtual void set_state_impl(const ov::SoPtr<ov::ITensor>& state);
+    // copies the internal representation of a compatible state, returns false if it is not possible
+    virtual bool fork_from_impl([[maybe_unused]] const VariableStateBase& source) {
+        return false;
+    }
 
     static MemoryDescPtr to_static(const MemoryDescPtr& desc);
     static const dnnl::engine& get_engine();
@@ -119,7 +125,8 @@ public:
                          MemoryDescPtr external_desc,
                          BlockedMemoryDescPtr dense_internal_desc,
                          const bool quant_by_channel,
-                         const size_t group_size = 0);
+                         const size_t group_size = 0,
+                         const size_t paged_block_size = 0);
 
     // ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
@@ -157,11 +164,35 @@ public:
         m_scale_zp = t;
     }
 
+    // tokens per block of the paged storage, 0 if the cache is kept in a single contiguous buffer
+    size_t paged_block_size() const {
+        return m_paged_block_size;
+    }
+    // whether the current kv cache memory is placed in the paged storage
+    bool is_paged() const {
+        return m_paged_mem && m_paged_mem == m_internal_mem;
+    }
+    /**
+     * @brief Places the kv cache into the paged storage and redefines it with the given descriptor. Tokens already
+     * stored in the paged storage stay in place, only the blocks for the new tokens are allocated.
+     * @param desc dense descriptor of the cache, L must be the outermost dimension of its physical layout
+     */
+    void resize_paged_internal_state(const MemoryDescPtr& desc);
+    /**
+     * @brief Places the u8 scales and zero points into the paged storage and redefines them with the given dims
+     * @param dims dims in the physical order, L (or L groups for by channel quantization) is the outermost one
+     */
+    void resize_paged_scale_zp(const VectorDims& dims);
+
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
+    bool fork_from_impl(const VariableStateBase& source) override;
+
+    // returns the pages of the paged storage to the system, the pages shared with other states are kept by them
+    void release_paged_storage();
 
 private:
     MemoryPtr m_internal_mem;  // kv cache
@@ -176,6 +207,12 @@ private:
     PlainTensor m_scale_zp;
     bool m_quant_by_channel = false;
     size_t m_group_size = 0;
+
+    // paged storage, the blocks are owned by the memory objects
+    size_t m_paged_block_size = 0;
+    MemoryPtr m_paged_mem;
+    PagedMemoryBlock* m_paged_blk = nullptr;
+    std::shared_ptr<PagedMemoryBlock> m_paged_scale_zp;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
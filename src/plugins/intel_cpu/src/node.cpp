@@ -747,7 +747,7 @@ static void fetchRawMemory(const MemoryPtr& mem) {
     }
 }
 
-void Node::updateShapes() {
+void Node::updateShapes(const std::vector<VectorDims>* outputShapes) {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateShapes() is called to a static shape node of type: ",
                     getTypeStr(),
@@ -755,6 +755,10 @@ void Node::updateShapes() {
                     getName());
     try {
         if (needShapeInfer()) {
+            if (outputShapes) {
+                redefineOutputMemory(*outputShapes);
+                return;
+            }
             auto result = shapeInfer();
             if (ShapeInferStatus::success == result.status) {
                 redefineOutputMemory(result.dims);
@@ -847,6 +851,23 @@ bool Node::outputShapeDataDependency() const {
     return false;
 }
 
+bool Node::outputShapesDefinedByInputShapes() const {
+    // the internal dynamism means the output shapes are known only after the execution
+    return shapeInference && FULL_PORT_MASK != shapeInference->get_port_mask() && !outputShapeDataDependency();
+}
+
+std::optional<std::vector<VectorDims>> Node::getOutputMemoryDims() const {
+    std::vector<VectorDims> dims;
+    for (size_t port = 0; port < outputShapes.size(); port++) {
+        const auto edges = getChildEdgesAtPort(port);
+        if (edges.empty() || !edges[0]->getMemory().getShape().isStatic()) {
+            return std::nullopt;
+        }
+        dims.push_back(edges[0]->getMemory().getStaticDims());
+    }
+    return dims;
+}
+
 void Node::redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes) {
     if (newOutputShapes.size() != outputShapes.size()) {
         OPENVINO_THROW("Number shapes mismatch with real outputs number for node with name: ", getName());
@@ -8,6 +8,7 @@
 
 #include <common/utils.hpp>
 #include <memory>
+#include <optional>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <openvino/itt.hpp>
 #include <shape_inference/shape_inference_cpu.hpp>
@@ -515,12 +516,21 @@ public:
     // but this requires changes in all the nodes. Since moving to a numa node right before an execute
     // is a temprorary solution, do it this way for now.
     void executeStatic(const dnnl::stream& strm, int numaId = -1);
-    void updateShapes();
+    /**
+     * @brief Updates the output memory if the input shapes have changed
+     * @param outputShapes - output shapes known in advance for the current input shapes, the shape inference is
+     * skipped if they are set
+     */
+    void updateShapes(const std::vector<VectorDims>* outputShapes = nullptr);
     void updateDynamicParams();
     void executeDynamic(const dnnl::stream& strm, int numaId = -1);
     virtual void redefineOutputMemory(const std::vector<VectorDims>& newShapes);
     void redefineOutputMemory(const size_t port, const VectorDims& new_output_shape);
     bool outputShapeDataDependency() const;
+    // the output shapes are a function of the input shapes only, so they may be memorized for the given input shapes
+    bool outputShapesDefinedByInputShapes() const;
+    // the current static shapes of the output memory, nullopt if some of them are not defined
+    std::optional<std::vector<VectorDims>> getOutputMemoryDims() const;
 
     virtual void initSupportedPrimitiveDescriptors();
 
@@ -1284,7 +1284,8 @@ void DeformableConvolution::prepareParams() {
 
     execPtr = nullptr;
 
-    auto cache = context->getParamsCache();
+    // the executor keeps the pointers to the sampling buffers of the node, so it is never shared between the streams
+    auto cache = context->getStreamParamsCache();
     auto result = cache->getOrCreate(key, [](const DefConvKey& key) -> std::shared_ptr<DefConvExecutor> {
         if (key.implType == impl_desc_type::ref) {
             return std::make_shared<DefConvRefExecutor>(key.defConvAttr, key.descVector);
@@ -4,13 +4,27 @@
 
 #include "embedding_bag.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <set>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "common/cpu_memcpy.h"
 #include "dnnl_types.h"
 #include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "utils/general_utils.h"
+
+#if defined(_MSC_VER) && defined(OPENVINO_ARCH_X86_64)
+#    include <xmmintrin.h>
+#endif
 
 namespace ov::intel_cpu::node {
 
@@ -37,16 +51,110 @@ EmbeddingBag::EmbeddingBag(const std::shared_ptr<ov::Node>& op,
     }
 }
 
-void EmbeddingBag::prepareParams(const VectorDims& indexStaticShape) {
+void EmbeddingBag::fuseTableDecompression(std::vector<float> scale, std::vector<float> zeroPoint) {
+    _decompressionScale = std::move(scale);
+    _decompressionZeroPoint = std::move(zeroPoint);
+}
+
+bool EmbeddingBag::isCompressedTable(const ov::element::Type& tablePrc) const {
+    if (one_of(tablePrc, ov::element::f16, ov::element::bf16)) {
+        return true;
+    }
+    return one_of(tablePrc, ov::element::u8, ov::element::i8) && !_decompressionScale.empty();
+}
+
+ov::element::Type EmbeddingBag::getDataPrecision(const ov::element::Type& tablePrc) const {
+    static const std::set<ov::element::Type> supportedPrecisions =
+        {ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::i8, ov::element::u8, ov::element::i32};
+    if (supportedPrecisions.find(tablePrc) == supportedPrecisions.end()) {
+        OPENVINO_THROW("Layer EmbeddingBag with name '", _layerName, "' has unsupported precision: ", tablePrc);
+    }
+    return isCompressedTable(tablePrc) ? ov::element::f32 : tablePrc;
+}
+
+namespace {
+
+// Number of indices the rows are prefetched ahead of the accumulation
+constexpr size_t PREFETCH_DISTANCE = 4lu;
+// The long rows are streamed by the hardware prefetcher, so only their beginning is requested
+constexpr size_t PREFETCH_MAX_BYTES = 1024lu;
+// Size of the per thread cache of the dequantized rows
+constexpr size_t ROW_CACHE_BYTES = 64lu * 1024lu;
+
+inline void prefetchRow(const void* row, size_t bytes) {
+    const auto* ptr = static_cast<const char*>(row);
+    bytes = std::min(bytes, PREFETCH_MAX_BYTES);
+    for (size_t offset = 0lu; offset < bytes; offset += 64lu) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(ptr + offset, 0, 3);
+#elif defined(_MSC_VER) && defined(OPENVINO_ARCH_X86_64)
+        _mm_prefetch(ptr + offset, _MM_HINT_T0);
+#else
+        (void)ptr;
+#endif
+    }
+}
+
+// Direct mapped cache of the dequantized table rows. The hot rows of recommender models repeat many times within
+// a batch, so each of them is converted once per thread instead of once per lookup. The storage is owned by the node,
+// the cache starts empty on every execution as the table may change.
+class RowCache {
+public:
+    RowCache(float* data, size_t* tags, size_t slots, size_t rowSize)
+        : _rowSize(rowSize),
+          _mask(slots - 1lu),
+          _tags(tags),
+          _data(data) {
+        std::fill(_tags, _tags + slots, std::numeric_limits<size_t>::max());
+    }
+
+    // Returns the slot of the row, hit is false if the slot has to be filled by the caller
+    float* get(size_t row, bool& hit) {
+        const size_t slot = row & _mask;
+        hit = _tags[slot] == row;
+        _tags[slot] = row;
+        return _data + slot * _rowSize;
+    }
+
+    // The largest power of two number of the rows which fit into ROW_CACHE_BYTES, at least one
+    static size_t slotsNum(size_t rowSize) {
+        size_t slots = 1lu;
+        while (slots * 2lu * rowSize * sizeof(float) <= ROW_CACHE_BYTES) {
+            slots *= 2lu;
+        }
+        return slots;
+    }
+
+private:
+    size_t _rowSize;
+    size_t _mask;
+    size_t* _tags;
+    float* _data;
+};
+
+}  // namespace
+
+void EmbeddingBag::prepareParams(const VectorDims& tableStaticShape, const ov::element::Type& tablePrc) {
     _embDepth = 1lu;
-    for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
-        _embDepth *= indexStaticShape[i];
+    for (size_t i = 1lu; i < tableStaticShape.size(); i++) {
+        _embDepth *= tableStaticShape[i];
+    }
+
+    _threadsNum = parallel_get_max_threads();
+    if (isCompressedTable(tablePrc)) {
+        _rowCacheSlots = RowCache::slotsNum(_embDepth);
+        _rowCacheData.resize(static_cast<size_t>(_threadsNum) * _rowCacheSlots * _embDepth);
+        _rowCacheTags.resize(static_cast<size_t>(_threadsNum) * _rowCacheSlots);
+    } else {
+        _rowCacheSlots = 0lu;
+        _rowCacheData.clear();
+        _rowCacheTags.clear();
     }
 }
 
-template <typename T>
+template <typename T, typename D>
 void EmbeddingBag::processData(const T* srcData,
-                               const T* weightsData,
+                               const D* weightsData,
                                const VectorDims& inDataDims,
                                const MemoryPtr& outMemory) {
     std::string msgPrefix = std::string("Node EmbeddingBag with name '") + _layerName + "' ";
@@ -54,7 +162,12 @@ void EmbeddingBag::processData(const T* srcData,
     initFromInputs();
 
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
-    auto* dstData = outMemory->getDataAs<T>();
+    auto* dstData = outMemory->getDataAs<D>();
+
+    constexpr bool withDecompression = !std::is_same_v<T, D>;
+    const size_t rowsNum = inDataDims[0];
+    const size_t scaleStride = _decompressionScale.size() > 1lu ? 1lu : 0lu;
+    const size_t zeroPointStride = _decompressionZeroPoint.size() > 1lu ? 1lu : 0lu;
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
@@ -63,67 +176,129 @@ void EmbeddingBag::processData(const T* srcData,
             return;
         }
 
+        std::optional<RowCache> rowCache;
+        if constexpr (withDecompression) {
+            static_assert(std::is_same_v<D, float>, "The compressed table is dequantized to f32");
+            rowCache.emplace(_rowCacheData.data() + ithr * _rowCacheSlots * _embDepth,
+                             _rowCacheTags.data() + ithr * _rowCacheSlots,
+                             _rowCacheSlots,
+                             _embDepth);
+        }
+
+        auto prefetch = [&](const int* indices, size_t idx, size_t size) {
+            if (idx < size && static_cast<size_t>(indices[idx]) < rowsNum) {
+                prefetchRow(srcData + indices[idx] * _embDepth, _embDepth * sizeof(T));
+            }
+        };
+
+        auto getRow = [&](int index) -> const D* {
+            if (static_cast<size_t>(index) >= rowsNum) {
+                OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(index));
+            }
+            const size_t row = static_cast<size_t>(index);
+            const T* src = srcData + row * _embDepth;
+            if constexpr (withDecompression) {
+                bool hit = false;
+                D* dst = rowCache->get(row, hit);
+                if (!hit) {
+                    if (_decompressionScale.empty()) {
+                        for (size_t i = 0lu; i < _embDepth; i++) {
+                            dst[i] = static_cast<D>(src[i]);
+                        }
+                    } else {
+                        const float scale = _decompressionScale[row * scaleStride];
+                        const float zeroPoint =
+                            _decompressionZeroPoint.empty() ? 0.f : _decompressionZeroPoint[row * zeroPointStride];
+                        for (size_t i = 0lu; i < _embDepth; i++) {
+                            dst[i] = (static_cast<float>(src[i]) - zeroPoint) * scale;
+                        }
+                    }
+                }
+                return dst;
+            } else {
+                return src;
+            }
+        };
+
         size_t indicesSize = 0lu;
         const int* indices = nullptr;
         int weightsIdx = 0lu;
         bool withWeights = _withWeights;
+        getIndices(start, indices, indicesSize, weightsIdx, withWeights);
+
+        size_t nextIndicesSize = 0lu;
+        const int* nextIndices = nullptr;
+        int nextWeightsIdx = 0lu;
+        bool nextWithWeights = _withWeights;
 
         for (size_t obi = start; obi < end; obi++) {
             size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0lu;
-                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                    OPENVINO_THROW(msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
-                }
-                size_t srcIndex = indices[inIdx] * _embDepth;
+            D* dst = dstData + dstIndex;
 
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
+            // The indices of the next bag are known in advance, so its first rows are loaded
+            // while the current bag is accumulated
+            const bool hasNext = obi + 1lu < end;
+            if (hasNext) {
+                getIndices(obi + 1lu, nextIndices, nextIndicesSize, nextWeightsIdx, nextWithWeights);
+                if (nextIndices != nullptr) {
+                    for (size_t inIdx = 0lu; inIdx < PREFETCH_DISTANCE; inIdx++) {
+                        prefetch(nextIndices, inIdx, nextIndicesSize);
                     }
                 }
+            }
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                        OPENVINO_THROW(msgPrefix +
-                                       "' has invalid embedding bag index: " + std::to_string(indices[inIdx]));
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
+            if (indices != nullptr && indicesSize != 0lu) {
+                withWeights = withWeights & _withWeights;
+
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                    prefetch(indices, inIdx + PREFETCH_DISTANCE, indicesSize);
+                    const D* src = getRow(indices[inIdx]);
 
                     if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
+                        const D weight = weightsData[weightsIdx];
+                        if (inIdx == 0lu) {
+                            for (size_t i = 0lu; i < _embDepth; i++) {
+                                dst[i] = src[i] * weight;
+                            }
+                        } else {
+                            for (size_t i = 0lu; i < _embDepth; i++) {
+                                dst[i] += src[i] * weight;
+                            }
                         }
                         weightsIdx++;
                     } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
+                        if (inIdx == 0lu) {
+                            for (size_t i = 0lu; i < _embDepth; i++) {
+                                dst[i] = src[i];
+                            }
+                        } else {
+                            for (size_t i = 0lu; i < _embDepth; i++) {
+                                dst[i] += src[i];
+                            }
                         }
                     }
                 }
                 if (_reduction == Reduction::MEAN) {
                     for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] /= indicesSize;
+                        dst[i] /= indicesSize;
                     }
                 }
             } else {
                 for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
+                    dst[i] = 0;
                 }
             }
+
+            if (hasNext) {
+                indices = nextIndices;
+                indicesSize = nextIndicesSize;
+                weightsIdx = nextWeightsIdx;
+                withWeights = nextWithWeights;
+            }
         }
     };
 
-    parallel_nt(0, threadBody);
+    parallel_nt(_threadsNum, threadBody);
 }
 
 void EmbeddingBag::execute(const uint8_t* srcData,
@@ -131,30 +306,37 @@ void EmbeddingBag::execute(const uint8_t* srcData,
                            const ov::element::Type& srcPrc,
                            const VectorDims& inDims,
                            const MemoryPtr& outMemory) {
+    const auto* weights = reinterpret_cast<const float*>(weightsData);
     switch (srcPrc) {
     case ov::element::f32: {
-        return processData<element_type_traits<ov::element::f32>::value_type>(
-            reinterpret_cast<const float*>(srcData),
-            reinterpret_cast<const float*>(weightsData),
-            inDims,
-            outMemory);
+        return processData(reinterpret_cast<const float*>(srcData), weights, inDims, outMemory);
+    }
+    case ov::element::f16: {
+        return processData(reinterpret_cast<const ov::float16*>(srcData), weights, inDims, outMemory);
+    }
+    case ov::element::bf16: {
+        return processData(reinterpret_cast<const ov::bfloat16*>(srcData), weights, inDims, outMemory);
     }
     case ov::element::i8: {
-        return processData<element_type_traits<ov::element::i8>::value_type>(
-            reinterpret_cast<const int8_t*>(srcData),
-            reinterpret_cast<const int8_t*>(weightsData),
-            inDims,
-            outMemory);
+        if (isCompressedTable(srcPrc)) {
+            return processData(reinterpret_cast<const int8_t*>(srcData), weights, inDims, outMemory);
+        }
+        return processData(reinterpret_cast<const int8_t*>(srcData),
+                           reinterpret_cast<const int8_t*>(weightsData),
+                           inDims,
+                           outMemory);
     }
     case ov::element::u8: {
-        return processData<element_type_traits<ov::element::u8>::value_type>(srcData, weightsData, inDims, outMemory);
+        if (isCompressedTable(srcPrc)) {
+            return processData(srcData, weights, inDims, outMemory);
+        }
+        return processData(srcData, weightsData, inDims, outMemory);
     }
     case ov::element::i32: {
-        return processData<element_type_traits<ov::element::i32>::value_type>(
-            reinterpret_cast<const int32_t*>(srcData),
-            reinterpret_cast<const int32_t*>(weightsData),
-            inDims,
-            outMemory);
+        return processData(reinterpret_cast<const int32_t*>(srcData),
+                           reinterpret_cast<const int32_t*>(weightsData),
+                           inDims,
+                           outMemory);
     }
     default: {
         OPENVINO_THROW("EmbeddingBag layer does not support precision '" + std::string(srcPrc.get_type_name()) + "'");
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "node.h"
 
 namespace ov {
@@ -27,6 +29,20 @@ public:
 
     ~EmbeddingBag() = default;
 
+    /**
+     * @brief Fuses the decompression of u8/i8 embedding table, so the rows are dequantized on the fly as
+     *        (row - zeroPoint) * scale instead of materializing the table in f32.
+     *        The scale and the zero point are either scalars or have one value per row of the table,
+     *        the zero point is empty if the table has no zero point.
+     */
+    void fuseTableDecompression(std::vector<float> scale, std::vector<float> zeroPoint);
+
+    /**
+     * @brief Returns true if the table of the given precision is dequantized on the fly:
+     *        f16/bf16 tables and u8/i8 tables with the fused decompression are accumulated and returned in f32
+     */
+    bool isCompressedTable(const ov::element::Type& tablePrc) const;
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(size_t embIndex,
@@ -35,10 +51,14 @@ protected:
                             int& weightsIdx,
                             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    // Sizes the per thread caches of the dequantized rows if the table is compressed
+    void prepareParams(const VectorDims& tableStaticShape, const ov::element::Type& tablePrc);
 
-    template <typename T>
-    void processData(const T* srcData, const T* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
+    template <typename T, typename D>
+    void processData(const T* srcData, const D* weightsData, const VectorDims& inDataDims, const MemoryPtr& outMemory);
+
+    // Returns the precision of the per sample weights and the output for the given table precision
+    ov::element::Type getDataPrecision(const ov::element::Type& tablePrc) const;
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -49,6 +69,15 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::vector<float> _decompressionScale;
+    std::vector<float> _decompressionZeroPoint;
+
+    // Number of threads the bags are split between, the row caches are allocated for each of them
+    int _threadsNum = 0;
+    size_t _rowCacheSlots = 0lu;
+    std::vector<float> _rowCacheData;
+    std::vector<size_t> _rowCacheTags;
 };
 
 }  // namespace node
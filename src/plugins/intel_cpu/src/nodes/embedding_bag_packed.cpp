@@ -61,42 +61,23 @@ void EmbeddingBagPacked::initSupportedPrimitiveDescriptors() {
         return;
     }
 
-    static const std::set<ov::element::Type> supportedPrecisions = {ov::element::f32,
-                                                                    ov::element::i8,
-                                                                    ov::element::u8,
-                                                                    ov::element::i32};
-
-    auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (one_of(inDataPrecision, ov::element::bf16, ov::element::f16)) {
-        inDataPrecision = ov::element::f32;
-    }
-    if (!supportedPrecisions.empty()) {
-        if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end()) {
-            THROW_CPU_NODE_ERR("has unsupported precision: ", inDataPrecision.get_type_name());
-        }
-    } else {
-        static const std::set<ov::element::Type> defaultSupportedPrecisions = {ov::element::f32,
-                                                                               ov::element::i8,
-                                                                               ov::element::u8,
-                                                                               ov::element::i32};
-        if (defaultSupportedPrecisions.find(inDataPrecision) == defaultSupportedPrecisions.end()) {
-            THROW_CPU_NODE_ERR("has unsupported precision: ", inDataPrecision.get_type_name());
-        }
-    }
+    const auto tablePrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
+    const auto dataPrecision = getDataPrecision(tablePrecision);
 
     std::vector<PortConfigurator> inDataConfigurators(
-        {{LayoutType::ncsp, inDataPrecision}, {LayoutType::ncsp, ov::element::i32}});
+        {{LayoutType::ncsp, tablePrecision}, {LayoutType::ncsp, ov::element::i32}});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX) {
-        inDataConfigurators.emplace_back(LayoutType::ncsp, inDataPrecision);
+        inDataConfigurators.emplace_back(LayoutType::ncsp, dataPrecision);
     }
 
-    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, inDataPrecision}}, impl_desc_type::ref_any);
+    addSupportedPrimDesc(inDataConfigurators, {{LayoutType::ncsp, dataPrecision}}, impl_desc_type::ref_any);
 }
 
 void EmbeddingBagPacked::prepareParams() {
     _batch = getParentEdgeAt(INDICES_IDX)->getMemory().getStaticDims()[0];
     _indicesPerBag = getParentEdgeAt(INDICES_IDX)->getMemory().getStaticDims()[1];
-    EmbeddingBag::prepareParams(getParentEdgeAt(EMB_TABLE_IDX)->getMemory().getStaticDims());
+    const auto& tableMem = getParentEdgeAt(EMB_TABLE_IDX)->getMemory();
+    EmbeddingBag::prepareParams(tableMem.getStaticDims(), tableMem.getDesc().getPrecision());
 }
 
 void EmbeddingBagPacked::initFromInputs() {
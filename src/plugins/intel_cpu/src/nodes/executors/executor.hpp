@@ -147,6 +147,7 @@ public:
 private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
+    // may be shared by the streams: the primitives cached here take all the memory arguments on the call
     MultiCacheWeakPtr runtimeCache;
     std::vector<DnnlScratchPadPtr> scratchPads;
     WeightsSharing::Ptr weightsCache;
@@ -67,6 +67,11 @@ SubgraphCodeGenerator::SubgraphCodeGenerator(const std::shared_ptr<SubgraphAttrs
         std::make_shared<ov::snippets::Schedule>(snippet_attrs->snippet->generate(reinterpret_cast<const void*>(&jcp)));
 }
 
+SubgraphCodeGenerator::SubgraphCodeGenerator(std::shared_ptr<snippets::Schedule> schedule)
+    : schedule(std::move(schedule)) {
+    OPENVINO_ASSERT(this->schedule, "Schedule is empty!");
+}
+
 SubgraphBaseExecutor::SubgraphBaseExecutor(const std::shared_ptr<CPURuntimeConfig>& snippet_config,
                                            [[maybe_unused]] const std::shared_ptr<SubgraphAttrs>& snippet_attrs,
                                            const std::shared_ptr<SubgraphCodeGenerator>& snippet,
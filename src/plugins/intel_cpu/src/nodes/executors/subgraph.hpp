@@ -28,6 +28,8 @@ class SubgraphCodeGenerator {
 public:
     SubgraphCodeGenerator(const std::shared_ptr<SubgraphAttrs>& snippet_attrs,
                           const std::shared_ptr<CPURuntimeConfig>& config);
+    // takes the code generated before, e.g. by another process
+    explicit SubgraphCodeGenerator(std::shared_ptr<snippets::Schedule> schedule);
 
     [[nodiscard]] const std::shared_ptr<snippets::Schedule>& get() const {
         return schedule;
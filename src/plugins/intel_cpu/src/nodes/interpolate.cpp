@@ -2517,7 +2517,8 @@ void Interpolate::prepareParams() {
         return executor;
     };
 
-    auto cache = context->getParamsCache();
+    // the pillow modes keep the working buffer on the executor, so it is never shared between the streams
+    auto cache = context->getStreamParamsCache();
     auto result = cache->getOrCreate(key, buildExecutor);
     execPtr = result.first;
 
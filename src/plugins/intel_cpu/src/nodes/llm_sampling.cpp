@@ -0,0 +1,377 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "llm_sampling.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/parallel.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+
+namespace ov::intel_cpu::node {
+
+namespace {
+
+struct Token {
+    float score;
+    size_t id;
+};
+
+// Higher score first, the ties are ordered by id as TopK orders them
+bool greater(const Token& lhs, const Token& rhs) {
+    return lhs.score > rhs.score || (lhs.score == rhs.score && lhs.id < rhs.id);
+}
+
+// Maps the score to the key that keeps the order of the scores in the unsigned comparison
+uint32_t to_key(float score) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &score, sizeof(bits));
+    return (bits & 0x80000000U) != 0 ? ~bits : bits | 0x80000000U;
+}
+
+// The row of the logits with the repetition penalty applied. The penalized tokens are kept aside as the sorted list,
+// so the logits are read in place without the copy of the whole vocabulary
+template <typename T>
+class Row {
+public:
+    Row(const T* logits, size_t size, std::vector<Token> penalized)
+        : m_logits(logits),
+          m_size(size),
+          m_penalized(std::move(penalized)) {}
+
+    size_t size() const {
+        return m_size;
+    }
+
+    template <typename F>
+    void for_each(F&& f) const {
+        auto penalized = m_penalized.begin();
+        for (size_t i = 0; i < m_size; ++i) {
+            if (penalized != m_penalized.end() && penalized->id == i) {
+                f(i, penalized->score);
+                ++penalized;
+            } else {
+                f(i, static_cast<float>(m_logits[i]));
+            }
+        }
+    }
+
+private:
+    const T* m_logits;
+    size_t m_size;
+    std::vector<Token> m_penalized;
+};
+
+/**
+ * Returns `count` tokens with the highest scores in the order of ids. The threshold score is found by the radix
+ * select over the bytes of the score keys: each pass builds the histogram of the next byte of the keys which share
+ * the already selected prefix, so the selection costs several reads of the row instead of the full sort.
+ */
+template <typename T>
+std::vector<Token> select_top(const Row<T>& row, size_t count) {
+    std::vector<Token> tokens;
+    tokens.reserve(std::min(count, row.size()));
+    if (count >= row.size()) {
+        row.for_each([&](size_t id, float score) {
+            tokens.push_back({score, id});
+        });
+        return tokens;
+    }
+
+    uint32_t prefix = 0;
+    uint32_t mask = 0;
+    size_t remaining = count;  // the number of tokens to take from the bucket of the prefix
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        std::array<size_t, 256> histogram{};
+        row.for_each([&](size_t, float score) {
+            const auto key = to_key(score);
+            if ((key & mask) == prefix) {
+                histogram[(key >> shift) & 0xFFU]++;
+            }
+        });
+        uint32_t digit = 255;
+        while (histogram[digit] < remaining) {
+            remaining -= histogram[digit];
+            --digit;
+        }
+        prefix |= digit << shift;
+        mask |= 0xFFU << shift;
+        if (histogram[digit] == remaining) {
+            break;  // the whole bucket is taken
+        }
+    }
+
+    row.for_each([&](size_t id, float score) {
+        const auto key = to_key(score) & mask;
+        if (key > prefix) {
+            tokens.push_back({score, id});
+        } else if (key == prefix && remaining > 0) {
+            tokens.push_back({score, id});
+            --remaining;
+        }
+    });
+    return tokens;
+}
+
+// Returns the number of the first tokens whose cumulative probability reaches top_p
+size_t nucleus_size(const std::vector<float>& weights, double total, float top_p) {
+    if (top_p >= 1.0f) {
+        return weights.size();
+    }
+    double sum = 0.0;
+    for (size_t i = 0; i < weights.size(); ++i) {
+        sum += weights[i];
+        if (sum >= top_p * total) {
+            return i + 1;
+        }
+    }
+    return weights.size();
+}
+
+template <typename T, typename O>
+void sample_row(const Row<T>& row,
+                const LLMSamplingNode::Config& config,
+                const float* random_samples,
+                size_t num_samples,
+                O* output) {
+    const size_t vocab = row.size();
+    const float inv_temperature = 1.0f / config.temperature;
+    std::vector<Token> tokens;
+    std::vector<float> weights;
+    auto compute_weights = [&](float max) {
+        weights.resize(tokens.size());
+        double total = 0.0;
+        for (size_t i = 0; i < tokens.size(); ++i) {
+            weights[i] = std::exp((tokens[i].score - max) * inv_temperature);
+            total += weights[i];
+        }
+        return total;
+    };
+
+    size_t keep = 0;
+    if (config.top_k > 0 && config.top_k < vocab) {
+        // The distribution is renormalized over the top-k tokens, then the nucleus is taken from them
+        tokens = select_top(row, config.top_k);
+        std::sort(tokens.begin(), tokens.end(), greater);
+        const auto total = compute_weights(tokens.front().score);
+        keep = nucleus_size(weights, total, config.top_p);
+    } else {
+        float max = std::numeric_limits<float>::lowest();
+        row.for_each([&](size_t, float score) {
+            max = std::max(max, score);
+        });
+        if (config.top_p < 1.0f) {
+            // The normalizer of the whole vocabulary is computed in one pass, then the number of the selected tokens
+            // grows until they cover top_p of the probability mass, which takes a small fraction of the vocabulary
+            double total = 0.0;
+            row.for_each([&](size_t, float score) {
+                total += std::exp((score - max) * inv_temperature);
+            });
+            for (size_t count = std::min<size_t>(vocab, 256);; count = std::min(vocab, count * 4)) {
+                tokens = select_top(row, count);
+                std::sort(tokens.begin(), tokens.end(), greater);
+                compute_weights(max);
+                keep = nucleus_size(weights, total, config.top_p);
+                if (keep < tokens.size() || count == vocab) {
+                    break;
+                }
+            }
+        } else {
+            tokens = select_top(row, vocab);
+            compute_weights(max);
+            keep = tokens.size();
+        }
+    }
+    if (!config.with_replacement) {
+        keep = std::max(keep, std::min(num_samples, tokens.size()));
+    }
+    weights.resize(keep);
+
+    std::vector<double> cdf(keep);
+    for (size_t s = 0; s < num_samples; ++s) {
+        if (s == 0 || !config.with_replacement) {
+            std::partial_sum(weights.begin(), weights.end(), cdf.begin());
+        }
+        const double target = random_samples[s] * cdf.back();
+        auto idx = static_cast<size_t>(std::lower_bound(cdf.begin(), cdf.end(), target) - cdf.begin());
+        // The drawn tokens have zero weight when sampling without replacement
+        while (idx + 1 < keep && weights[idx] == 0.0f) {
+            ++idx;
+        }
+        idx = std::min(idx, keep - 1);
+        output[s] = static_cast<O>(tokens[idx].id);
+        if (!config.with_replacement) {
+            weights[idx] = 0.0f;
+        }
+    }
+}
+
+}  // namespace
+
+LLMSampling::LLMSampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    const auto node = ov::as_type_ptr<const LLMSamplingNode>(op);
+    m_config = node->get_config();
+    m_with_penalties = op->get_input_size() > PENALIZED_IDS_PORT;
+}
+
+bool LLMSampling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto node = ov::as_type_ptr<const LLMSamplingNode>(op);
+        if (!node) {
+            errorMessage = "Only LLMSampling operation from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+void LLMSampling::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    m_logits_precision = getOriginalInputPrecisionAtPort(LOGITS_PORT);
+    if (!one_of(m_logits_precision, ov::element::f32, ov::element::f16, ov::element::bf16)) {
+        m_logits_precision = ov::element::f32;
+    }
+
+    std::vector<PortConfigurator> inPortConfigs{{LayoutType::ncsp, m_logits_precision},
+                                                {LayoutType::ncsp, ov::element::i32}};
+    if (m_with_penalties) {
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::i32);
+    }
+    addSupportedPrimDesc(inPortConfigs, {{LayoutType::ncsp, m_config.output_type}}, ref_any);
+}
+
+bool LLMSampling::created() const {
+    return getType() == Type::LLMSampling;
+}
+
+bool LLMSampling::isExecutable() const {
+    return !isInputTensorAtPortEmpty(LOGITS_PORT) && !isInputTensorAtPortEmpty(NUM_SAMPLES_PORT);
+}
+
+void LLMSampling::execute([[maybe_unused]] const dnnl::stream& strm) {
+    switch (m_logits_precision) {
+    case ov::element::f32:
+        return execute_logits_type<float>();
+    case ov::element::f16:
+        return execute_logits_type<ov::float16>();
+    case ov::element::bf16:
+        return execute_logits_type<ov::bfloat16>();
+    default:
+        THROW_CPU_NODE_ERR("does not support logits element type: ", m_logits_precision);
+    }
+}
+
+template <typename T>
+void LLMSampling::execute_logits_type() {
+    switch (m_config.output_type) {
+    case ov::element::i32:
+        return execute_type<T, int32_t>();
+    case ov::element::i64:
+        return execute_type<T, int64_t>();
+    default:
+        THROW_CPU_NODE_ERR("does not support output element type: ", m_config.output_type);
+    }
+}
+
+template <typename T, typename O>
+void LLMSampling::execute_type() {
+    const auto& logits_dims = getParentEdgeAt(LOGITS_PORT)->getMemory().getStaticDims();
+    const size_t batch = logits_dims[0];
+    const size_t vocab = logits_dims[1];
+    const auto num_samples = static_cast<size_t>(getSrcDataAtPortAs<const int32_t>(NUM_SAMPLES_PORT)[0]);
+    if (batch == 0 || num_samples == 0) {
+        return;
+    }
+    CPU_NODE_ASSERT(vocab > 0, "has empty vocabulary");
+    const size_t candidates = m_config.top_k > 0 ? std::min(m_config.top_k, vocab) : vocab;
+    CPU_NODE_ASSERT(m_config.with_replacement || num_samples <= candidates,
+                    "cannot draw ",
+                    num_samples,
+                    " samples without replacement from ",
+                    candidates,
+                    " tokens");
+
+    const auto* logits = getSrcDataAtPortAs<const T>(LOGITS_PORT);
+    auto* output = getDstDataAtPortAs<O>(OUTPUT_PORT);
+
+    // The random samples are drawn the same way as Multinomial does, so the fused subgraph gives the same tokens
+    std::mt19937 gen;
+    if (m_config.global_seed == 0 && m_config.op_seed == 0) {
+        gen.seed(std::time(nullptr));
+    } else {
+        std::seed_seq seed{m_config.global_seed, m_config.op_seed};
+        gen.seed(seed);
+    }
+    const auto gen_max = static_cast<float>(gen.max());
+    std::vector<float> random_samples(batch * num_samples);
+    std::generate(random_samples.begin(), random_samples.end(), [&]() {
+        return static_cast<float>(gen()) / gen_max;
+    });
+
+    const int32_t* penalized_ids = nullptr;
+    size_t penalized_count = 0;
+    if (m_with_penalties) {
+        const auto& ids_dims = getParentEdgeAt(PENALIZED_IDS_PORT)->getMemory().getStaticDims();
+        CPU_NODE_ASSERT(ids_dims.size() == 2 && ids_dims[0] == batch,
+                        "has incompatible 'penalized_ids' shape ",
+                        PartialShape(ids_dims));
+        penalized_ids = getSrcDataAtPortAs<const int32_t>(PENALIZED_IDS_PORT);
+        penalized_count = ids_dims[1];
+    }
+
+    parallel_for(batch, [&](size_t b) {
+        const T* row_logits = logits + b * vocab;
+        std::vector<Token> penalized;
+        if (m_config.repetition_penalty != 1.0f) {
+            penalized.reserve(penalized_count);
+            for (size_t i = 0; i < penalized_count; ++i) {
+                const auto id = penalized_ids[b * penalized_count + i];
+                if (id < 0 || static_cast<size_t>(id) >= vocab) {
+                    continue;
+                }
+                const auto logit = static_cast<float>(row_logits[id]);
+                const auto score =
+                    logit < 0.0f ? logit * m_config.repetition_penalty : logit / m_config.repetition_penalty;
+                penalized.push_back({score, static_cast<size_t>(id)});
+            }
+            std::sort(penalized.begin(), penalized.end(), [](const Token& lhs, const Token& rhs) {
+                return lhs.id < rhs.id;
+            });
+            penalized.erase(std::unique(penalized.begin(),
+                                        penalized.end(),
+                                        [](const Token& lhs, const Token& rhs) {
+                                            return lhs.id == rhs.id;
+                                        }),
+                            penalized.end());
+        }
+
+        const Row<T> row(row_logits, vocab, std::move(penalized));
+        sample_row(row, m_config, random_samples.data() + b * num_samples, num_samples, output + b * num_samples);
+    });
+}
+
+}  // namespace ov::intel_cpu::node
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "node.h"
+#include "transformations/cpu_opset/common/op/llm_sampling.hpp"
+
+namespace ov::intel_cpu::node {
+
+class LLMSampling : public Node {
+public:
+    LLMSampling(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {}
+    void initSupportedPrimitiveDescriptors() override;
+    [[nodiscard]] bool created() const override;
+    [[nodiscard]] bool needPrepareParams() const override {
+        return false;
+    }
+    [[nodiscard]] bool isExecutable() const override;
+    void execute(const dnnl::stream& strm) override;
+    void executeDynamicImpl(const dnnl::stream& strm) override {
+        execute(strm);
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template <typename T>
+    void execute_logits_type();
+
+    template <typename T, typename O>
+    void execute_type();
+
+    static constexpr size_t LOGITS_PORT = 0LU;
+    static constexpr size_t NUM_SAMPLES_PORT = 1LU;
+    static constexpr size_t PENALIZED_IDS_PORT = 2LU;
+    static constexpr size_t OUTPUT_PORT = 0LU;
+
+    LLMSamplingNode::Config m_config;
+    ov::element::Type m_logits_precision;
+    bool m_with_penalties = false;
+};
+
+}  // namespace ov::intel_cpu::node
@@ -986,7 +986,8 @@ MemStatePtr MemoryInputSDPA::makeState() const {
                                                   original_desc,
                                                   internal_desc,
                                                   quant_param.isByChannel,
-                                                  quant_param.groupSize);
+                                                  quant_param.groupSize,
+                                                  context->getConfig().kvCachePagedBlockSize);
 }
 
 void MemoryInputSDPA::runStatic(dnnl::stream strm) {
@@ -194,7 +194,8 @@ void PagedAttention::createPrimitive() {
 #endif
     };
 
-    auto cache = context->getParamsCache();
+    // the executor keeps the scratch buffers of the stream, so it is never shared between the streams
+    auto cache = context->getStreamParamsCache();
     auto result = cache->getOrCreate(key, builder);
     if (!result.first) {
         THROW_CPU_NODE_ERR("AttentionExecutor creation fails with precision " + rtPrecision.to_string());
@@ -1303,7 +1303,8 @@ void ScaledDotProductAttention::createPrimitive() {
         return executor;
     };
 
-    auto cache = context->getParamsCache();
+    // the executor keeps the scratch buffers of the stream, so it is never shared between the streams
+    auto cache = context->getStreamParamsCache();
     auto result = cache->getOrCreate(key, builder);
     if (!result.first) {
         THROW_CPU_NODE_ERR("AttentionExecutor creation fails with precision " + rtPrecision.to_string());
@@ -1852,7 +1853,66 @@ void ScaledDotProductAttention::updatePastkv(const MemoryPtr& mem_cur_k, const M
     // resize buffer
     ov::element::Type kvcache_precision = m_k_state->internal_desc()->getPrecision();
     bool need_redefine = true;
-    if (B * H * (L0 + L1) * S > m_k_state->internal_state_max_size()) {
+    if (m_k_state->paged_block_size()) {
+        // paged storage: L is the outermost dimension of the physical layout, so the cache grows by committing the
+        // blocks for the new tokens only, the stored tokens are copied just once when the cache is moved into the
+        // paged storage (e.g. after the batch has been changed by resetBeamTablePastkv)
+        need_redefine = false;
+        const bool move_to_paged = L0 > 0 && !is_reset && !m_k_state->is_paged();
+        PlainTensor old_past_k, old_past_v;
+        PlainTensor old_scale_zp_k = m_k_state->get_scale_zp();
+        PlainTensor old_scale_zp_v = m_v_state->get_scale_zp();
+        if (move_to_paged) {
+            old_past_k.reset(internal_mem_k);
+            old_past_v.reset(internal_mem_v);
+            old_past_k = old_past_k.permute(order);
+            old_past_v = old_past_v.permute(order);
+        }
+        auto dense_desc = [&](size_t new_S) {
+            std::vector<size_t> new_shape = reverse({B, H, (L0 + L1), new_S});
+            return std::make_shared<CpuBlockedMemoryDesc>(kvcache_precision,
+                                                          Shape(new_shape),
+                                                          permute_axes(new_shape, real_order),
+                                                          real_order);
+        };
+        m_k_state->resize_paged_internal_state(dense_desc(S));
+        m_v_state->resize_paged_internal_state(dense_desc(SV));
+        internal_mem_k = m_k_state->internal_state_mem();
+        internal_mem_v = m_v_state->internal_state_mem();
+        past_k.reset(internal_mem_k);
+        past_v.reset(internal_mem_v);
+        past_k = past_k.permute(order);
+        past_v = past_v.permute(order);
+        if (move_to_paged) {
+            attn_memcpy(old_past_k, old_past_v, past_k, past_v);
+        }
+        if (kvcache_precision == ov::element::u8) {
+            // LBHS, the same layout as in the contiguous mode but without the reserve
+            auto get_scale_zp_shape = [&](const SDPAQuantParam& quant_param, const size_t hidden_states) {
+                if (quant_param.isByChannel) {
+                    return VectorDims{div_up(L0 + L1, quant_param.groupSize) * 2, B, H, hidden_states};
+                }
+                return VectorDims{L0 + L1, B, H, hidden_states / quant_param.groupSize * 2};
+            };
+            m_k_state->resize_paged_scale_zp(get_scale_zp_shape(m_key_quant_param, S));
+            m_v_state->resize_paged_scale_zp(get_scale_zp_shape(m_value_quant_param, SV));
+            if (move_to_paged) {
+                auto copy_scales_zp =
+                    [&](const SDPAQuantParam& quant_param, PlainTensor& new_scale_zp, PlainTensor& old_scale_zp) {
+                        size_t rows = quant_param.isByChannel ? div_up(L0, quant_param.groupSize) * 2 : L0;
+                        parallel_for2d(rows, B, [&](size_t m, size_t b) {
+                            for (size_t h = 0; h < H; h++) {
+                                std::memcpy(new_scale_zp.ptr<float>(m, b, h, 0),
+                                            old_scale_zp.ptr<float>(m, b, h, 0),
+                                            sizeof(float) * old_scale_zp.m_dims[3]);
+                            }
+                        });
+                    };
+                copy_scales_zp(m_key_quant_param, m_k_state->get_scale_zp(), old_scale_zp_k);
+                copy_scales_zp(m_value_quant_param, m_v_state->get_scale_zp(), old_scale_zp_v);
+            }
+        }
+    } else if (B * H * (L0 + L1) * S > m_k_state->internal_state_max_size()) {
         // new_shape is the shape used by the original model which maybe different from BHLS, reverse here is to permute
         // BHLS to original model shape. BHLS is the stated input shape of SDPA, however internally we use LBHS for
         // KV-cache storage. real_order is used to permute the original shape to LBHS
@@ -46,11 +46,18 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <sstream>
 #include <utility>
 #include <vector>
 
+#include "openvino/core/version.hpp"
 #include "utils/cpu_utils.hpp"
 #include "utils/ngraph_utils.hpp"
+#include "utils/tmp_file.hpp"
 
 #ifdef SNIPPETS_LIBXSMM_TPP
 #    include "snippets/lowered/pass/optimize_domain.hpp"
@@ -113,6 +120,244 @@ struct SubgraphCodeGeneratorKey {
     std::shared_ptr<SubgraphAttrs> attrs = nullptr;
     uint32_t broadcasting_mask = 0;
 };
+
+// The code generated for static shapes depends on the subgraph, the target ISA, the precision the body is lowered to
+// and the static scheduling data compiled into the code, so it is the same in all the compiled models which have
+// these equal
+struct SubgraphSharedCodeKey {
+    SubgraphSharedCodeKey(SubgraphCodeGeneratorKey code_key_,
+                          int isa_,
+                          ov::element::Type precision_,
+                          bool brgemm_tuning_,
+                          const CPURuntimeConfig& config)
+        : code_key(detach(code_key_)),
+          isa(isa_),
+          precision(precision_),
+          brgemm_tuning(brgemm_tuning_),
+          tensor_rank(config.tensor_rank),
+          tile_rank(config.tile_rank),
+          io_shapes(config.io_shapes),
+          io_layouts(config.io_layouts),
+          io_data_offsets(config.io_data_offsets),
+          master_shape(config.master_shape),
+          buffer_scratchpad_size(config.buffer_scratchpad_size),
+          buffer_cluster_offsets(config.buffer_cluster_offsets) {}
+
+    [[nodiscard]] size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+
+        size_t seed = code_key.hash();
+        seed = hash_combine(seed, isa);
+        seed = hash_combine(seed, precision.hash());
+        seed = hash_combine(seed, brgemm_tuning);
+        seed = hash_combine(seed, tensor_rank);
+        seed = hash_combine(seed, tile_rank);
+        for (const auto* dims : {&io_shapes, &io_layouts, &io_data_offsets}) {
+            for (const auto& dim : *dims) {
+                seed = get_vector_hash(seed, dim);
+            }
+        }
+        seed = get_vector_hash(seed, master_shape);
+        seed = hash_combine(seed, buffer_scratchpad_size);
+        seed = get_vector_hash(seed, buffer_cluster_offsets);
+        return seed;
+    }
+    bool operator==(const SubgraphSharedCodeKey& rhs) const {
+        return code_key == rhs.code_key && isa == rhs.isa && precision == rhs.precision &&
+               brgemm_tuning == rhs.brgemm_tuning && tensor_rank == rhs.tensor_rank && tile_rank == rhs.tile_rank &&
+               io_shapes == rhs.io_shapes && io_layouts == rhs.io_layouts && io_data_offsets == rhs.io_data_offsets &&
+               master_shape == rhs.master_shape && buffer_scratchpad_size == rhs.buffer_scratchpad_size &&
+               buffer_cluster_offsets == rhs.buffer_cluster_offsets;
+    }
+
+    // writes all the fields of the key, the code persisted in the cache directory is looked up by them
+    void serialize(std::ostream& stream) const {
+        auto write_dims = [&stream](const VectorDims& dims) {
+            stream << " [";
+            for (const auto dim : dims) {
+                stream << ' ' << dim;
+            }
+            stream << " ]";
+        };
+        auto write_dims_list = [&stream, &write_dims](const std::vector<VectorDims>& list) {
+            stream << ' ' << list.size();
+            std::for_each(list.begin(), list.end(), write_dims);
+        };
+        auto write_precisions = [&stream](const std::vector<ov::element::Type>& precisions) {
+            stream << ' ' << precisions.size();
+            for (const auto& precision : precisions) {
+                stream << ' ' << precision;
+            }
+        };
+        const auto& attrs = *code_key.attrs;
+        stream << " body " << attrs.bodyHash;
+        write_dims_list(attrs.inMemOrders);
+        write_dims_list(attrs.outMemOrders);
+        write_precisions(attrs.inMemPrecs);
+        write_precisions(attrs.outMemPrecs);
+        stream << " broadcasting " << code_key.broadcasting_mask << " isa " << isa << " precision " << precision
+               << " brgemm_tuning " << brgemm_tuning << " ranks " << tensor_rank << ' ' << tile_rank;
+        write_dims_list(io_shapes);
+        write_dims_list(io_layouts);
+        write_dims_list(io_data_offsets);
+        write_dims(master_shape);
+        stream << " buffer " << buffer_scratchpad_size;
+        write_dims(buffer_cluster_offsets);
+    }
+
+    // the key outlives the compiled model it was created by, so it keeps the attributes without the subgraph body,
+    // which is not a part of the key anyway
+    static SubgraphCodeGeneratorKey detach(const SubgraphCodeGeneratorKey& key) {
+        auto attrs = std::make_shared<SubgraphAttrs>(*key.attrs);
+        attrs->snippet = nullptr;
+        return {attrs, static_cast<uint8_t>(key.broadcasting_mask)};
+    }
+
+    SubgraphCodeGeneratorKey code_key;
+    int isa = 0;
+    ov::element::Type precision;
+    // the Brgemm blocking is a part of the generated code, which is tuned only with snippets_brgemm_tuning
+    bool brgemm_tuning = false;
+    size_t tensor_rank = 0;
+    size_t tile_rank = 0;
+    std::vector<VectorDims> io_shapes;
+    std::vector<VectorDims> io_layouts;
+    std::vector<VectorDims> io_data_offsets;
+    VectorDims master_shape;
+    size_t buffer_scratchpad_size = 0;
+    std::vector<size_t> buffer_cluster_offsets;
+};
+
+// Number of the generated kernels kept in the shared cache, it doesn't depend on the compiled models using the cache
+constexpr size_t SHARED_CODE_CACHE_CAPACITY = 1024;
+
+/**
+ * @brief Process wide cache of the code generated for the subgraphs of static shapes, which is shared between the
+ * compiled models created with ov::intel_cpu::snippets_shared_code_cache. The code of the dynamic subgraphs stays in
+ * the caches of the compiled models as its kernel executors are updated for every new shape.
+ */
+const MultiCachePtr& getSharedCodeCache() {
+    static const auto cache = std::make_shared<MultiCache>(SHARED_CODE_CACHE_CAPACITY, true);
+    return cache;
+}
+
+#    if defined(OPENVINO_ARCH_X86_64) && !defined(SNIPPETS_DEBUG_CAPS)
+// Version of the layout of the code files, a file of another version is not read
+constexpr uint32_t CODE_FILE_VERSION = 1;
+
+/**
+ * @brief The key of the code persisted in the cache directory. Besides the fields of the shared cache key it identifies
+ * the build, which defines the lowering and the emitters, and the features of the CPU, as the emitters choose the
+ * instructions by the features beyond the host ISA.
+ */
+std::string getCodeFileKey(const SubgraphSharedCodeKey& key) {
+    using namespace dnnl::impl::cpu::x64;
+    std::ostringstream stream;
+    stream << "snippets_code " << CODE_FILE_VERSION << ' ' << ov::get_openvino_version().buildNumber << " features";
+    for (const auto feature : {sse41,
+                               avx,
+                               avx2,
+                               avx2_vnni,
+                               avx2_vnni_2,
+                               avx512_core,
+                               avx512_core_vnni,
+                               avx512_core_bf16,
+                               avx512_core_fp16,
+                               avx512_core_amx,
+                               avx512_core_amx_fp16}) {
+        stream << ' ' << mayiuse(feature);
+    }
+    key.serialize(stream);
+    return stream.str();
+}
+
+/**
+ * @brief Reads the code written by writeCodeFile()
+ * @return nullptr if the file is absent, damaged or written for another key, the code is generated then
+ */
+std::shared_ptr<SubgraphCodeGenerator> readCodeFile(const std::string& file, const std::string& key) {
+    std::ifstream stream(file, std::ios::binary);
+    uint64_t key_size = 0;
+    if (!stream.read(reinterpret_cast<char*>(&key_size), sizeof(key_size)) || key_size != key.size()) {
+        return nullptr;
+    }
+    std::string file_key(key.size(), '\0');
+    if (!stream.read(file_key.data(), static_cast<std::streamsize>(file_key.size())) || file_key != key) {
+        return nullptr;
+    }
+    snippets::LoweringResult result;
+    result.compiled_snippet = CompiledSnippetCPU::read(stream);
+    if (!result.compiled_snippet) {
+        return nullptr;
+    }
+    // the code which is written doesn't call any kernel, see CompiledSnippetCPU::write()
+    result.kernel_executor_table = std::make_shared<snippets::KernelExecutorTable>();
+    return std::make_shared<SubgraphCodeGenerator>(std::make_shared<snippets::Schedule>(std::move(result)));
+}
+
+/**
+ * @brief Writes the code to the file which starts with the key. The file is written under a temporary name and
+ * renamed, so the concurrent readers never see a partial file. Failures are ignored: the file is only an optimization,
+ * the code is generated again without it.
+ */
+void writeCodeFile(const std::string& file, const std::string& key, const SubgraphCodeGenerator& code) {
+    const auto compiled = std::dynamic_pointer_cast<CompiledSnippetCPU>(code.get()->lowering_result.compiled_snippet);
+    if (!compiled) {
+        return;
+    }
+    std::ostringstream data;
+    const auto key_size = static_cast<uint64_t>(key.size());
+    data.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+    data << key;
+    if (!compiled->write(data)) {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(file).parent_path(), ec);
+    const auto tmp_file = file + uniqueTmpFileSuffix();
+    {
+        std::ofstream stream(tmp_file, std::ios::binary | std::ios::trunc);
+        stream << data.str();
+        stream.close();
+        if (!stream) {
+            std::remove(tmp_file.c_str());
+            return;
+        }
+    }
+    std::filesystem::rename(tmp_file, file, ec);
+    if (ec) {
+        std::remove(tmp_file.c_str());
+    }
+}
+#    endif
+
+/**
+ * @brief Generates the code of the shared cache. With the cache directory the code is read from the directory if it
+ * was generated for the same key by any process before, and the generated code is written there.
+ */
+std::shared_ptr<SubgraphCodeGenerator> getSharedCode(const SubgraphSharedCodeKey& key,
+                                                     const std::shared_ptr<SubgraphAttrs>& attrs,
+                                                     const std::shared_ptr<CPURuntimeConfig>& config,
+                                                     [[maybe_unused]] const std::string& cache_dir) {
+#    if defined(OPENVINO_ARCH_X86_64) && !defined(SNIPPETS_DEBUG_CAPS)
+    // the debug capabilities embed the addresses of the counters into the code, so it's never persisted with them
+    if (!cache_dir.empty()) {
+        const auto file_key = getCodeFileKey(key);
+        std::ostringstream name;
+        name << "snippets_" << std::hex << std::hash<std::string>{}(file_key) << ".code";
+        const auto file = (std::filesystem::path(cache_dir) / name.str()).string();
+        if (auto code = readCodeFile(file, file_key)) {
+            return code;
+        }
+        auto code = std::make_shared<SubgraphCodeGenerator>(attrs, config);
+        writeCodeFile(file, file_key, *code);
+        return code;
+    }
+#    endif
+    return std::make_shared<SubgraphCodeGenerator>(attrs, config);
+}
 #endif
 
 struct SubgraphShapeInferResultKey {
@@ -179,6 +424,14 @@ Subgraph::Subgraph(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr
     is_dynamic = isDynamicNgraphNode(op);
 }
 
+CacheStatistics Subgraph::getSharedCodeCacheStatistics() {
+#if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
+    return getSharedCodeCache()->getStatistics();
+#else
+    return {};
+#endif
+}
+
 uint64_t Subgraph::getBodyHash(const std::shared_ptr<snippets::op::Subgraph>& snippet) {
     uint64_t seed = 0;
     ov::snippets::pass::Hash hash_function(seed);
@@ -578,7 +831,9 @@ Subgraph::ControlFlowPasses Subgraph::getControlFlowPasses() {
 
     SNIPPETS_REGISTER_PASS_RELATIVE_X86_64(Place::After,
                                            ov::snippets::lowered::pass::MarkLoops,
-                                           ov::intel_cpu::pass::BrgemmCPUBlocking);
+                                           ov::intel_cpu::pass::BrgemmCPUBlocking,
+                                           context->getConfig().snippetsBrgemmTuning,
+                                           context->getConfig().snippetsBrgemmTuningFile);
 #ifdef SNIPPETS_DEBUG_CAPS
     const auto& debug_config = subgraph_attrs->snippet->get_debug_config();
     if (debug_config.perf_count_mode != snippets::DebugCapsConfig::PerfCountMode::Disabled) {
@@ -711,9 +966,14 @@ void Subgraph::prepareWeights() {
 
 void Subgraph::prepareParams() {
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
+    // the shape inference, which updates the blocked shapes, is skipped for the input shapes known to the graph
+    initPluginBlockedShapes();
     const auto& cache = context->getParamsCache();
+    // The executors own the scratchpad of the stream, and the dynamic code is bound to the kernel executor table
+    // which is updated for every new shape, so they are never shared between the streams
+    const auto& streamCache = context->getStreamParamsCache();
 
-    auto builder = [this, &cache](const SubgraphKey& key) -> std::shared_ptr<SubgraphBaseExecutor> {
+    auto builder = [this, &cache, &streamCache](const SubgraphKey& key) -> std::shared_ptr<SubgraphBaseExecutor> {
         const auto& snippet = subgraph_attrs->snippet;
 
         SubgraphBaseExecutor::BufferScratchpadAllocator allocator = [this](size_t size) {
@@ -726,7 +986,7 @@ void Subgraph::prepareParams() {
             // 2. Update runtime config with dynamic values
             //    If JIT code has been taken from cache, need to set cached kernel executor table for the configuration
             // 3. Create SubgraphDynamicSpecializedExecutor
-            const auto code_gen_result = cache->getOrCreate(
+            const auto code_gen_result = streamCache->getOrCreate(
                 SubgraphCodeGeneratorKey(subgraph_attrs, getBroadcastingMask(in_shapes)),
                 [](const SubgraphCodeGeneratorKey& key) -> std::shared_ptr<SubgraphCodeGenerator> {
                     return std::make_shared<SubgraphCodeGenerator>(key.attrs, std::make_shared<CPURuntimeConfig>());
@@ -745,28 +1005,48 @@ void Subgraph::prepareParams() {
                                                                         start_offset_in,
                                                                         start_offset_out,
                                                                         allocator,
-                                                                        cache);
+                                                                        streamCache);
         }  // Static case:
         // 1. Update runtime config to get static scheduling data (io data offsets, parallel domain) which will be
         // compiled in JIT code
         // 2. Generate JIT code with this static data if needed
         // 3. Create SubgraphStaticExecutor
         const auto& snippet_config = ov::as_type_ptr<CPURuntimeConfig>(snippet->update_runtime_config());
-        const auto code_gen_result = cache->getOrCreate(
-            SubgraphCodeGeneratorKey(subgraph_attrs, getBroadcastingMask(in_shapes)),
-            [&snippet_config](const SubgraphCodeGeneratorKey& key) -> std::shared_ptr<SubgraphCodeGenerator> {
-                return std::make_shared<SubgraphCodeGenerator>(key.attrs, snippet_config);
-            });
+        SubgraphCodeGeneratorKey code_key(subgraph_attrs, getBroadcastingMask(in_shapes));
+        std::shared_ptr<SubgraphCodeGenerator> code_gen;
+        if (context->getConfig().snippetsSharedCodeCache) {
+            // the body is taken from the attributes of this node, the key doesn't keep it
+            code_gen = getSharedCodeCache()
+                           ->getOrCreate(SubgraphSharedCodeKey(code_key,
+                                                               static_cast<int>(host_isa),
+                                                               context->getConfig().inferencePrecision,
+                                                               context->getConfig().snippetsBrgemmTuning,
+                                                               *snippet_config),
+                                         [&](const SubgraphSharedCodeKey& shared_key) {
+                                             return getSharedCode(shared_key,
+                                                                  code_key.attrs,
+                                                                  snippet_config,
+                                                                  context->getConfig().snippetsCodeCacheDir);
+                                         })
+                           .first;
+        } else {
+            code_gen = cache->getOrCreate(code_key,
+                                          [&snippet_config](const SubgraphCodeGeneratorKey& key)
+                                              -> std::shared_ptr<SubgraphCodeGenerator> {
+                                              return std::make_shared<SubgraphCodeGenerator>(key.attrs, snippet_config);
+                                          })
+                           .first;
+        }
         return std::make_shared<SubgraphStaticExecutor>(snippet_config,
                                                         key.attrs,
-                                                        code_gen_result.first,
+                                                        code_gen,
                                                         start_offset_in,
                                                         start_offset_out,
                                                         allocator,
-                                                        cache);
+                                                        streamCache);
     };
 
-    const auto result = cache->getOrCreate(SubgraphKey(subgraph_attrs, in_shapes), builder);
+    const auto result = streamCache->getOrCreate(SubgraphKey(subgraph_attrs, in_shapes), builder);
     execPtr = result.first;
 #endif
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "cache/cache_entry.h"
 #include "executors/subgraph.hpp"
 #include "node.h"
 
@@ -37,6 +38,9 @@ public:
     void execute(const dnnl::stream& strm) override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
+    // lookups of the code cache shared between the compiled models with ov::intel_cpu::snippets_shared_code_cache
+    static CacheStatistics getSharedCodeCacheStatistics();
+
 protected:
     IShapeInfer::Result shapeInfer() const override;
 
@@ -4,6 +4,8 @@
 
 #include "tensoriterator.h"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <string>
 #include <utility>
@@ -74,6 +76,55 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+// The body input memory may be bound to an external buffer if the body neither modifies nor shares it in-place
+// (the same checks as for the input tensors set to the infer request)
+static bool canBindBodyInput(const NodePtr& input) {
+    for (const auto& edge : input->getChildEdgesAtPort(0)) {
+        const auto& child = edge->getChild();
+        if (child->isConstant() || edge->inPlace(Edge::LOOK_DOWN) || edge->modifiedInPlace() ||
+            (child->getType() == Type::Concatenation && child->isInPlace())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The body output memory may be bound to an external buffer if it belongs to the body output only
+// (the same checks as for the output tensors set to the infer request) and isn't shared with a body input
+static bool canBindBodyOutput(const NodePtr& output) {
+    const auto parentEdge = output->getParentEdgeAt(0);
+    auto parent = parentEdge->getParent();
+    auto parent_port = parentEdge->getInputNum();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getType() == Type::Input || parent->isConstant() ||
+            parent->getChildEdgesAtPort(parent_port).size() != 1 ||
+            parent->getChildEdgeAt(parent_port)->inPlace(Edge::LOOK_UP)) {
+            return false;
+        }
+        for (const auto& edge : parent->getParentEdges()) {
+            const auto e = edge.lock();
+            if (e && parent_port == parent->inPlaceInputPort(e->getOutputNum())) {
+                parent = e->getParent();
+                parent_port = e->getInputNum();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
+// The chunk of the sliced port is dense when all the dims before the iteration axis are units
+static bool isDenseChunk(const MemoryPtr& full, const MemoryPtr& part, const PortMap& slice_rule) {
+    const auto& full_dims = full->getStaticDims();
+    return full->getDesc().hasLayoutType(LayoutType::ncsp) && part->getDesc().hasLayoutType(LayoutType::ncsp) &&
+           full->getDesc().getPrecision() == part->getDesc().getPrecision() &&
+           std::all_of(full_dims.begin(), full_dims.begin() + slice_rule.axis, [](size_t dim) {
+               return dim == 1;
+           });
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(const MultiCachePtr& cache,
@@ -162,6 +213,89 @@ public:
     }
 };
 
+/**
+ * Binds the body memory directly to the chunk of the outer tensor processed on the current iteration, so the data
+ * isn't copied. Applicable to the sliced ports when the chunk is dense.
+ */
+class PortViewHelper : public PortMapHelper {
+public:
+    PortViewHelper(MemoryPtr full, const std::vector<MemoryPtr>& body_mems, const PortMap& slice_rule)
+        : full_mem(std::move(full)) {
+        const auto abs_stride = std::abs(slice_rule.stride);
+        iter_count = static_cast<int>(full_mem->getStaticDims()[slice_rule.axis] / abs_stride);
+
+        chunk_size_in_byte = body_mems.front()->getSize();
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_size_in_byte : 0;
+        chunk_stride_in_byte = slice_rule.stride < 0 ? -static_cast<ptrdiff_t>(chunk_size_in_byte)
+                                                     : static_cast<ptrdiff_t>(chunk_size_in_byte);
+
+        for (const auto& mem : body_mems) {
+            auto block = mem->getMemoryBlock();
+            if (std::find(body_blocks.begin(), body_blocks.end(), block) == body_blocks.end()) {
+                body_blocks.push_back(std::move(block));
+            }
+        }
+    }
+
+    void execute([[maybe_unused]] const dnnl::stream& strm, int iter) override {
+        OPENVINO_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto* chunk = full_mem->getDataAs<uint8_t>() + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (const auto& block : body_blocks) {
+            block->setExtBuff(chunk, chunk_size_in_byte);
+        }
+    }
+
+private:
+    MemoryPtr full_mem;
+    std::vector<MemoryBlockPtr> body_blocks;
+
+    size_t chunk_size_in_byte = 0;
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    int iter_count = 0;
+};
+
+/**
+ * Passes the body output to the body input of the next iteration by swapping two buffers between them
+ * instead of copying the data.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const dnnl::engine& eng, const MemoryPtr& from, const std::vector<MemoryPtr>& to)
+        : buffers{std::make_shared<Memory>(eng, to.front()->getDescPtr()),
+                  std::make_shared<Memory>(eng, from->getDescPtr())},
+          from_block(from->getMemoryBlock()) {
+        for (const auto& mem : to) {
+            auto block = mem->getMemoryBlock();
+            if (std::find(to_blocks.begin(), to_blocks.end(), block) == to_blocks.end()) {
+                to_blocks.push_back(std::move(block));
+            }
+        }
+        bind();
+    }
+
+    void execute([[maybe_unused]] const dnnl::stream& strm, int iter) override {
+        if (iter != 0) {
+            std::swap(buffers[0], buffers[1]);
+            bind();
+        }
+    }
+
+private:
+    void bind() {
+        for (const auto& block : to_blocks) {
+            block->setExtBuff(buffers[0]->getData(), buffers[0]->getSize());
+        }
+        from_block->setExtBuff(buffers[1]->getData(), buffers[1]->getSize());
+    }
+
+    std::array<MemoryPtr, 2> buffers;  // the buffers bound to the body input and to the body output respectively
+    MemoryBlockPtr from_block;
+    std::vector<MemoryBlockPtr> to_blocks;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MemoryPtr& to, [[maybe_unused]] const dnnl::engine& eng) {
@@ -724,6 +858,9 @@ void TensorIterator::prepareInputPorts() {
         if (map_rule.axis == -1) {
             first_mappers.emplace(std::make_pair(map_rule.from, map_rule.to),
                                   std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        } else if (isDenseChunk(from_mem, to_mem, map_rule) &&
+                   canBindBodyInput(sub_graph.getInputNodeByIndex(map_rule.to))) {
+            before_mappers.emplace_back(std::make_shared<PortViewHelper>(from_mem, input_mems[map_rule.to], map_rule));
         } else {
             before_mappers.emplace_back(
                 std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
@@ -733,6 +870,7 @@ void TensorIterator::prepareInputPorts() {
 
 void TensorIterator::prepareOutputPorts() {
     const auto& eng = getEngine();
+    boundBodyOutputs.clear();
     for (auto map_rule : outputPortMap) {
         auto to_mem = getDstMemoryAtPort(map_rule.from);
         auto& from_mem = output_mem[map_rule.to];
@@ -740,6 +878,12 @@ void TensorIterator::prepareOutputPorts() {
         if (map_rule.axis == -1) {
             last_mappers.emplace_back(
                 std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        } else if (!boundBodyOutputs.count(map_rule.to) && isDenseChunk(to_mem, from_mem, map_rule) &&
+                   canBindBodyOutput(sub_graph.getOutputNodeByIndex(map_rule.to))) {
+            // the body writes the iteration result directly to the outer tensor
+            before_mappers.emplace_back(
+                std::make_shared<PortViewHelper>(to_mem, std::vector<MemoryPtr>{from_mem}, map_rule));
+            boundBodyOutputs.insert(map_rule.to);
         } else {
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(),
                                                                             from_mem,
@@ -752,11 +896,22 @@ void TensorIterator::prepareOutputPorts() {
 }
 
 void TensorIterator::prepareBackEdges() {
+    const auto& eng = getEngine();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        const bool canSwap = !boundBodyOutputs.count(map_rule.from) && from_mem->getData() != to_mem->getData() &&
+                             from_mem->getDesc().isCompatible(to_mem->getDesc()) &&
+                             canBindBodyInput(sub_graph.getInputNodeByIndex(map_rule.to)) &&
+                             canBindBodyOutput(sub_graph.getOutputNodeByIndex(map_rule.from));
+        if (canSwap) {
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(eng, from_mem, input_mems[map_rule.to]));
+            boundBodyOutputs.insert(map_rule.from);
+        } else {
+            before_mappers.emplace_back(
+                std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem));
+        }
     }
 }
 
@@ -10,6 +10,7 @@
 #include <common/memory_desc_wrapper.hpp>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace ov {
@@ -188,6 +189,8 @@ private:
 
     std::vector<std::shared_ptr<DynamicBuffer>> buffers;
 
+    std::unordered_set<int> boundBodyOutputs;  //!< Body outputs bound to the outer tensors or to the back edge buffers
+
     std::vector<PortMap> inputPortMap;   //!< Input ports map
     std::vector<PortMap> outputPortMap;  //!< Output ports map
     std::vector<PortMap> backEdges;      //!< Back edges map
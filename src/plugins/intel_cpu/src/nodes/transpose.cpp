@@ -194,7 +194,8 @@ void Transpose::prepareParams() {
         return executor;
     };
 
-    auto cache = context->getParamsCache();
+    // some executors (e.g. ACL) bind the tensors of the call, so they are never shared between the streams
+    auto cache = context->getStreamParamsCache();
     auto result = cache->getOrCreate(transposeParams.permuteParams, builder);
 
     if (!result.first) {
@@ -0,0 +1,329 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "paged_mem_blk.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "openvino/core/except.hpp"
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+#    define PAGED_MEMORY_COW
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+#ifndef _WIN32
+// Committed memory is private anonymous memory, its pages are backed by physical memory on the first access
+void mapPrivate(void* ptr, size_t size) {
+    void* res = mmap(ptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+    OPENVINO_ASSERT(res != MAP_FAILED, "Failed to allocate ", size, " bytes of memory");
+}
+
+// Replaces the mapping with inaccessible reserved range, the pages are freed unless a snapshot keeps them
+void unmapPrivate(void* ptr, size_t size) {
+    mmap(ptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+}
+#endif
+}  // namespace
+
+#ifdef PAGED_MEMORY_COW
+// Read-only copy of a part of a block kept in an anonymous file. Nobody writes to the file, the blocks map it
+// privately, so the kernel copies a page on the first write to it.
+struct PagedMemoryBlock::Snapshot {
+    explicit Snapshot(int fd) : fd(fd) {}
+    ~Snapshot() {
+        close(fd);
+    }
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+
+    int fd;
+};
+#endif
+
+PagedMemoryBlock::PagedMemoryBlock(size_t block_size, size_t reserve_size) {
+    const size_t page = pageSize();
+    m_block_size = std::max<size_t>(1, (block_size + page - 1) / page) * page;
+    m_min_reserve = roundUp(reserve_size);
+}
+
+PagedMemoryBlock::~PagedMemoryBlock() {
+    if (m_data) {
+        unreserve(m_data, m_reserved);
+    }
+}
+
+void* PagedMemoryBlock::getRawPtr() const noexcept {
+    return m_data;
+}
+
+void PagedMemoryBlock::setExtBuff([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) {
+    OPENVINO_THROW("PagedMemoryBlock doesn't support external buffers");
+}
+
+bool PagedMemoryBlock::resize(size_t size) {
+    if (size <= m_committed) {
+        return false;
+    }
+    const size_t required = roundUp(size);
+    if (required > m_reserved) {
+        // out of the reserved range, the only case when the data is moved
+        relocate(required);
+        return true;
+    }
+    commit(required);
+    m_committed = required;
+    return false;
+}
+
+bool PagedMemoryBlock::hasExtBuffer() const noexcept {
+    return false;
+}
+
+void PagedMemoryBlock::release(size_t size) {
+    const size_t keep = roundUp(size);
+    if (keep >= m_committed) {
+        return;
+    }
+    decommit(keep);
+    m_committed = keep;
+}
+
+size_t PagedMemoryBlock::share(PagedMemoryBlock& src, size_t shared_size, size_t size) {
+    OPENVINO_ASSERT(size <= src.m_committed, "Source memory block is smaller than ", size, " bytes");
+    OPENVINO_ASSERT(roundUp(size) <= m_reserved, "Memory block has no room for ", size, " bytes");
+    release();
+    resize(size);
+    auto* dst_data = static_cast<uint8_t*>(m_data);
+    const auto* src_data = static_cast<const uint8_t*>(src.m_data);
+    size_t shared = 0;
+#ifdef PAGED_MEMORY_COW
+    // The parts of the source which are already in a snapshot and were not written since then are mapped as they are,
+    // the rest is moved to new snapshots. The source keeps its content, only the pages behind it change.
+    const size_t end = std::min(shared_size, size) / pageSize() * pageSize();
+    std::vector<SharedRange> ranges;
+    auto it = src.m_shared.begin();
+    while (shared < end) {
+        while (it != src.m_shared.end() && it->offset + it->size <= shared) {
+            it++;
+        }
+        const bool in_snapshot = it != src.m_shared.end() && it->offset <= shared;
+        size_t next = end;
+        if (it != src.m_shared.end()) {
+            next = std::min(in_snapshot ? it->offset + it->size : it->offset, end);
+        }
+        SharedRange range{shared, next - shared, nullptr, 0};
+        if (in_snapshot) {
+            range.snapshot = it->snapshot;
+            range.snapshot_offset = it->snapshot_offset + (shared - it->offset);
+        }
+        if (!in_snapshot || !src.isUnmodified(range)) {
+            range = src.takeSnapshot(range.offset, range.size);
+            if (!range.snapshot) {
+                // the system is out of file descriptors or doesn't allow anonymous files, the rest is copied
+                break;
+            }
+        }
+        ranges.push_back(range);
+        shared = next;
+    }
+
+    for (const auto& range : ranges) {
+        mapSnapshot(range);
+    }
+    m_shared = ranges;
+
+    // the parts of the source beyond the new snapshots are kept
+    for (const auto& range : src.m_shared) {
+        if (range.offset + range.size <= shared) {
+            continue;
+        }
+        ranges.push_back(range);
+        if (range.offset < shared) {
+            ranges.back().snapshot_offset += shared - range.offset;
+            ranges.back().size -= shared - range.offset;
+            ranges.back().offset = shared;
+        }
+    }
+    src.m_shared = std::move(ranges);
+#endif
+    std::memcpy(dst_data + shared, src_data + shared, size - shared);
+    return shared;
+}
+
+#ifdef PAGED_MEMORY_COW
+void PagedMemoryBlock::mapSnapshot(const SharedRange& range) {
+    void* res = mmap(static_cast<uint8_t*>(m_data) + range.offset,
+                     range.size,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_FIXED,
+                     range.snapshot->fd,
+                     static_cast<off_t>(range.snapshot_offset));
+    OPENVINO_ASSERT(res != MAP_FAILED, "Failed to map ", range.size, " bytes of shared memory");
+}
+
+PagedMemoryBlock::SharedRange PagedMemoryBlock::takeSnapshot(size_t offset, size_t size) {
+    SharedRange range{offset, size, nullptr, 0};
+    const int fd = memfd_create("ov_paged_memory", MFD_CLOEXEC);
+    if (fd < 0) {
+        return range;
+    }
+    auto snapshot = std::make_shared<Snapshot>(fd);
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        return range;
+    }
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (ptr == MAP_FAILED) {
+        return range;
+    }
+    std::memcpy(ptr, static_cast<uint8_t*>(m_data) + offset, size);
+    munmap(ptr, size);
+    // the pages of the block are replaced by the snapshot, so the data is kept in memory once
+    range.snapshot = std::move(snapshot);
+    mapSnapshot(range);
+    return range;
+}
+
+bool PagedMemoryBlock::isUnmodified(const SharedRange& range) const {
+    // opened on every call: the descriptor refers to the address space of the opening process, so a descriptor kept
+    // open by the parent would show the pages of the parent to a forked child
+    const int pagemap = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    if (pagemap < 0) {
+        return false;
+    }
+    const size_t page = pageSize();
+    std::vector<uint64_t> entries(range.size / page);
+    const size_t first = (reinterpret_cast<uintptr_t>(m_data) + range.offset) / page;
+    const auto bytes = static_cast<ssize_t>(entries.size() * sizeof(uint64_t));
+    const bool complete = pread(pagemap, entries.data(), bytes, static_cast<off_t>(first * sizeof(uint64_t))) == bytes;
+    close(pagemap);
+    if (!complete) {
+        return false;
+    }
+    // a page written after it was mapped is replaced by an anonymous one, which is either present or swapped out
+    constexpr uint64_t present = uint64_t(1) << 63;
+    constexpr uint64_t swapped = uint64_t(1) << 62;
+    constexpr uint64_t file_page = uint64_t(1) << 61;
+    return std::all_of(entries.begin(), entries.end(), [](uint64_t entry) {
+        return (entry & file_page) || !(entry & (present | swapped));
+    });
+}
+#endif
+
+void PagedMemoryBlock::commit(size_t size) {
+#ifdef _WIN32
+    const size_t commit_size = size - m_committed;
+    void* res = VirtualAlloc(static_cast<uint8_t*>(m_data) + m_committed, commit_size, MEM_COMMIT, PAGE_READWRITE);
+    OPENVINO_ASSERT(res, "Failed to allocate ", commit_size, " bytes of memory");
+#else
+    if (size <= m_mapped) {
+        return;
+    }
+    const size_t mapped = std::min(m_reserved, std::max(size, 2 * m_mapped));
+    mapPrivate(static_cast<uint8_t*>(m_data) + m_mapped, mapped - m_mapped);
+    m_mapped = mapped;
+#endif
+}
+
+void PagedMemoryBlock::decommit(size_t size) {
+#ifdef _WIN32
+    VirtualFree(static_cast<uint8_t*>(m_data) + size, m_committed - size, MEM_DECOMMIT);
+#else
+    if (size >= m_mapped) {
+        return;
+    }
+    unmapPrivate(static_cast<uint8_t*>(m_data) + size, m_mapped - size);
+    m_mapped = size;
+    m_shared.erase(std::find_if(m_shared.begin(),
+                                m_shared.end(),
+                                [size](const SharedRange& range) {
+                                    return range.offset >= size;
+                                }),
+                   m_shared.end());
+    if (!m_shared.empty()) {
+        auto& last = m_shared.back();
+        last.size = std::min(last.size, size - last.offset);
+    }
+#endif
+}
+
+void PagedMemoryBlock::relocate(size_t size) {
+    const size_t new_reserved = std::max({m_min_reserve, 2 * m_reserved, 2 * size});
+    void* old_data = m_data;
+    const size_t old_reserved = m_reserved;
+    const size_t old_committed = m_committed;
+    const size_t old_mapped = m_mapped;
+    auto old_shared = std::move(m_shared);
+
+    m_data = reserve(new_reserved);
+    m_reserved = new_reserved;
+    m_committed = 0;
+    m_mapped = 0;
+    m_shared.clear();
+    try {
+        commit(size);
+    } catch (...) {
+        unreserve(m_data, m_reserved);
+        m_data = old_data;
+        m_reserved = old_reserved;
+        m_committed = old_committed;
+        m_mapped = old_mapped;
+        m_shared = std::move(old_shared);
+        throw;
+    }
+    m_committed = size;
+    if (old_data) {
+        std::memcpy(m_data, old_data, old_committed);
+        unreserve(old_data, old_reserved);
+    }
+}
+
+size_t PagedMemoryBlock::pageSize() {
+#ifdef _WIN32
+    static const size_t page = [] {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return static_cast<size_t>(info.dwPageSize);
+    }();
+#else
+    static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    return page;
+}
+
+void* PagedMemoryBlock::reserve(size_t size) {
+#ifdef _WIN32
+    void* ptr = VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+    OPENVINO_ASSERT(ptr, "Failed to reserve ", size, " bytes of address space");
+#else
+    void* ptr = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    OPENVINO_ASSERT(ptr != MAP_FAILED, "Failed to reserve ", size, " bytes of address space");
+#endif
+    return ptr;
+}
+
+void PagedMemoryBlock::unreserve(void* ptr, [[maybe_unused]] size_t size) {
+#ifdef _WIN32
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munmap(ptr, size);
+#endif
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,113 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "cpu_memory.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief A memory block that grows in place by blocks of a fixed size.
+ * A range of virtual address space is reserved up front and physical memory is committed block by block on resize,
+ * so growing the buffer never moves the data already stored in it. Committed blocks can be returned to the system
+ * without releasing the reservation. The data is moved only when the requested size exceeds the reserved range, then
+ * the new reservation is at least twice as big as the old one.
+ * Pages of one block can be shared with another one copy-on-write (see share()), so a KV cache prefix is stored once
+ * for several owners.
+ */
+class PagedMemoryBlock : public IMemoryBlock {
+public:
+    /**
+     * @param block_size - commit granularity in bytes, rounded up to the system page size
+     * @param reserve_size - minimal size of the reserved address range in bytes, the range is reserved on the first
+     * resize and is at least twice as big as the requested size
+     */
+    explicit PagedMemoryBlock(size_t block_size, size_t reserve_size = default_reserve_size);
+    ~PagedMemoryBlock() override;
+
+    PagedMemoryBlock(const PagedMemoryBlock&) = delete;
+    PagedMemoryBlock& operator=(const PagedMemoryBlock&) = delete;
+
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+    /**
+     * @brief Returns committed blocks which are not needed to keep the first size bytes to the system
+     * @param size - number of bytes to keep, the content of the released blocks is lost
+     */
+    void release(size_t size = 0);
+
+    /**
+     * @brief Replaces the content of the block with the first size bytes of the source block. Where the system allows
+     * it, the whole pages below shared_size are not copied: they are moved to a read-only snapshot which both blocks
+     * map privately, so the physical memory is shared until one of the blocks writes a page, then the page is copied
+     * (copy-on-write). The rest is copied. The reserved range must be big enough to keep size bytes, so the block is
+     * never moved by this call.
+     * @param src - source block, must have at least size bytes committed, its content is not changed
+     * @param shared_size - number of bytes which are worth sharing, as they are not expected to be written again
+     * @param size - number of bytes to take from the source
+     * @return number of bytes shared with the source
+     */
+    size_t share(PagedMemoryBlock& src, size_t shared_size, size_t size);
+
+    size_t blockSize() const {
+        return m_block_size;
+    }
+    size_t committedSize() const {
+        return m_committed;
+    }
+    size_t reservedSize() const {
+        return m_reserved;
+    }
+
+    // address space is cheap on 64-bit systems, so reserve enough to never move a typical long context cache
+    static constexpr size_t default_reserve_size = sizeof(void*) == 8 ? (size_t(1) << 30) : 0;
+
+private:
+    static size_t pageSize();
+    static void* reserve(size_t size);
+    static void unreserve(void* ptr, size_t size);
+
+    void commit(size_t size);
+    void decommit(size_t size);
+    void relocate(size_t size);
+
+    struct Snapshot;
+    // Linux only: a part of the block which is a private mapping of a snapshot
+    struct SharedRange {
+        size_t offset;
+        size_t size;
+        std::shared_ptr<Snapshot> snapshot;
+        size_t snapshot_offset;
+    };
+    void mapSnapshot(const SharedRange& range);
+    SharedRange takeSnapshot(size_t offset, size_t size);
+    bool isUnmodified(const SharedRange& range) const;
+
+    size_t roundUp(size_t size) const {
+        return (size + m_block_size - 1) / m_block_size * m_block_size;
+    }
+
+    void* m_data = nullptr;
+    size_t m_block_size = 0;
+    size_t m_min_reserve = 0;
+    size_t m_reserved = 0;
+    size_t m_committed = 0;
+    // POSIX only: size of the mapped part of the reservation, which grows geometrically to keep the number of
+    // mappings low, its pages are backed by physical memory on the first access
+    size_t m_mapped = 0;
+    // Linux only: the parts of the block shared with other blocks, sorted by offset
+    std::vector<SharedRange> m_shared;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
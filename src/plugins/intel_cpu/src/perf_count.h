@@ -4,12 +4,128 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <ratio>
+#include <vector>
+
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Log-linear latency histogram in the spirit of HdrHistogram.
+ * Values below 2^sub_bucket_bits nanoseconds are counted exactly, every next power of two range is split into
+ * 2^sub_bucket_bits equal buckets, so the relative error of a reported value is below 2^-sub_bucket_bits (~3%).
+ * Recording is a couple of bit operations and an increment, the buckets are allocated on the first record.
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t sub_bucket_bits = 5;
+    static constexpr uint64_t sub_bucket_count = uint64_t(1) << sub_bucket_bits;
+    // values up to 2^max_exponent ns (~2.4 hours), longer ones are counted in the last bucket
+    static constexpr uint32_t max_exponent = 43;
+    static constexpr size_t bucket_count = (max_exponent - sub_bucket_bits + 1) * sub_bucket_count;
+
+    void record(uint64_t ns) {
+        if (m_counts.empty()) {
+            m_counts.resize(bucket_count, 0);
+        }
+        m_counts[bucket(ns)]++;
+        m_total++;
+        m_max = std::max(m_max, ns);
+    }
+
+    /**
+     * @brief Returns the value below or equal to which the given percent of the recorded values fall
+     * @param percent - percentile in range [0, 100]
+     */
+    uint64_t percentile(double percent) const {
+        if (m_total == 0) {
+            return 0;
+        }
+        const auto rank = static_cast<uint64_t>(std::clamp(percent, 0.0, 100.0) / 100.0 * static_cast<double>(m_total));
+        const uint64_t target = std::clamp<uint64_t>(rank, 1, m_total);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < m_counts.size(); i++) {
+            seen += m_counts[i];
+            if (seen >= target) {
+                return std::min(highest_equivalent(i), m_max);
+            }
+        }
+        return m_max;
+    }
+
+    uint64_t max() const {
+        return m_max;
+    }
+
+    uint64_t count() const {
+        return m_total;
+    }
+
+    void merge(const LatencyHistogram& other) {
+        if (other.m_total == 0) {
+            return;
+        }
+        if (m_counts.empty()) {
+            m_counts.resize(bucket_count, 0);
+        }
+        for (size_t i = 0; i < bucket_count; i++) {
+            m_counts[i] += other.m_counts[i];
+        }
+        m_total += other.m_total;
+        m_max = std::max(m_max, other.m_max);
+    }
+
+    void reset() {
+        std::fill(m_counts.begin(), m_counts.end(), 0);
+        m_total = 0;
+        m_max = 0;
+    }
+
+private:
+    static uint32_t msb(uint64_t value) {
+#if defined(_MSC_VER)
+        unsigned long index = 0;
+        _BitScanReverse64(&index, value);
+        return static_cast<uint32_t>(index);
+#else
+        return 63 - static_cast<uint32_t>(__builtin_clzll(value));
+#endif
+    }
+
+    static size_t bucket(uint64_t ns) {
+        if (ns < sub_bucket_count) {
+            return static_cast<size_t>(ns);
+        }
+        const uint64_t value = std::min(ns, (uint64_t(1) << max_exponent) - 1);
+        const uint32_t exponent = msb(value);
+        // the top sub_bucket_bits + 1 bits of the value, the highest one is always set
+        const uint64_t sub_bucket = value >> (exponent - sub_bucket_bits);
+        return static_cast<size_t>((exponent - sub_bucket_bits + 1) * sub_bucket_count + sub_bucket - sub_bucket_count);
+    }
+
+    static uint64_t highest_equivalent(size_t index) {
+        if (index < sub_bucket_count) {
+            return index;
+        }
+        const uint64_t shift = index / sub_bucket_count - 1;
+        const uint64_t lowest = (sub_bucket_count + index % sub_bucket_count) << shift;
+        return lowest + (uint64_t(1) << shift) - 1;
+    }
+
+    std::vector<uint64_t> m_counts;
+    uint64_t m_total = 0;
+    uint64_t m_max = 0;
+};
+
 class PerfCount {
     uint64_t total_duration;
     uint32_t num;
@@ -17,6 +133,8 @@ class PerfCount {
     std::chrono::high_resolution_clock::time_point __start = {};
     std::chrono::high_resolution_clock::time_point __finish = {};
 
+    std::unique_ptr<LatencyHistogram> histogram_;
+
 public:
     PerfCount() : total_duration(0), num(0) {}
 
@@ -31,6 +149,24 @@ public:
         return num;
     }
 
+    // latency histogram at nanosecond resolution is collected in addition to the average when enabled
+    void enable_histogram() {
+        if (!histogram_) {
+            histogram_ = std::make_unique<LatencyHistogram>();
+        }
+    }
+    const LatencyHistogram* histogram() const {
+        return histogram_.get();
+    }
+
+    void reset() {
+        total_duration = 0;
+        num = 0;
+        if (histogram_) {
+            histogram_->reset();
+        }
+    }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
@@ -40,6 +176,9 @@ private:
         __finish = std::chrono::high_resolution_clock::now();
         total_duration += std::chrono::duration_cast<std::chrono::microseconds>(__finish - __start).count();
         num++;
+        if (histogram_) {
+            histogram_->record(std::chrono::duration_cast<std::chrono::nanoseconds>(__finish - __start).count());
+        }
     }
 
     friend class PerfHelper;
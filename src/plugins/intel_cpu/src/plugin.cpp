@@ -4,10 +4,16 @@
 
 #include "plugin.h"
 
+#include <sstream>
+#include <unordered_map>
+
 #include "cpu_streams_calculation.hpp"
+#include "hash_builder.hpp"
 #include "internal_properties.hpp"
 #include "itt.h"
+#include "nodes/subgraph.h"
 #include "openvino/core/parallel.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/paged_attention.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
@@ -201,6 +207,133 @@ void Plugin::calculate_streams(Config& conf, const std::shared_ptr<ov::Model>& m
     }
 }
 
+namespace {
+/**
+ * Hashes the operations of a model with their connections, attributes, output types and shapes and the runtime info.
+ * The data of the constants is not read, their addresses are written to the stream instead.
+ */
+class TopologyHasher : public ov::AttributeVisitor {
+public:
+    explicit TopologyHasher(std::ostream& constants) : m_constants(constants) {}
+
+    void visit(const ov::Model& model) {
+        std::unordered_map<const ov::Node*, size_t> ids;
+        for (const auto& op : model.get_ordered_ops()) {
+            ids.emplace(op.get(), ids.size());
+            combine(std::string(op->get_type_info().name) + op->get_type_info().get_version());
+            for (const auto& input : op->inputs()) {
+                const auto source = input.get_source_output();
+                combine(ids.at(source.get_node()));
+                combine(source.get_index());
+            }
+            for (const auto& output : op->outputs()) {
+                combine(output.get_element_type().to_string());
+                combine(output.get_partial_shape().to_string());
+            }
+            for (const auto& [name, attr] : op->get_rt_info()) {
+                std::stringstream str;
+                attr.print(str);
+                combine(name + "=" + str.str());
+            }
+            if (const auto* constant = ov::as_type<const ov::op::v0::Constant>(op.get())) {
+                m_constants << constant->get_data_ptr() << ';';
+            } else {
+                op->visit_attributes(*this);
+            }
+        }
+    }
+
+    size_t get() const {
+        return m_seed;
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        if (auto* shape = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            combine(name + "=" + shape->get().to_string());
+        } else {
+            // the other opaque attributes are identified by the type, the weights cache keys describe the layout
+            combine(name + "=" + adapter.get_type_info().name);
+        }
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        combine(name + "=" + adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int>>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        combine(name);
+        combine(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        combine(name);
+        visit(*adapter.get());
+    }
+
+private:
+    template <typename T>
+    void combine(const T& value) {
+        m_seed = hash::combine(m_seed, value);
+    }
+
+    std::ostream& m_constants;
+    size_t m_seed = 0;
+};
+}  // namespace
+
+// The weights caches of a released compiled model are valid for the models with the same topology and the same
+// constant data objects, compiled with the same properties. The cache keys refer to the constants by address, and the
+// retained runtime model keeps the data alive, so an address can't be taken by other data while the caches are kept.
+// The data itself is not hashed, which would read all the weights on every compilation.
+static WeightsRetention::Ticket getWeightsRetentionTicket(const WeightsRetention::Ptr& retention,
+                                                          const std::shared_ptr<const ov::Model>& model,
+                                                          const ov::AnyMap& engine_properties,
+                                                          const ov::AnyMap& properties) {
+    std::stringstream constants;
+    TopologyHasher hasher(constants);
+    hasher.visit(*model);
+
+    std::stringstream key;
+    key << hasher.get() << "|" << constants.str() << "|";
+    for (const auto* props : {&engine_properties, &properties}) {
+        for (const auto& [name, value] : *props) {
+            key << ";" << name << "=";
+            try {
+                key << value.as<std::string>();
+            } catch (const ov::Exception&) {
+                // callbacks can't be printed, they don't change the weights
+            }
+        }
+        key << "|";
+    }
+    return WeightsRetention::Ticket{retention, key.str()};
+}
+
 static Config::ModelType getModelType(const std::shared_ptr<const Model>& model) {
     if (op::util::has_op_with_type<op::v1::Convolution>(model) ||
         op::util::has_op_with_type<op::v1::ConvolutionBackpropData>(model)) {
@@ -215,6 +348,17 @@ static Config::ModelType getModelType(const std::shared_ptr<const Model>& model)
     return Config::ModelType::Unknown;
 }
 
+// The code shared with ov::intel_cpu::snippets_shared_code_cache is also kept in the cache directory of the device,
+// next to the cached models
+static std::string getSnippetsCodeCacheDir(const std::shared_ptr<ov::ICore>& core,
+                                           const std::string& device_name,
+                                           const Config& conf) {
+    if (!conf.snippetsSharedCodeCache || !core) {
+        return {};
+    }
+    return core->get_property(device_name, ov::cache_dir);
+}
+
 std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
                                                           const ov::AnyMap& orig_config) const {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Plugin::compile_model");
@@ -250,6 +394,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
     Config conf = engConfig;
     conf.applyRtInfo(cloned_model);
     conf.readProperties(config, modelType);
+    conf.snippetsCodeCacheDir = getSnippetsCodeCacheDir(get_core(), get_device_name(), conf);
 
     Transformations transformations(cloned_model, conf);
 
@@ -299,7 +444,16 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
             denormals_as_zero(false);
         }
     }
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    WeightsRetention::Ticket weights_ticket;
+    if (conf.weightsCacheBudget > 0) {
+        weights_ticket = getWeightsRetentionTicket(m_weights_retention, model, m_engine_properties, config);
+    }
+    return std::make_shared<CompiledModel>(cloned_model,
+                                           shared_from_this(),
+                                           conf,
+                                           false,
+                                           nullptr,
+                                           std::move(weights_ticket));
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -308,6 +462,10 @@ void Plugin::set_property(const ov::AnyMap& config) {
     streamsExplicitlySetForEngine = streamsSet(config);
 
     engConfig.readProperties(config);
+    for (const auto& [name, value] : config) {
+        m_engine_properties[name] = value;
+    }
+    m_weights_retention->setBudget(engConfig.weightsCacheBudget);
 }
 
 ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options) const {
@@ -372,6 +530,26 @@ ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options)
     if (name == ov::log::level) {
         return engConfig.logLevel;
     }
+    if (name == ov::intel_cpu::weights_cache_budget) {
+        return static_cast<decltype(ov::intel_cpu::weights_cache_budget)::value_type>(engConfig.weightsCacheBudget);
+    }
+    if (name == ov::intel_cpu::snippets_shared_code_cache_statistics) {
+        const auto stats = node::Subgraph::getSharedCodeCacheStatistics();
+        return decltype(ov::intel_cpu::snippets_shared_code_cache_statistics)::value_type{
+            {"HITS", stats.hits},
+            {"MISSES", stats.misses},
+            {"EVICTIONS", stats.evictions}};
+    }
+    if (name == ov::intel_cpu::retained_weights_statistics) {
+        const auto stats = m_weights_retention->getStatistics();
+        return decltype(ov::intel_cpu::retained_weights_statistics)::value_type{
+            {"BUDGET", stats.budget},
+            {"RETAINED_SIZE", stats.retained_size},
+            {"LIVE_SIZE", stats.live_size},
+            {"RETAINED_MODELS", stats.retained_models},
+            {"REUSES", stats.reuses},
+            {"EVICTIONS", stats.evictions}};
+    }
     if (name == ov::internal::compiled_model_runtime_properties_supported.name()) {
         ov::Any res = true;
         auto it = options.find(ov::internal::compiled_model_runtime_properties.name());
@@ -620,10 +798,17 @@ std::shared_ptr<ov::ICompiledModel> Plugin::import_model(std::istream& model_str
         _config.erase(it);
     }
     conf.readProperties(_config, modelType);
+    conf.snippetsCodeCacheDir = getSnippetsCodeCacheDir(get_core(), get_device_name(), conf);
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model = std::make_shared<CompiledModel>(model,
+                                                          shared_from_this(),
+                                                          conf,
+                                                          loaded_from_cache,
+                                                          nullptr,
+                                                          WeightsRetention::Ticket{},
+                                                          deserializer.repacked_weights());
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
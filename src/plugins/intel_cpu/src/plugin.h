@@ -54,6 +54,9 @@ private:
     bool streamsExplicitlySetForEngine = false;
     const std::string deviceFullName;
     ov::AnyMap m_compiled_model_runtime_properties;
+    // properties set to the plugin, they are a part of the signature of the retained weights caches
+    ov::AnyMap m_engine_properties;
+    WeightsRetention::Ptr m_weights_retention = std::make_shared<WeightsRetention>();
 
     std::shared_ptr<void> specialSetup;
 };
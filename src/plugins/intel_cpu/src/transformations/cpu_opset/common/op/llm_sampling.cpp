@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "llm_sampling.hpp"
+
+#include <utility>
+
+#include "openvino/op/constant.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::LLMSamplingNode::LLMSamplingNode(const OutputVector& args, Config cfg)
+    : Op(args),
+      m_config(std::move(cfg)) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::LLMSamplingNode::clone_with_new_inputs(
+    const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(LLMSamplingNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::LLMSamplingNode>(new_args, m_config);
+}
+
+bool ov::intel_cpu::LLMSamplingNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(LLMSamplingNode_visit_attributes);
+    visitor.start_structure("config");
+    visitor.on_attribute("temperature", m_config.temperature);
+    visitor.on_attribute("top_k", m_config.top_k);
+    visitor.on_attribute("top_p", m_config.top_p);
+    visitor.on_attribute("repetition_penalty", m_config.repetition_penalty);
+    visitor.on_attribute("with_replacement", m_config.with_replacement);
+    visitor.on_attribute("global_seed", m_config.global_seed);
+    visitor.on_attribute("op_seed", m_config.op_seed);
+    visitor.on_attribute("output_type", m_config.output_type);
+    visitor.finish_structure();
+    return true;
+}
+
+void ov::intel_cpu::LLMSamplingNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(LLMSamplingNode_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() == 2 || get_input_size() == 3,
+                          "expects 2 or 3 inputs, got ",
+                          get_input_size());
+    NODE_VALIDATION_CHECK(this, m_config.temperature > 0.0f, "temperature must be positive");
+    NODE_VALIDATION_CHECK(this, m_config.top_p > 0.0f && m_config.top_p <= 1.0f, "top_p must be in (0, 1]");
+    NODE_VALIDATION_CHECK(this, m_config.repetition_penalty > 0.0f, "repetition_penalty must be positive");
+    NODE_VALIDATION_CHECK(this,
+                          m_config.output_type == ov::element::i32 || m_config.output_type == ov::element::i64,
+                          "output_type must be i32 or i64");
+
+    const auto& logits_et = get_input_element_type(0);
+    const auto& logits_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          logits_et.is_dynamic() || logits_et.is_real(),
+                          "'logits' input must be real whereas current element type is ",
+                          logits_et);
+    NODE_VALIDATION_CHECK(this,
+                          logits_shape.rank().compatible(2),
+                          "'logits' input must have 2D shape whereas current shape is ",
+                          logits_shape);
+
+    const auto& num_samples_et = get_input_element_type(1);
+    NODE_VALIDATION_CHECK(this,
+                          num_samples_et.is_dynamic() || num_samples_et.is_integral_number(),
+                          "'num_samples' input must be integer whereas current element type is ",
+                          num_samples_et);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(1).rank().compatible(0) ||
+                              get_input_partial_shape(1).rank().compatible(1),
+                          "'num_samples' input must be a scalar or 1D tensor");
+
+    if (get_input_size() == 3) {
+        const auto& ids_et = get_input_element_type(2);
+        NODE_VALIDATION_CHECK(this,
+                              ids_et.is_dynamic() || ids_et.is_integral_number(),
+                              "'penalized_ids' input must be integer whereas current element type is ",
+                              ids_et);
+        NODE_VALIDATION_CHECK(this,
+                              get_input_partial_shape(2).rank().compatible(2),
+                              "'penalized_ids' input must have 2D shape");
+    }
+
+    auto num_samples = Dimension::dynamic();
+    if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(get_input_node_shared_ptr(1))) {
+        const auto value = constant->cast_vector<int64_t>();
+        NODE_VALIDATION_CHECK(this, value.size() == 1 && value[0] >= 0, "'num_samples' must be non-negative");
+        NODE_VALIDATION_CHECK(this,
+                              m_config.with_replacement || m_config.top_k == 0 ||
+                                  static_cast<size_t>(value[0]) <= m_config.top_k,
+                              "'num_samples' must not exceed top_k when sampling without replacement");
+        num_samples = value[0];
+    }
+
+    const auto batch = logits_shape.rank().is_static() ? logits_shape[0] : Dimension::dynamic();
+    set_output_type(0, m_config.output_type, {batch, num_samples});
+}
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+/**
+ * The operation draws the next tokens from the logits of a language model in one pass: it applies the repetition
+ * penalty and the temperature, keeps the top-k tokens and the top-p nucleus of them and samples the tokens from
+ * the remaining distribution. Inputs:
+ *     1. Logits of type T1 - shape [B, V], where B - number of sequences, V - vocabulary size. Required
+ *     2. Number of samples of type T2 - scalar or 1D tensor with one element. Required
+ *     3. Ids of the tokens to penalize of type T2 - shape [B, L]. The ids outside of [0, V) are ignored. Optional
+ * Outputs:
+ *     1. Ids of the sampled tokens of type T3 - shape [B, num_samples]
+ * Types:
+ *     T1 - f32, f16 and bf16 are supported
+ *     T2, T3 - I32 and I64 are supported
+ */
+class LLMSamplingNode : public ov::op::Op {
+public:
+    OPENVINO_OP("LLMSampling", "cpu_plugin_opset");
+
+    LLMSamplingNode() = default;
+
+    struct Config {
+        float temperature = 1.0f;
+        size_t top_k = 0;  // 0 means that all the tokens are kept
+        float top_p = 1.0f;
+        float repetition_penalty = 1.0f;
+        bool with_replacement = true;
+        uint64_t global_seed = 0;
+        uint64_t op_seed = 0;
+        ov::element::Type output_type = ov::element::i64;
+    };
+
+    LLMSamplingNode(const OutputVector& args, Config cfg);
+
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    const Config& get_config() const {
+        return m_config;
+    }
+
+    Config& get_config() {
+        return m_config;
+    }
+
+private:
+    Config m_config;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "llm_sampling_fusion.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "itt.hpp"
+#include "openvino/core/graph_util.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/log_softmax.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/util/gather_base.hpp"
+#include "openvino/op/util/topk_base.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/cpu_opset/common/op/llm_sampling.hpp"
+
+using namespace ov::pass::pattern;
+
+namespace {
+
+bool is_last_axis(int64_t axis, int64_t rank) {
+    return axis == rank - 1 || axis == -1;
+}
+
+// Returns the scalar value of the constant or nullopt if the node is not a single element constant
+std::optional<float> get_scalar(const ov::Output<ov::Node>& output) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(output.get_node_shared_ptr());
+    if (!constant || ov::shape_size(constant->get_shape()) != 1) {
+        return std::nullopt;
+    }
+    return constant->cast_vector<float>()[0];
+}
+
+}  // namespace
+
+ov::intel_cpu::LLMSamplingFusion::LLMSamplingFusion() {
+    MATCHER_SCOPE(LLMSamplingFusion);
+
+    auto topk_m = wrap_type<ov::op::util::TopKBase>({any_input(rank_equals(2)), wrap_type<ov::op::v0::Constant>()});
+    auto softmax_m =
+        wrap_type<ov::op::v1::Softmax, ov::op::v8::Softmax, ov::op::v5::LogSoftmax>({topk_m}, consumers_count(1));
+    auto probs_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{softmax_m, topk_m});
+    auto multinomial_m = wrap_type<ov::op::v13::Multinomial>({probs_m, any_input()}, consumers_count(1));
+    auto gather_m = wrap_type<ov::op::util::GatherBase>({topk_m, multinomial_m, wrap_type<ov::op::v0::Constant>()});
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto gather = ov::as_type_ptr<ov::op::util::GatherBase>(m.get_match_root());
+        const auto multinomial =
+            ov::as_type_ptr<ov::op::v13::Multinomial>(pattern_map.at(multinomial_m).get_node_shared_ptr());
+        const auto topk = ov::as_type_ptr<ov::op::util::TopKBase>(pattern_map.at(topk_m).get_node_shared_ptr());
+        if (!gather || !multinomial || !topk || transformation_callback(gather)) {
+            return false;
+        }
+
+        // The fused operation replaces the whole chain, so none of the TopK outputs may be used elsewhere: the
+        // other consumer would keep the chain alive and see the positions of its own draws
+        if (topk->output(0).get_target_inputs().size() != 1 || topk->output(1).get_target_inputs().size() != 1) {
+            return false;
+        }
+
+        // Gather picks the vocabulary ids of the sampled positions from the TopK indices
+        if (gather->input_value(0) != topk->output(1) || !is_last_axis(gather->get_batch_dims(), 2) ||
+            !is_last_axis(gather->get_axis(), 2)) {
+            return false;
+        }
+
+        // The distribution is built over the TopK values: either by Softmax, or by Multinomial itself from the
+        // logarithmic probabilities given by LogSoftmax or by the values as is
+        const auto probs = multinomial->input_value(0).get_node_shared_ptr();
+        auto topk_values = multinomial->input_value(0);
+        bool log_probs = true;
+        if (probs != topk) {
+            int64_t axis = 0;
+            if (const auto softmax = ov::as_type_ptr<ov::op::v1::Softmax>(probs)) {
+                axis = static_cast<int64_t>(softmax->get_axis());
+                log_probs = false;
+            } else if (const auto softmax = ov::as_type_ptr<ov::op::v8::Softmax>(probs)) {
+                axis = softmax->get_axis();
+                log_probs = false;
+            } else {
+                axis = ov::as_type_ptr<ov::op::v5::LogSoftmax>(probs)->get_axis();
+            }
+            if (!is_last_axis(axis, 2)) {
+                return false;
+            }
+            topk_values = probs->input_value(0);
+        }
+        if (topk_values != topk->output(0) || multinomial->get_log_probs() != log_probs) {
+            return false;
+        }
+
+        // Multinomial draws the positions in the order of the TopK values, the fused operation orders the tokens
+        // by the score in the same way, so the other sort types would map the draws to the other tokens
+        if (topk->get_mode() != ov::op::TopKMode::MAX || topk->get_sort_type() != ov::op::TopKSortType::SORT_VALUES ||
+            topk->get_axis() != 1 || topk->get_k() == 0) {
+            return false;
+        }
+
+        LLMSamplingNode::Config config;
+        config.top_k = topk->get_k();
+        config.with_replacement = multinomial->get_with_replacement();
+        config.global_seed = multinomial->get_global_seed();
+        config.op_seed = multinomial->get_op_seed();
+        config.output_type = gather->get_output_element_type(0);
+
+        // The temperature is folded into the fused operation when the logits are scaled by a positive scalar
+        auto logits = topk->input_value(0);
+        const auto scale = logits.get_node_shared_ptr();
+        if (ov::is_type_any_of<ov::op::v1::Divide, ov::op::v1::Multiply>(scale)) {
+            const bool is_divide = ov::is_type<ov::op::v1::Divide>(scale);
+            for (size_t i = 0; i < 2; ++i) {
+                const auto value = get_scalar(scale->input_value(i));
+                if (!value || *value <= 0.0f || (is_divide && i == 0) ||
+                    scale->get_input_partial_shape(1 - i).rank() != 2) {
+                    continue;
+                }
+                config.temperature = is_divide ? *value : 1.0f / *value;
+                logits = scale->input_value(1 - i);
+                break;
+            }
+        }
+
+        const auto sampling =
+            std::make_shared<LLMSamplingNode>(ov::OutputVector{logits, multinomial->input_value(1)}, config);
+        sampling->set_friendly_name(gather->get_friendly_name());
+        ov::copy_runtime_info(m.get_matched_nodes(), sampling);
+        ov::replace_node(gather, sampling);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(gather_m, matcher_name);
+    this->register_matcher(m, callback);
+}
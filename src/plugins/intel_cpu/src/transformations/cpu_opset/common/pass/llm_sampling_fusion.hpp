@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Fuses the top-k sampling subgraph of a language model into LLMSampling operation:
+ *
+ *     logits -> [Multiply/Divide by temperature] -> TopK(k, max) -> [Softmax | LogSoftmax] -> Multinomial
+ *                                                      |                                          |
+ *                                                      +-------------> indices ----------------> Gather(batch_dims=1)
+ */
+class LLMSamplingFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("LLMSamplingFusion");
+    LLMSamplingFusion();
+};
+
+}  // namespace ov::intel_cpu
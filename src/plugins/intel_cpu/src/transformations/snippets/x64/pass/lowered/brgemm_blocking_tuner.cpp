@@ -0,0 +1,294 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "brgemm_blocking_tuner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/util/log.hpp"
+#include "snippets/utils/utils.hpp"
+#include "utils/tmp_file.hpp"
+
+namespace ov::intel_cpu::pass {
+using namespace dnnl::impl::cpu::x64;
+using ov::snippets::utils::get_full_dim_value;
+using ov::snippets::utils::is_full_dim_value;
+
+namespace {
+constexpr size_t benchmark_runs = 3;
+
+size_t get_block(size_t dim, size_t blk) {
+    return is_full_dim_value(blk) ? dim : std::min(dim, blk);
+}
+
+size_t to_blocking_param(size_t dim, size_t blk) {
+    return blk >= dim ? get_full_dim_value() : blk;
+}
+
+void add_candidate(std::vector<size_t>& candidates, size_t dim, size_t blk) {
+    if (blk == 0) {
+        return;
+    }
+    blk = to_blocking_param(dim, blk);
+    if (std::find(candidates.begin(), candidates.end(), blk) == candidates.end()) {
+        candidates.push_back(blk);
+    }
+}
+}  // namespace
+
+bool BrgemmBlockingTuner::Key::operator<(const Key& rhs) const {
+    const auto prc = static_cast<ov::element::Type_t>(precision);
+    const auto rhs_prc = static_cast<ov::element::Type_t>(rhs.precision);
+    return std::tie(M, N, K, prc, isa) < std::tie(rhs.M, rhs.N, rhs.K, rhs_prc, rhs.isa);
+}
+
+BrgemmBlockingTuner& BrgemmBlockingTuner::instance() {
+    static BrgemmBlockingTuner tuner;
+    return tuner;
+}
+
+bool BrgemmBlockingTuner::is_supported(const Key& key) {
+    return key.precision == ov::element::f32 && !is_superset(key.isa, amx_tile) && mayiuse(key.isa) &&
+           key.M != 0 && key.N != 0 && key.K != 0;
+}
+
+std::vector<BrgemmBlockingTuner::Blocking> BrgemmBlockingTuner::get_candidates(const Key& key,
+                                                                               const Blocking& heuristic) {
+    // The candidates stay close to the heuristic: N block is a multiple of the heuristic one, since it is aligned
+    // with the vector length of the ISA, while M and K blocks are scaled up and down
+    const auto m_blk = get_block(key.M, heuristic.m_blk);
+    const auto n_blk = get_block(key.N, heuristic.n_blk);
+    const auto k_blk = get_block(key.K, heuristic.k_blk);
+
+    std::vector<size_t> m_candidates, n_candidates, k_candidates;
+    for (const auto blk : {m_blk, m_blk / 2, m_blk * 2}) {
+        add_candidate(m_candidates, key.M, blk);
+    }
+    for (const auto blk : {n_blk, n_blk * 2}) {
+        add_candidate(n_candidates, key.N, blk);
+    }
+    for (const auto blk : {k_blk, k_blk / 2}) {
+        add_candidate(k_candidates, key.K, blk);
+    }
+
+    std::vector<Blocking> candidates;
+    candidates.reserve(m_candidates.size() * n_candidates.size() * k_candidates.size());
+    for (const auto m : m_candidates) {
+        for (const auto n : n_candidates) {
+            for (const auto k : k_candidates) {
+                candidates.push_back({m, n, k});
+            }
+        }
+    }
+    return candidates;
+}
+
+double BrgemmBlockingTuner::benchmark(const Key& key, const Blocking& blocking) {
+    OPENVINO_ASSERT(is_supported(key), "BrgemmBlockingTuner doesn't support the brgemm configuration");
+    const auto M = key.M, N = key.N, K = key.K;
+    const auto m_blk = get_block(M, blocking.m_blk);
+    const auto n_blk = get_block(N, blocking.n_blk);
+    const auto k_blk = get_block(K, blocking.k_blk);
+
+    // Only the block tails differ in the kernel shapes, so there are at most 8 kernels per beta value
+    using KernelKey = std::tuple<size_t, size_t, size_t, bool>;
+    std::map<KernelKey, std::unique_ptr<brgemm_kernel_t>> kernels;
+    auto get_kernel = [&](size_t m, size_t n, size_t k, bool accumulate) {
+        auto& kernel = kernels[KernelKey{m, n, k, accumulate}];
+        if (!kernel) {
+            brgemm_desc_t desc;
+            OPENVINO_ASSERT(brgemm_desc_init(&desc,
+                                             key.isa,
+                                             brgemm_strd,
+                                             dnnl_f32,
+                                             dnnl_f32,
+                                             false,
+                                             false,
+                                             brgemm_row_major,
+                                             1.f,
+                                             accumulate ? 1.f : 0.f,
+                                             K,
+                                             N,
+                                             N,
+                                             m,
+                                             n,
+                                             k,
+                                             nullptr) == dnnl_success,
+                            "Cannot initialize brgemm descriptor for blocking tuning");
+            brgemm_kernel_t* kernel_ = nullptr;
+            OPENVINO_ASSERT(brgemm_kernel_create(&kernel_, desc) == dnnl_success,
+                            "Cannot create brgemm kernel for blocking tuning");
+            kernel.reset(kernel_);
+        }
+        return kernel.get();
+    };
+
+    std::vector<float> a(M * K, 1.f), b(K * N, 1.f), c(M * N, 0.f);
+    auto run = [&]() {
+        for (size_t m = 0; m < M; m += m_blk) {
+            const auto m_cur = std::min(m_blk, M - m);
+            for (size_t n = 0; n < N; n += n_blk) {
+                const auto n_cur = std::min(n_blk, N - n);
+                for (size_t k = 0; k < K; k += k_blk) {
+                    const auto k_cur = std::min(k_blk, K - k);
+                    brgemm_kernel_params_t params;
+                    params.batch = nullptr;
+                    params.ptr_A = a.data() + m * K + k;
+                    params.ptr_B = b.data() + k * N + n;
+                    params.ptr_C = c.data() + m * N + n;
+                    params.ptr_D = params.ptr_C;
+                    params.ptr_buf = nullptr;
+                    params.ptr_bias = nullptr;
+                    params.do_post_ops = 0;
+                    params.do_apply_comp = 0;
+                    params.skip_accm = 0;
+                    params.BS = 1;
+                    (*get_kernel(m_cur, n_cur, k_cur, k != 0))(&params);
+                }
+            }
+        }
+    };
+
+    // The first run creates the kernels and warms up the caches
+    run();
+    auto best = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < benchmark_runs; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto end = std::chrono::steady_clock::now();
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        best = std::min(best, static_cast<double>(time));
+    }
+    return best;
+}
+
+BrgemmBlockingTuner::Blocking BrgemmBlockingTuner::get_blocking(const Key& key,
+                                                                const Blocking& heuristic,
+                                                                const std::string& file) {
+    if (!is_supported(key)) {
+        return heuristic;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!file.empty() && m_loaded_files.insert(file).second) {
+            load_unlocked(file);
+        }
+        const auto it = m_blockings.find(key);
+        if (it != m_blockings.end()) {
+            return it->second;
+        }
+    }
+
+    // The timing is done without the lock, so the compilations of the other shapes are not serialized behind it.
+    // If the same shape is tuned concurrently, the winner stored first is used by all of them
+    auto best = heuristic;
+    auto best_time = std::numeric_limits<double>::max();
+    for (const auto& candidate : get_candidates(key, heuristic)) {
+        const auto time = benchmark(key, candidate);
+        if (time < best_time) {
+            best_time = time;
+            best = candidate;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto& stored = m_blockings.emplace(key, best).first->second;
+    if (!file.empty()) {
+        // The tuning file is a cache, the compilation goes on with the tuned blocking if it can't be written
+        try {
+            save_unlocked(file);
+        } catch (const ov::Exception& e) {
+            OPENVINO_WARN("BrgemmBlockingTuner cannot persist the tuned blockings: ", e.what());
+        }
+    }
+    return stored;
+}
+
+void BrgemmBlockingTuner::set_blocking(const Key& key, const Blocking& blocking) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_blockings[key] = blocking;
+}
+
+void BrgemmBlockingTuner::load(const std::string& file) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_loaded_files.insert(file);
+    load_unlocked(file);
+}
+
+void BrgemmBlockingTuner::save(const std::string& file) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    save_unlocked(file);
+}
+
+void BrgemmBlockingTuner::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_blockings.clear();
+    m_loaded_files.clear();
+}
+
+// File format: one winner per line "<isa> <precision> <M> <N> <K> <m_blk> <n_blk> <k_blk>",
+// where isa is the numeric value of dnnl::impl::cpu::x64::cpu_isa_t and the full dim value is written as 0
+void BrgemmBlockingTuner::load_unlocked(const std::string& file) {
+    std::ifstream stream(file);
+    if (!stream.is_open()) {
+        return;
+    }
+    auto from_file = [](size_t blk) {
+        return blk == 0 ? get_full_dim_value() : blk;
+    };
+    uint64_t isa = 0;
+    std::string precision;
+    Key key;
+    Blocking blocking;
+    while (stream >> isa >> precision >> key.M >> key.N >> key.K >> blocking.m_blk >> blocking.n_blk >>
+           blocking.k_blk) {
+        key.isa = static_cast<cpu_isa_t>(isa);
+        key.precision = ov::element::Type(precision);
+        // The winners that are already known in the process take precedence over the persisted ones
+        m_blockings.emplace(key,
+                            Blocking{from_file(blocking.m_blk), from_file(blocking.n_blk), from_file(blocking.k_blk)});
+    }
+}
+
+// The table is written to a temporary file in the same directory which replaces the previous one, so the concurrent
+// readers and an interrupted write never see a partial table
+void BrgemmBlockingTuner::save_unlocked(const std::string& file) const {
+    const auto tmp_file = file + uniqueTmpFileSuffix();
+    {
+        std::ofstream stream(tmp_file, std::ios::trunc);
+        OPENVINO_ASSERT(stream.is_open(), "BrgemmBlockingTuner cannot open the file ", tmp_file);
+        auto to_file = [](size_t blk) {
+            return is_full_dim_value(blk) ? 0 : blk;
+        };
+        for (const auto& [key, blocking] : m_blockings) {
+            stream << static_cast<uint64_t>(key.isa) << ' ' << key.precision.to_string() << ' ' << key.M << ' '
+                   << key.N << ' ' << key.K << ' ' << to_file(blocking.m_blk) << ' ' << to_file(blocking.n_blk)
+                   << ' ' << to_file(blocking.k_blk) << '\n';
+        }
+        stream.close();
+        if (!stream) {
+            std::remove(tmp_file.c_str());
+            OPENVINO_THROW("BrgemmBlockingTuner cannot write the file ", tmp_file);
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_file, file, ec);
+    if (ec) {
+        std::remove(tmp_file.c_str());
+        OPENVINO_THROW("BrgemmBlockingTuner cannot replace the file ", file, ": ", ec.message());
+    }
+}
+
+}  // namespace ov::intel_cpu::pass
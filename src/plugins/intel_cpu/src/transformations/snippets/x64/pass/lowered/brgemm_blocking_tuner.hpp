@@ -0,0 +1,90 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu::pass {
+
+/**
+ * @interface BrgemmBlockingTuner
+ * @brief Selects the Brgemm blocking parameters empirically: the candidate blockings of the shape are timed on the
+ *        oneDNN brgemm kernels of the target ISA and the fastest one is kept in a process wide table.
+ *        The table can be persisted to a file to reuse the winners on the next compilations without timing.
+ * @ingroup snippets
+ */
+class BrgemmBlockingTuner {
+public:
+    struct Key {
+        size_t M = 0, N = 0, K = 0;
+        ov::element::Type precision;
+        dnnl::impl::cpu::x64::cpu_isa_t isa = dnnl::impl::cpu::x64::isa_undef;
+
+        bool operator<(const Key& rhs) const;
+    };
+
+    // Block sizes in the format of BrgemmBlockingBase::get_blocking_params: full dim value means no blocking
+    struct Blocking {
+        size_t m_blk = 0, n_blk = 0, k_blk = 0;
+
+        bool operator==(const Blocking& rhs) const {
+            return m_blk == rhs.m_blk && n_blk == rhs.n_blk && k_blk == rhs.k_blk;
+        }
+    };
+
+    static BrgemmBlockingTuner& instance();
+
+    /**
+     * @brief Returns the blocking of the key: the stored winner if it is known, otherwise times the candidates
+     *        derived from `heuristic` and stores the fastest of them
+     * @param file path to the file with the persisted winners, empty if the winners are not persisted. The file which
+     *        can't be written is skipped with a warning
+     */
+    Blocking get_blocking(const Key& key, const Blocking& heuristic, const std::string& file = {});
+
+    /**
+     * @brief Stores the blocking of the key explicitly, e.g. the one that was tuned offline
+     */
+    void set_blocking(const Key& key, const Blocking& blocking);
+
+    /**
+     * @brief Supported cases: f32 brgemm without AMX. Other precisions use repacked layouts with own blocking rules
+     */
+    static bool is_supported(const Key& key);
+
+    static std::vector<Blocking> get_candidates(const Key& key, const Blocking& heuristic);
+
+    /**
+     * @brief Measures the time in nanoseconds of the whole M x N x K matmul computed by the blocks of `blocking`
+     */
+    static double benchmark(const Key& key, const Blocking& blocking);
+
+    void load(const std::string& file);
+    /**
+     * @brief Replaces the file with the table of the winners, throws if the file can't be written
+     */
+    void save(const std::string& file) const;
+    void clear();
+
+private:
+    BrgemmBlockingTuner() = default;
+
+    void load_unlocked(const std::string& file);
+    void save_unlocked(const std::string& file) const;
+
+    mutable std::mutex m_mutex;
+    std::map<Key, Blocking> m_blockings;
+    std::set<std::string> m_loaded_files;
+};
+
+}  // namespace ov::intel_cpu::pass
@@ -4,6 +4,7 @@
 
 #include "brgemm_cpu_blocking.hpp"
 
+#include "brgemm_blocking_tuner.hpp"
 #include "snippets/itt.hpp"
 #include "snippets/lowered/linear_ir.hpp"
 #include "snippets/lowered/loop_manager.hpp"
@@ -64,6 +65,18 @@ std::tuple<size_t, size_t, size_t> BrgemmCPUBlocking::get_blocking_params(
         n_blk = get_full_dim_value();
         k_blk = get_full_dim_value();
     }
+    // Only f32 brgemms without AMX are tuned: the other ones use the repacked layouts with own blocking rules
+    const auto in_precision = brgemm->get_input_element_type(0);
+    if (m_tune && in_precision == element::f32 && !with_amx(brgemm->get_type())) {
+        size_t m, n, k;
+        std::tie(m, n, k) = get_brgemm_dimensions(brgemm_expr);
+        if (!is_dynamic_value(m) && !is_dynamic_value(n) && !is_dynamic_value(k)) {
+            const BrgemmBlockingTuner::Key key{m, n, k, in_precision, get_primitive_isa(in_precision, false)};
+            const auto blocking =
+                BrgemmBlockingTuner::instance().get_blocking(key, {m_blk, n_blk, k_blk}, m_tuning_file);
+            std::tie(m_blk, n_blk, k_blk) = std::make_tuple(blocking.m_blk, blocking.n_blk, blocking.k_blk);
+        }
+    }
     return std::make_tuple(m_blk, n_blk, k_blk);
 }
 
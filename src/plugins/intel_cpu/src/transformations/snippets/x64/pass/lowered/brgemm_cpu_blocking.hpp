@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <string>
+#include <utility>
+
 #include "snippets/lowered/pass/brgemm_blocking.hpp"
 #include "transformations/snippets/x64/op/brgemm_cpu.hpp"
 
@@ -12,11 +15,17 @@ namespace ov::intel_cpu::pass {
 /**
  * @interface BrgemmCPUBlocking
  * @brief Covers BrgemmCPU with blocking loops
+ * @param tune if true, the blocking parameters of the static brgemms are selected by BrgemmBlockingTuner
+ *        instead of the heuristic
+ * @param tuning_file path to the file where the tuned blocking parameters are persisted, empty if they are not
  * @ingroup snippets
  */
 class BrgemmCPUBlocking : public ov::snippets::lowered::pass::BrgemmBlocking<BrgemmCPU> {
 public:
     OPENVINO_RTTI("BrgemmCPUBlocking", "", BrgemmBlocking)
+    explicit BrgemmCPUBlocking(bool tune = false, std::string tuning_file = {})
+        : m_tune(tune),
+          m_tuning_file(std::move(tuning_file)) {}
 
     /**
      * @interface DummyPass
@@ -52,6 +61,9 @@ private:
                              size_t k_block) override;
 
     size_t get_default_n_blk(size_t n) const override;
+
+    bool m_tune = false;
+    std::string m_tuning_file;
 };
 
 }  // namespace ov::intel_cpu::pass
@@ -11,10 +11,13 @@
 #include <ov_ops/augru_sequence.hpp>
 #include <ov_ops/gather_compressed.hpp>
 
+#include "openvino/op/embedding_segments_sum.hpp"
 #include "openvino/op/paged_attention.hpp"
 #include "openvino/op/prelu.hpp"
 #include "openvino/op/round.hpp"
 #include "openvino/op/sqrt.hpp"
+#include "openvino/op/util/embeddingbag_offsets_base.hpp"
+#include "openvino/op/util/embeddingbag_packed_base.hpp"
 #include "openvino/opsets/opset10_decl.hpp"
 #include "openvino/opsets/opset1_decl.hpp"
 #include "openvino/opsets/opset2_decl.hpp"
@@ -152,6 +155,7 @@
 #include "transformations/cpu_opset/common/pass/decompose_integer_divide.hpp"
 #include "transformations/cpu_opset/common/pass/decompose_rms_norm.hpp"
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
+#include "transformations/cpu_opset/common/pass/llm_sampling_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/ngram_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
 #include "transformations/cpu_opset/common/pass/stateful_sdpa_fusion.hpp"
@@ -198,6 +202,15 @@ namespace ov::intel_cpu {
 
 using const_node_ptr = const std::shared_ptr<const ov::Node>;
 
+namespace {
+// The compressed embedding tables are dequantized on the fly by the EmbeddingBag nodes
+bool is_embedding_table(const ov::Input<ov::Node>& input) {
+    return input.get_index() == 0 && ov::is_type_any_of<ov::op::util::EmbeddingBagPackedBase,
+                                                        ov::op::util::EmbeddingBagOffsetsBase,
+                                                        ov::op::v3::EmbeddingSegmentsSum>(input.get_node());
+}
+}  // namespace
+
 bool Transformations::is_decompression_multiply(const_node_ptr& node) const {
     auto all_has_type = [](const std::set<ov::Input<ov::Node>>& consumers, const ov::DiscreteTypeInfo& type) {
         return std::all_of(consumers.begin(), consumers.end(), [&type](const ov::Input<ov::Node>& input) {
@@ -206,7 +219,8 @@ bool Transformations::is_decompression_multiply(const_node_ptr& node) const {
     };
 
     const auto consumers = node->get_output_target_inputs(0);
-    if (all_has_type(consumers, ov::opset1::MatMul::get_type_info_static())) {
+    if (all_has_type(consumers, ov::opset1::MatMul::get_type_info_static()) ||
+        std::all_of(consumers.begin(), consumers.end(), is_embedding_table)) {
         return true;
     }
 
@@ -452,7 +466,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
         [](const_node_ptr& node) -> bool {
             const auto consumers = node->get_output_target_inputs(0);
             return std::all_of(consumers.begin(), consumers.end(), [](const ov::Input<ov::Node>& consumer) {
-                return !ov::is_type<ov::op::v0::MatMul>(consumer.get_node());
+                return !ov::is_type<ov::op::v0::MatMul>(consumer.get_node()) && !is_embedding_table(consumer);
             });
         },
         ov::pass::KeepConstAndDecompression);
@@ -521,7 +535,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertMatrixNmsToMatrixNmsIE);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::TransposeMatMul);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding, true);
     CPU_REGISTER_PASS_ARM64(manager, ov::pass::HardSigmoidDecomposition);
 
     if (useLpt) {
@@ -790,7 +804,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
        and finally do CF for those constant paths that are not inputs to MatMul node */
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EnableDecompressionConvertConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding, true);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
 
     manager.run_passes(model);
@@ -992,6 +1006,7 @@ void Transformations::PostLpt() {
     CPU_REGISTER_PASS_ARM64(postLPTPassManager, ov::pass::RoPEFusion, true);
     CPU_DISABLE_PASS_COMMON(postLPTPassManager, ov::pass::RoPEFusionFlux);
     CPU_REGISTER_PASS_X64(postLPTPassManager, CausalMaskPreprocessFusion);
+    CPU_REGISTER_PASS_COMMON(postLPTPassManager, LLMSamplingFusion);
 
 #if defined(OPENVINO_ARCH_X86_64)
     // MLP & QKV fusion optimizations is focused on throughput, only enabled on AMX-bf16 & LLM serving use cases.
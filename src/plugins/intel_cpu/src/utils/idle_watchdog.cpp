@@ -0,0 +1,167 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "idle_watchdog.hpp"
+
+#include <condition_variable>
+#include <map>
+#include <thread>
+#include <utility>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief The thread which runs the deadlines of all the watchdogs of the process in the order of time.
+ * A watchdog has at most one entry in the queue, so the countdown restarted by every inference doesn't touch the queue.
+ */
+class IdleTimer {
+public:
+    using time_point = std::chrono::steady_clock::time_point;
+
+    static std::shared_ptr<IdleTimer> get() {
+        static std::mutex mutex;
+        static std::weak_ptr<IdleTimer> instance;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto timer = instance.lock();
+        if (!timer) {
+            timer = std::make_shared<IdleTimer>();
+            instance = timer;
+        }
+        return timer;
+    }
+
+    IdleTimer()
+        : m_thread([this] {
+              run();
+          }) {}
+
+    ~IdleTimer() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_one();
+        m_thread.join();
+    }
+
+    IdleTimer(const IdleTimer&) = delete;
+    IdleTimer& operator=(const IdleTimer&) = delete;
+
+    void schedule(IdleWatchdog* watchdog, time_point deadline) {
+        bool first = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            first = m_queue.empty() || deadline < m_queue.begin()->first;
+            m_queue.emplace(deadline, watchdog);
+        }
+        if (first) {
+            m_cv.notify_one();
+        }
+    }
+
+    // removes the entry of the watchdog, waits for its callback if it's running
+    void cancel(IdleWatchdog* watchdog) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [&] {
+            return m_running != watchdog;
+        });
+        for (auto it = m_queue.begin(); it != m_queue.end();) {
+            it = it->second == watchdog ? m_queue.erase(it) : std::next(it);
+        }
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (!m_stop) {
+            if (m_queue.empty()) {
+                m_cv.wait(lock);
+                continue;
+            }
+            const auto deadline = m_queue.begin()->first;
+            if (std::chrono::steady_clock::now() < deadline) {
+                m_cv.wait_until(lock, deadline);
+                continue;
+            }
+            auto* watchdog = m_queue.begin()->second;
+            m_queue.erase(m_queue.begin());
+            m_running = watchdog;
+            lock.unlock();
+            const auto next = watchdog->expire();
+            lock.lock();
+            if (next) {
+                m_queue.emplace(*next, watchdog);
+            }
+            m_running = nullptr;
+            m_done.notify_all();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::condition_variable m_done;
+    std::multimap<time_point, IdleWatchdog*> m_queue;
+    IdleWatchdog* m_running = nullptr;
+    bool m_stop = false;
+    std::thread m_thread;
+};
+
+IdleWatchdog::IdleWatchdog(std::chrono::milliseconds timeout, std::function<bool()> callback)
+    : m_timeout(timeout),
+      m_callback(std::move(callback)),
+      m_timer(IdleTimer::get()),
+      m_deadline(std::chrono::steady_clock::now() + timeout),
+      m_scheduled(true) {
+    m_timer->schedule(this, m_deadline);
+}
+
+IdleWatchdog::~IdleWatchdog() {
+    m_timer->cancel(this);
+}
+
+void IdleWatchdog::touch() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_deadline = std::chrono::steady_clock::now() + m_timeout;
+    if (!m_scheduled) {
+        m_scheduled = true;
+        m_timer->schedule(this, m_deadline);
+    }
+}
+
+void IdleWatchdog::begin() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_active;
+}
+
+void IdleWatchdog::end() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_active;
+    }
+    touch();
+}
+
+std::optional<std::chrono::steady_clock::time_point> IdleWatchdog::expire() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    const auto now = std::chrono::steady_clock::now();
+    if (now < m_deadline) {
+        return m_deadline;
+    }
+    if (m_active > 0) {
+        // the activity outlives the timeout, its end restarts the countdown, so it is only polled meanwhile
+        return now + m_timeout;
+    }
+    m_scheduled = false;
+    lock.unlock();
+    const bool done = m_callback();
+    lock.lock();
+    if (!done && !m_scheduled) {
+        m_scheduled = true;
+        m_deadline = std::chrono::steady_clock::now() + m_timeout;
+        return m_deadline;
+    }
+    return std::nullopt;
+}
+
+}  // namespace ov::intel_cpu
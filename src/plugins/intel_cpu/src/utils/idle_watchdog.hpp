@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace ov::intel_cpu {
+
+class IdleTimer;
+
+/**
+ * @brief Calls the callback once no activity was reported for the given time.
+ * The callback returns false if it couldn't do its job, e.g. because the resources were busy, then it is called again
+ * after one more timeout. After a successful call the watchdog sleeps until the next activity.
+ * All the watchdogs of the process share one timer thread, which runs the callbacks one by one. The thread is started
+ * with the first watchdog and stopped with the last one.
+ */
+class IdleWatchdog {
+public:
+    IdleWatchdog(std::chrono::milliseconds timeout, std::function<bool()> callback);
+    ~IdleWatchdog();
+
+    IdleWatchdog(const IdleWatchdog&) = delete;
+    IdleWatchdog& operator=(const IdleWatchdog&) = delete;
+
+    // restarts the countdown
+    void touch();
+
+    // the activity which has begun holds the countdown until it ends, then the countdown restarts
+    void begin();
+    void end();
+
+private:
+    friend class IdleTimer;
+
+    // called by the timer when the scheduled deadline has come, returns the deadline to be scheduled next, if any
+    std::optional<std::chrono::steady_clock::time_point> expire();
+
+    const std::chrono::milliseconds m_timeout;
+    const std::function<bool()> m_callback;
+    const std::shared_ptr<IdleTimer> m_timer;
+    std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_deadline;
+    // the timer holds an entry of the watchdog, the later deadlines are picked up when the entry expires
+    bool m_scheduled = false;
+    size_t m_active = 0;
+};
+
+}  // namespace ov::intel_cpu
@@ -4,19 +4,281 @@
 
 #include "serialize.hpp"
 
+#include <cstdio>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <unordered_map>
 #include <utility>
 
+#include "dnnl_extension_utils.h"
+#include "graph_context.h"
+#include "hash_builder.hpp"
+#include "memory_desc/cpu_memory_desc_utils.h"
 #include "openvino/core/descriptor_tensor.hpp"
 #include "openvino/core/parallel.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 
 namespace ov::intel_cpu {
 
+namespace {
+
+/*
+ * Layout of the repacked weights section, it precedes the StreamSerialize data:
+ *   RepackedWeightsHeader
+ *   for each entry: id, key length, key, descriptor length, descriptor, data offset, data size (uint64_t integers)
+ *   data of the entries, every entry is aligned to repacked_weights_alignment bytes of the stream position
+ * The data offsets are relative to the section start.
+ */
+constexpr char repacked_weights_magic[8] = {'C', 'P', 'U', 'R', 'E', 'P', 'A', 'K'};
+constexpr size_t repacked_weights_alignment = 64;
+
+struct RepackedWeightsHeader {
+    char magic[8];
+    uint64_t section_size;
+    uint64_t isa;
+    uint64_t count;
+};
+
+uint64_t current_isa() {
+    return static_cast<uint64_t>(dnnl::get_effective_cpu_isa());
+}
+
+size_t align_up(size_t value) {
+    return (value + repacked_weights_alignment - 1) / repacked_weights_alignment * repacked_weights_alignment;
+}
+
+// The cache keys contain the addresses in the decimal and in the %p form
+std::string address_form(const void* ptr, char form) {
+    if (form == 'd') {
+        return std::to_string(reinterpret_cast<uint64_t>(ptr));
+    }
+    char buf[32];
+    snprintf(buf, sizeof buf, "%p", ptr);
+    return buf;
+}
+
+struct ConstantRef {
+    const void* data;
+    size_t fingerprint;  // guards against a different order of the constants in the imported model
+};
+
+std::vector<ConstantRef> constants_data(const std::shared_ptr<const ov::Model>& model) {
+    std::vector<ConstantRef> retVal;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (auto constant = ov::as_type_ptr<const ov::op::v0::Constant>(op)) {
+            const size_t fingerprint = hash::Builder(0)
+                                           .combine(constant->get_friendly_name())
+                                           .combine(constant->get_byte_size())
+                                           .combine(constant->get_element_type().hash())
+                                           .generate();
+            retVal.push_back({constant->get_data_ptr(), fingerprint});
+        }
+    }
+    return retVal;
+}
+
+// Applies fn to every '_' separated component of the key and joins the results back, returns false if fn fails
+template <typename Fn>
+bool transform_key(const std::string& key, std::string& result, Fn fn) {
+    result.clear();
+    size_t begin = 0;
+    while (true) {
+        const size_t end = std::min(key.find('_', begin), key.size());
+        std::string component;
+        if (!fn(key.substr(begin, end - begin), component)) {
+            return false;
+        }
+        result += component;
+        if (end == key.size()) {
+            return true;
+        }
+        result += '_';
+        begin = end + 1;
+    }
+}
+
+/**
+ * Memory block over the data of the repacked weights section, keeps the section alive
+ */
+class RepackedWeightsBlock : public IMemoryBlockObserver {
+public:
+    RepackedWeightsBlock(std::shared_ptr<void> storage, const char* data, size_t size)
+        : m_storage(std::move(storage)),
+          m_data(const_cast<char*>(data)),
+          m_size(size) {}
+
+    void* getRawPtr() const noexcept override {
+        return m_data;
+    }
+    void setExtBuff([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size) override {
+        OPENVINO_THROW("RepackedWeightsBlock doesn't support external buffers");
+    }
+    bool resize(size_t size) override {
+        OPENVINO_ASSERT(size <= m_size, "Repacked weights of ", m_size, " bytes can't be resized to ", size, " bytes");
+        return false;
+    }
+    bool hasExtBuffer() const noexcept override {
+        return true;
+    }
+    void registerMemory([[maybe_unused]] Memory* memPtr) override {}
+    void unregisterMemory([[maybe_unused]] Memory* memPtr) override {}
+
+private:
+    std::shared_ptr<void> m_storage;
+    char* m_data;
+    size_t m_size;
+};
+
+}  // namespace
+
+////////// RepackedWeights //////////
+
+void RepackedWeights::prefill(SocketsWeights& weights, const std::shared_ptr<const ov::Model>& model) const {
+    const auto constants = constants_data(model);
+    std::unordered_map<uint64_t, const char*> objects;
+    for (const auto& entry : m_entries) {
+        objects.emplace(entry.id, entry.data);
+    }
+
+    auto resolve = [&](const std::string& component, std::string& result) {
+        // {c<index>:<form>:<fingerprint>} refers to a constant, {w<id>:<form>} refers to another entry
+        unsigned long long index = 0;
+        unsigned long long fingerprint = 0;
+        char form = 0;
+        int length = 0;
+        const int size = static_cast<int>(component.size());
+        if (sscanf(component.c_str(), "{c%llu:%c:%llu}%n", &index, &form, &fingerprint, &length) == 3 &&
+            length == size) {
+            if (index >= constants.size() || constants[index].fingerprint != fingerprint) {
+                return false;
+            }
+            result = address_form(constants[index].data, form);
+            return true;
+        }
+        if (sscanf(component.c_str(), "{w%llu:%c}%n", &index, &form, &length) == 2 && length == size) {
+            auto found = objects.find(index);
+            if (found == objects.end()) {
+                return false;
+            }
+            result = address_form(found->second, form);
+            return true;
+        }
+        result = component;
+        return true;
+    };
+
+    const auto& engine = GraphContext::getEngine();
+    for (const auto& entry : m_entries) {
+        std::string key;
+        if (!transform_key(entry.key, key, resolve)) {
+            continue;
+        }
+        auto desc = DnnlExtensionUtils::makeDescriptor(dnnl::memory::desc(entry.desc));
+        if (desc->getCurrentMemSize() != entry.size) {
+            continue;
+        }
+        auto block = std::make_shared<RepackedWeightsBlock>(m_storage, entry.data, entry.size);
+        weights.prefill(key, std::make_shared<Memory>(engine, desc, block));
+    }
+}
+
 ////////// ModelSerializer //////////
 
-ModelSerializer::ModelSerializer(std::ostream& ostream, CacheEncrypt encrypt_fn)
+ModelSerializer::ModelSerializer(std::ostream& ostream, CacheEncrypt encrypt_fn, WeightsSharing::Ptr weights_cache)
     : m_ostream(ostream),
-      m_cache_encrypt(std::move(encrypt_fn)) {}
+      m_cache_encrypt(std::move(encrypt_fn)),
+      m_weights_cache(std::move(weights_cache)) {}
+
+void ModelSerializer::write_repacked_weights(const std::shared_ptr<ov::Model>& model) {
+    const auto objects = m_weights_cache->getCachedObjects();
+
+    std::unordered_map<std::string, std::string> references;
+    const auto constants = constants_data(model);
+    for (size_t i = 0; i < constants.size(); i++) {
+        for (const char form : {'d', 'p'}) {
+            references.emplace(address_form(constants[i].data, form),
+                               "{c" + std::to_string(i) + ":" + form + ":" + std::to_string(constants[i].fingerprint) +
+                                   "}");
+        }
+    }
+    for (size_t i = 0; i < objects.size(); i++) {
+        for (const char form : {'d', 'p'}) {
+            references.emplace(address_form(objects[i].second->getData(), form),
+                               "{w" + std::to_string(i) + ":" + form + "}");
+        }
+    }
+
+    struct Record {
+        uint64_t id;
+        std::string key;
+        std::vector<uint8_t> desc;
+        MemoryPtr memory;
+    };
+    std::vector<Record> records;
+    for (size_t i = 0; i < objects.size(); i++) {
+        const auto& memory = objects[i].second;
+        const auto& desc = memory->getDescPtr();
+        if (!desc->isDefined() || desc->getPrecision() == element::string || memory->getSize() == 0) {
+            continue;
+        }
+        bool has_references = false;
+        std::string key;
+        transform_key(objects[i].first, key, [&](const std::string& component, std::string& result) {
+            auto found = references.find(component);
+            has_references |= found != references.end();
+            result = found != references.end() ? found->second : component;
+            return true;
+        });
+        // the keys without addresses are names of the constant outputs, which depend on the configuration
+        if (!has_references) {
+            continue;
+        }
+        try {
+            auto blob = MemoryDescUtils::convertToDnnlMemoryDesc(desc)->getDnnlDesc().get_blob();
+            records.push_back({i, std::move(key), std::move(blob), memory});
+        } catch (const dnnl::error&) {
+            continue;
+        }
+    }
+
+    const size_t section_start = m_ostream.tellp();
+    size_t table_size = sizeof(RepackedWeightsHeader);
+    for (const auto& record : records) {
+        table_size += 5 * sizeof(uint64_t) + record.key.size() + record.desc.size();
+    }
+    std::vector<uint64_t> offsets;
+    size_t section_end = section_start + table_size;
+    for (const auto& record : records) {
+        offsets.push_back(align_up(section_end) - section_start);
+        section_end = align_up(section_end) + record.memory->getSize();
+    }
+
+    RepackedWeightsHeader hdr = {};
+    std::memcpy(hdr.magic, repacked_weights_magic, sizeof hdr.magic);
+    hdr.section_size = section_end - section_start;
+    hdr.isa = current_isa();
+    hdr.count = records.size();
+    m_ostream.write(reinterpret_cast<const char*>(&hdr), sizeof hdr);
+
+    auto write_u64 = [&](uint64_t value) {
+        m_ostream.write(reinterpret_cast<const char*>(&value), sizeof value);
+    };
+    for (size_t i = 0; i < records.size(); i++) {
+        write_u64(records[i].id);
+        write_u64(records[i].key.size());
+        m_ostream.write(records[i].key.data(), records[i].key.size());
+        write_u64(records[i].desc.size());
+        m_ostream.write(reinterpret_cast<const char*>(records[i].desc.data()), records[i].desc.size());
+        write_u64(offsets[i]);
+        write_u64(records[i].memory->getSize());
+    }
+    const std::vector<char> padding(repacked_weights_alignment, 0);
+    for (size_t i = 0; i < records.size(); i++) {
+        const size_t position = m_ostream.tellp();
+        m_ostream.write(padding.data(), section_start + offsets[i] - position);
+        m_ostream.write(records[i].memory->getDataAs<const char>(), records[i].memory->getSize());
+    }
+}
 
 void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
     auto serialize_info = [&](std::ostream& stream) {
@@ -26,6 +288,10 @@ void ModelSerializer::operator<<(const std::shared_ptr<ov::Model>& model) {
         xml_doc.save(stream);
     };
 
+    if (m_weights_cache) {
+        write_repacked_weights(model);
+    }
+
     ov::pass::StreamSerialize serializer(m_ostream, serialize_info, m_cache_encrypt);
     serializer.run_on_model(std::const_pointer_cast<ov::Model>(model->clone()));
 }
@@ -50,6 +316,61 @@ ModelDeserializer::ModelDeserializer(std::istream& model_stream,
 
 void ModelDeserializer::set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model) {}
 
+size_t ModelDeserializer::read_repacked_weights(const char* section, size_t available, std::shared_ptr<void> storage) {
+    RepackedWeightsHeader hdr = {};
+    if (available < sizeof hdr) {
+        return 0;
+    }
+    std::memcpy(&hdr, section, sizeof hdr);
+    if (std::memcmp(hdr.magic, repacked_weights_magic, sizeof hdr.magic) != 0) {
+        return 0;
+    }
+    OPENVINO_ASSERT(hdr.section_size <= available, "[CPU] Repacked weights section of the blob is truncated.");
+    // the weights repacked for another ISA are not usable
+    if (hdr.isa != current_isa()) {
+        return hdr.section_size;
+    }
+
+    size_t pos = sizeof hdr;
+    auto read = [&](size_t size) {
+        OPENVINO_ASSERT(pos + size <= hdr.section_size, "[CPU] Repacked weights section of the blob is corrupted.");
+        const char* ptr = section + pos;
+        pos += size;
+        return ptr;
+    };
+    auto read_u64 = [&]() {
+        uint64_t value = 0;
+        std::memcpy(&value, read(sizeof value), sizeof value);
+        return value;
+    };
+
+    auto repacked_weights = std::make_shared<RepackedWeights>();
+    repacked_weights->m_storage = std::move(storage);
+    for (uint64_t i = 0; i < hdr.count; i++) {
+        RepackedWeights::Entry entry;
+        entry.id = read_u64();
+        const size_t key_size = read_u64();
+        entry.key.assign(read(key_size), key_size);
+        const size_t desc_size = read_u64();
+        const auto* desc = reinterpret_cast<const uint8_t*>(read(desc_size));
+        entry.desc.assign(desc, desc + desc_size);
+        const size_t offset = read_u64();
+        entry.size = read_u64();
+        OPENVINO_ASSERT(offset + entry.size <= hdr.section_size,
+                        "[CPU] Repacked weights section of the blob is corrupted.");
+        entry.data = section + offset;
+        // the data is aligned unless the blob itself is placed at an unaligned address
+        if (reinterpret_cast<uintptr_t>(entry.data) % repacked_weights_alignment != 0) {
+            return hdr.section_size;
+        }
+        repacked_weights->m_entries.push_back(std::move(entry));
+    }
+    if (repacked_weights->size() > 0) {
+        m_repacked_weights = std::move(repacked_weights);
+    }
+    return hdr.section_size;
+}
+
 void ModelDeserializer::operator>>(std::shared_ptr<ov::Model>& model) {
     if (m_model_buffer) {
         process_mmap(model, m_model_buffer);
@@ -65,7 +386,8 @@ void ModelDeserializer::process_mmap(std::shared_ptr<ov::Model>& model,
     // Blob from cache may have other header, so need to skip this.
     auto buffer_base = reinterpret_cast<char*>(mmemory->get_ptr());
     const auto file_size = mmemory->size();
-    const size_t hdr_pos = m_istream.tellg();
+    size_t hdr_pos = m_istream.tellg();
+    hdr_pos += read_repacked_weights(buffer_base + hdr_pos, file_size - hdr_pos, mmemory);
 
     pass::StreamSerialize::DataHeader hdr = {};
     std::memcpy(reinterpret_cast<char*>(&hdr), buffer_base + hdr_pos, sizeof hdr);
@@ -124,11 +446,31 @@ void ModelDeserializer::process_mmap(std::shared_ptr<ov::Model>& model,
 }
 
 void ModelDeserializer::process_stream(std::shared_ptr<ov::Model>& model) {
-    const size_t hdr_pos = m_istream.tellg();
+    size_t hdr_pos = m_istream.tellg();
     m_istream.seekg(0, m_istream.end);
     const size_t file_size = m_istream.tellg();
     m_istream.seekg(hdr_pos, m_istream.beg);
 
+    RepackedWeightsHeader weights_hdr = {};
+    if (file_size - hdr_pos >= sizeof weights_hdr) {
+        m_istream.read(reinterpret_cast<char*>(&weights_hdr), sizeof weights_hdr);
+        m_istream.seekg(hdr_pos, m_istream.beg);
+    }
+    if (std::memcmp(weights_hdr.magic, repacked_weights_magic, sizeof weights_hdr.magic) == 0) {
+        OPENVINO_ASSERT(weights_hdr.section_size <= file_size - hdr_pos,
+                        "[CPU] Repacked weights section of the blob is truncated.");
+        if (weights_hdr.isa == current_isa()) {
+            // the section is placed with the same alignment as in the stream, so the entries data stay aligned
+            auto storage = std::make_shared<ov::AlignedBuffer>(weights_hdr.section_size + repacked_weights_alignment,
+                                                               repacked_weights_alignment);
+            auto* section = storage->get_ptr<char>() + hdr_pos % repacked_weights_alignment;
+            m_istream.read(section, weights_hdr.section_size);
+            read_repacked_weights(section, weights_hdr.section_size, storage);
+        }
+        hdr_pos += weights_hdr.section_size;
+        m_istream.seekg(hdr_pos, m_istream.beg);
+    }
+
     pass::StreamSerialize::DataHeader hdr = {};
     m_istream.read(reinterpret_cast<char*>(&hdr), sizeof hdr);
 
@@ -10,20 +10,62 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "utils/codec_xor.hpp"
+#include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
 
+/**
+ * Weights repacked on export, they are stored in the compiled blob ahead of the model and used on import instead of
+ * repacking the weights once more. The cache keys contain addresses of the model constants and of the other cached
+ * objects, so they are stored with the addresses replaced by references, which are resolved against the imported model.
+ */
+class RepackedWeights {
+public:
+    using Ptr = std::shared_ptr<RepackedWeights>;
+
+    /**
+     * @brief Puts the stored weights into the caches, they stay pinned until SocketsWeights::unpin() is called
+     * @param model - imported model, the stored keys refer to its constants
+     */
+    void prefill(SocketsWeights& weights, const std::shared_ptr<const ov::Model>& model) const;
+
+    size_t size() const {
+        return m_entries.size();
+    }
+
+private:
+    friend class ModelSerializer;
+    friend class ModelDeserializer;
+
+    struct Entry {
+        uint64_t id;                // index of the object in the exported cache, other keys refer to it
+        std::string key;            // cache key with the references instead of the addresses
+        std::vector<uint8_t> desc;  // oneDNN memory descriptor blob
+        const char* data;
+        uint64_t size;
+    };
+
+    std::vector<Entry> m_entries;
+    std::shared_ptr<void> m_storage;  // owner of the entries data
+};
+
 class ModelSerializer {
 public:
     using CacheEncrypt = std::function<std::string(const std::string&)>;
 
-    ModelSerializer(std::ostream& ostream, CacheEncrypt encrypt_fn = {});
+    /**
+     * @param weights_cache - the cached repacked weights are stored in the blob if set
+     */
+    ModelSerializer(std::ostream& ostream, CacheEncrypt encrypt_fn = {}, WeightsSharing::Ptr weights_cache = nullptr);
 
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
 private:
+    void write_repacked_weights(const std::shared_ptr<ov::Model>& model);
+
     std::ostream& m_ostream;
     CacheEncrypt m_cache_encrypt;
+    WeightsSharing::Ptr m_weights_cache;
 };
 
 class ModelDeserializer {
@@ -41,6 +83,11 @@ public:
 
     void operator>>(std::shared_ptr<ov::Model>& model);
 
+    // the repacked weights stored in the blob, nullptr if there are none or they were repacked for another ISA
+    const RepackedWeights::Ptr& repacked_weights() const {
+        return m_repacked_weights;
+    }
+
 protected:
     static void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
 
@@ -48,11 +95,19 @@ protected:
 
     void process_stream(std::shared_ptr<ov::Model>& model);
 
+    /**
+     * @brief Parses the repacked weights section if the blob has it at the given position
+     * @param section - the section start, the whole section is expected to be there if the magic matches
+     * @return size of the section, 0 if there is no section
+     */
+    size_t read_repacked_weights(const char* section, size_t available, std::shared_ptr<void> storage);
+
     std::istream& m_istream;
     ModelBuilder m_model_builder;
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
     std::shared_ptr<ov::AlignedBuffer> m_model_buffer;
+    RepackedWeights::Ptr m_repacked_weights;
 };
 
 }  // namespace ov::intel_cpu
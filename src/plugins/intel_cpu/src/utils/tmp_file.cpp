@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tmp_file.hpp"
+
+#include <mutex>
+#include <random>
+#include <sstream>
+
+#ifdef _WIN32
+#    include <process.h>
+#else
+#    include <unistd.h>
+#endif
+
+namespace ov::intel_cpu {
+
+std::string uniqueTmpFileSuffix() {
+    static std::mutex gen_mutex;
+    static std::mt19937_64 gen{std::random_device{}()};
+    std::lock_guard<std::mutex> lock(gen_mutex);
+    std::stringstream ss;
+#ifdef _WIN32
+    ss << '.' << _getpid();
+#else
+    ss << '.' << getpid();
+#endif
+    ss << '.' << std::hex << gen() << ".tmp";
+    return ss.str();
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,17 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <string>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Returns the suffix of a temporary file which is replaced by the target file when it's complete. The suffix is
+ * unique per process and per call, so the concurrent writers of the same file, including the forked processes, never
+ * write to one temporary file.
+ */
+std::string uniqueTmpFileSuffix();
+
+}  // namespace ov::intel_cpu
@@ -4,6 +4,7 @@
 
 #include "weights_cache.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -54,7 +55,10 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
             return true;
         };
 
-        if (!isCached()) {
+        if (isCached()) {
+            hits++;
+        } else {
+            misses++;
             newPtr = create();
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
@@ -116,9 +120,8 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
     return found->second;
 }
 
-#ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
-    Statistics retVal = {0, 0};
+    Statistics retVal;
 
     std::lock_guard<std::mutex> lock(guard);
 
@@ -129,10 +132,34 @@ WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
             retVal.total_memory_objects++;
         }
     }
+    retVal.hits = hits;
+    retVal.misses = misses;
 
     return retVal;
 }
 
+size_t WeightsSharing::pin() {
+    size_t size = 0;
+    std::lock_guard<std::mutex> lock(guard);
+    pinned.clear();
+    for (const auto& item : sharedWeights) {
+        if (auto memory = item.second->sharedMemory.lock()) {
+            size += memory->getDesc().getCurrentMemSize();
+            pinned.push_back(std::move(memory));
+        }
+    }
+    return size;
+}
+
+void WeightsSharing::unpin() {
+    std::vector<MemoryPtr> released;
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        released.swap(pinned);
+    }
+    // the objects nobody uses are freed here, outside of the lock
+}
+
 std::vector<std::pair<int, WeightsSharing::Statistics>> SocketsWeights::dumpStatistics() const {
     std::vector<std::pair<int, WeightsSharing::Statistics>> retVal;
     for (const auto& item : _cache_map) {
@@ -143,5 +170,149 @@ std::vector<std::pair<int, WeightsSharing::Statistics>> SocketsWeights::dumpStat
 
     return retVal;
 }
-#endif  // CPU_DEBUG_CAPS
+
+std::vector<std::pair<std::string, MemoryPtr>> WeightsSharing::getCachedObjects() const {
+    std::vector<std::pair<std::string, MemoryPtr>> retVal;
+    std::lock_guard<std::mutex> lock(guard);
+    for (const auto& item : sharedWeights) {
+        if (auto memory = item.second->sharedMemory.lock()) {
+            retVal.emplace_back(item.first, std::move(memory));
+        }
+    }
+    return retVal;
+}
+
+void WeightsSharing::prefill(const std::string& key, const MemoryPtr& memory) {
+    std::lock_guard<std::mutex> lock(guard);
+    sharedWeights[key] = std::make_shared<MemoryInfo>(memory, true);
+    pinned.push_back(memory);
+}
+
+size_t SocketsWeights::pin() {
+    size_t size = 0;
+    for (const auto& item : _cache_map) {
+        size += item.second->pin();
+    }
+    return size;
+}
+
+void SocketsWeights::unpin() {
+    for (const auto& item : _cache_map) {
+        item.second->unpin();
+    }
+}
+
+void SocketsWeights::prefill(const std::string& key, const MemoryPtr& memory) {
+    for (const auto& item : _cache_map) {
+        item.second->prefill(key, memory);
+    }
+}
+
+std::vector<WeightsSharing::Ptr> SocketsWeights::getCaches() const {
+    std::vector<WeightsSharing::Ptr> retVal;
+    for (const auto& item : _cache_map) {
+        retVal.push_back(item.second);
+    }
+    return retVal;
+}
+
+void WeightsRetention::setBudget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_budget = bytes;
+    const size_t live = liveSize();
+    evict(m_budget > live ? m_budget - live : 0);
+}
+
+void WeightsRetention::retain(const Ticket& ticket, std::shared_ptr<const ov::Model> model, SocketsWeights weights) {
+    const size_t size = weights.pin();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // the caches are not live anymore
+    const auto caches = weights.getCaches();
+    m_live.erase(std::remove_if(m_live.begin(),
+                                m_live.end(),
+                                [&](const std::weak_ptr<WeightsSharing>& live) {
+                                    const auto cache = live.lock();
+                                    return !cache || std::find(caches.begin(), caches.end(), cache) != caches.end();
+                                }),
+                 m_live.end());
+    const size_t live = liveSize();
+    if (size == 0 || size + live > m_budget) {
+        weights.unpin();
+        return;
+    }
+    // the caches of the same model may be retained only once
+    auto found = std::find_if(m_entries.begin(), m_entries.end(), [&](const Entry& entry) {
+        return entry.key == ticket.key;
+    });
+    if (found != m_entries.end()) {
+        m_size -= found->size;
+        found->weights.unpin();
+        m_entries.erase(found);
+    }
+    evict(m_budget - live - size);
+    m_entries.push_front(Entry{ticket.key, std::move(model), std::move(weights), size});
+    m_size += size;
+}
+
+std::optional<WeightsRetention::Retained> WeightsRetention::reclaim(const Ticket& ticket) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = std::find_if(m_entries.begin(), m_entries.end(), [&](const Entry& entry) {
+        return entry.key == ticket.key;
+    });
+    if (found == m_entries.end()) {
+        return std::nullopt;
+    }
+    auto entry = std::move(*found);
+    m_size -= entry.size;
+    m_entries.erase(found);
+    m_reuses++;
+    return Retained{std::move(entry.weights), std::move(entry.model)};
+}
+
+void WeightsRetention::track(const SocketsWeights& weights) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_live.erase(std::remove_if(m_live.begin(),
+                                m_live.end(),
+                                [](const std::weak_ptr<WeightsSharing>& live) {
+                                    return live.expired();
+                                }),
+                 m_live.end());
+    for (const auto& cache : weights.getCaches()) {
+        m_live.push_back(cache);
+    }
+    const size_t live = liveSize();
+    evict(m_budget > live ? m_budget - live : 0);
+}
+
+WeightsRetention::Statistics WeightsRetention::getStatistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Statistics retVal;
+    retVal.budget = m_budget;
+    retVal.retained_size = m_size;
+    retVal.live_size = liveSize();
+    retVal.retained_models = m_entries.size();
+    retVal.reuses = m_reuses;
+    retVal.evictions = m_evictions;
+    return retVal;
+}
+
+size_t WeightsRetention::liveSize() const {
+    size_t size = 0;
+    for (const auto& live : m_live) {
+        if (auto cache = live.lock()) {
+            size += cache->dumpStatistics().total_size;
+        }
+    }
+    return size;
+}
+
+void WeightsRetention::evict(size_t budget) {
+    while (m_size > budget && !m_entries.empty()) {
+        m_size -= m_entries.back().size;
+        m_entries.back().weights.unpin();
+        m_entries.pop_back();
+        m_evictions++;
+    }
+}
+
 }  // namespace ov::intel_cpu
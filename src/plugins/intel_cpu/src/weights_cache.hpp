@@ -6,13 +6,17 @@
 
 #include <atomic>
 #include <functional>
+#include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "cpu_memory.h"
+#include "openvino/core/model.hpp"
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -39,12 +43,20 @@ class WeightsSharing {
     };
 
 public:
-#ifdef CPU_DEBUG_CAPS
     struct Statistics {
-        size_t total_size;  // bytes
-        size_t total_memory_objects;
+        size_t total_size = 0;  // bytes
+        size_t total_memory_objects = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+        Statistics& operator+=(const Statistics& other) {
+            total_size += other.total_size;
+            total_memory_objects += other.total_memory_objects;
+            hits += other.hits;
+            misses += other.misses;
+            return *this;
+        }
     };
-#endif  // CPU_DEBUG_CAPS
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
@@ -70,13 +82,29 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
-#ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
-#endif  // CPU_DEBUG_CAPS
+
+    /**
+     * @brief Keeps the cached objects alive when they have no users anymore
+     * @return total size of the pinned objects in bytes
+     */
+    size_t pin();
+    void unpin();
+
+    // the cached objects which are in use
+    std::vector<std::pair<std::string, MemoryPtr>> getCachedObjects() const;
+
+    /**
+     * @brief Adds a ready object to the cache, it is pinned until unpin() is called
+     */
+    void prefill(const std::string& key, const MemoryPtr& memory);
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    std::vector<MemoryPtr> pinned;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
 };
 
 /**
@@ -91,12 +119,103 @@ public:
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
-#ifdef CPU_DEBUG_CAPS
     std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
-#endif  // CPU_DEBUG_CAPS
+
+    size_t pin();
+    void unpin();
+
+    // adds the object to the caches of all sockets
+    void prefill(const std::string& key, const MemoryPtr& memory);
+
+    std::vector<WeightsSharing::Ptr> getCaches() const;
 
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
 
+/**
+ * Process wide store of the weights caches of the recently released compiled models, bounded by a byte budget.
+ * A released compiled model hands its caches over together with its runtime model, which owns the weights referenced
+ * by the cache keys, so the keys stay unique while the caches are kept. The next compiled model of a model with the
+ * same topology, constant data objects and configuration takes the caches back and skips repacking of the weights,
+ * the keys are valid for it as is. The budget covers the caches of the live compiled models too, the least recently
+ * released caches are evicted first to fit into it.
+ *
+ * Is a thread safe
+ */
+class WeightsRetention {
+public:
+    using Ptr = std::shared_ptr<WeightsRetention>;
+
+    struct Statistics {
+        size_t budget = 0;         // bytes
+        size_t retained_size = 0;  // bytes
+        size_t live_size = 0;      // bytes
+        size_t retained_models = 0;
+        uint64_t reuses = 0;
+        uint64_t evictions = 0;
+    };
+
+    /**
+     * Identifies the caches of a compiled model in the store
+     */
+    struct Ticket {
+        Ptr retention;
+        // signature of the topology and of the constant data addresses of the original model and of the configuration
+        std::string key;
+
+        explicit operator bool() const {
+            return retention && !key.empty();
+        }
+    };
+
+    void setBudget(size_t bytes);
+
+    /**
+     * @brief Keeps the caches of a released compiled model if they fit into the budget
+     * @param model - runtime model of the compiled model, which owns the weights referenced by the cache keys
+     */
+    void retain(const Ticket& ticket, std::shared_ptr<const ov::Model> model, SocketsWeights weights);
+
+    struct Retained {
+        SocketsWeights weights;
+        // runtime model of the released compiled model, the weights it owns must outlive the pinned objects
+        std::shared_ptr<const ov::Model> model;
+    };
+
+    /**
+     * @brief Takes the caches retained for the ticket back, the cached objects stay pinned until unpin() is called
+     */
+    std::optional<Retained> reclaim(const Ticket& ticket);
+
+    /**
+     * @brief Counts the caches of a live compiled model against the budget, the retained caches are evicted to make
+     * room for them
+     */
+    void track(const SocketsWeights& weights);
+
+    Statistics getStatistics() const;
+
+private:
+    struct Entry {
+        std::string key;
+        std::shared_ptr<const ov::Model> model;
+        SocketsWeights weights;
+        size_t size;
+    };
+
+    void evict(size_t budget);
+    size_t liveSize() const;
+
+    mutable std::mutex m_mutex;
+    // the most recently retained caches first
+    std::list<Entry> m_entries;
+    // the caches of the live compiled models
+    std::vector<std::weak_ptr<WeightsSharing>> m_live;
+    size_t m_budget = 0;
+    size_t m_size = 0;
+    uint64_t m_reuses = 0;
+    uint64_t m_evictions = 0;
+};
+
 }  // namespace ov::intel_cpu
@@ -7,6 +7,7 @@
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 #include "openvino/opsets/opset9_decl.hpp"
 #include "openvino/op/matmul.hpp"
@@ -126,4 +127,30 @@ INSTANTIATE_TEST_SUITE_P(smoke_ExportImportTest,
                                                              testing_property_for_enable_hyper_threading,
                                                              testing_property_for_enable_cpu_pinning)));
 
+TEST(ExportImportTest, smoke_RepackedWeightsAreStoredInBlob) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    using Statistics = std::map<std::string, uint64_t>;
+    ov::Core core;
+    auto compiled_model = core.compile_model(MakeMatMulModel(), "CPU", {{"CPU_CACHE_REPACKED_WEIGHTS", true}});
+    auto original_stats = compiled_model.get_property("CPU_WEIGHTS_CACHE_STATISTICS").as<Statistics>();
+
+    std::stringstream exported_model;
+    compiled_model.export_model(exported_model);
+    auto imported_model = core.import_model(exported_model, "CPU");
+    auto imported_stats = imported_model.get_property("CPU_WEIGHTS_CACHE_STATISTICS").as<Statistics>();
+    // the imported weights are not repacked again
+    EXPECT_LT(imported_stats.at("MISSES"), original_stats.at("MISSES"));
+
+    auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{1, 4096});
+    auto infer = [&](ov::CompiledModel& model) {
+        auto request = model.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        return request.get_output_tensor();
+    };
+    auto expected = infer(compiled_model);
+    auto actual = infer(imported_model);
+    ov::test::utils::compare(expected, actual);
+}
+
 }  // namespace
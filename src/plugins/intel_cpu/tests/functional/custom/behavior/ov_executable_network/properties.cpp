@@ -518,4 +518,39 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCPURuntimOptionsWithCorePr
     ASSERT_EQ(valueCacheType.as<ov::element::Type>(), ov::element::bf16);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkReuseRetainedWeights) {
+    ov::Core core;
+    using Statistics = std::map<std::string, uint64_t>;
+    OV_ASSERT_NO_THROW(core.set_property(deviceName, {{"CPU_WEIGHTS_CACHE_BUDGET", uint64_t(1) << 30}}));
+
+    Statistics first;
+    {
+        ov::CompiledModel compiledModel;
+        OV_ASSERT_NO_THROW(compiledModel = core.compile_model(model, deviceName));
+        OV_ASSERT_NO_THROW(first = compiledModel.get_property("CPU_WEIGHTS_CACHE_STATISTICS").as<Statistics>());
+    }
+    ASSERT_GT(first.at("MISSES"), 0);
+    auto retained = core.get_property(deviceName, "CPU_RETAINED_WEIGHTS_STATISTICS").as<Statistics>();
+    ASSERT_EQ(retained.at("RETAINED_MODELS"), 1);
+
+    // the same model with the same properties takes the repacked weights back
+    ov::CompiledModel compiledModel;
+    OV_ASSERT_NO_THROW(compiledModel = core.compile_model(model, deviceName));
+    auto second = compiledModel.get_property("CPU_WEIGHTS_CACHE_STATISTICS").as<Statistics>();
+    ASSERT_EQ(second.at("MISSES"), first.at("MISSES"));
+    ASSERT_GT(second.at("HITS"), first.at("HITS"));
+    retained = core.get_property(deviceName, "CPU_RETAINED_WEIGHTS_STATISTICS").as<Statistics>();
+    ASSERT_EQ(retained.at("RETAINED_MODELS"), 0);
+    ASSERT_EQ(retained.at("REUSES"), 1);
+    // the weights of the live compiled model count against the budget
+    ASSERT_EQ(retained.at("LIVE_SIZE"), second.at("SIZE"));
+
+    // the caches are not shared with the compilation of the same model with different properties
+    compiledModel = {};
+    OV_ASSERT_NO_THROW(compiledModel = core.compile_model(model, deviceName, ov::hint::num_requests(2)));
+    retained = core.get_property(deviceName, "CPU_RETAINED_WEIGHTS_STATISTICS").as<Statistics>();
+    ASSERT_EQ(retained.at("RETAINED_MODELS"), 1);
+    ASSERT_EQ(retained.at("REUSES"), 1);
+}
+
 }  // namespace
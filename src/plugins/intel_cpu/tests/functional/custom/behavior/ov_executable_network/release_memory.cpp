@@ -4,11 +4,15 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "common_test_utils/node_builders/convolution.hpp"
 #include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
 #include "openvino/opsets/opset10_decl.hpp"
 #include "openvino/op/add.hpp"
 #include "openvino/op/reduce_mean.hpp"
@@ -119,6 +123,58 @@ TEST_P(MemoryReleaseTest, ConsequitiveRelease) {
     }
 }
 
+TEST_P(MemoryReleaseTest, SharedActivationMemory) {
+    configuration.insert({"CPU_SHARED_ACTIVATION_MEMORY", true});
+    compile_model();
+    // both models lease the intermediate memory from the same pool in turns
+    auto otherModel = core->compile_model(function, targetDevice, configuration);
+    auto otherRequest = otherModel.create_infer_request();
+    for (const auto& targetStaticShapeVec : targetStaticShapes) {
+        generate_inputs(targetStaticShapeVec);
+        for (const auto& input : inputs) {
+            otherRequest.set_tensor(input.first, input.second);
+        }
+        otherRequest.infer();
+        validate();
+        utils::compare(inferRequest.get_output_tensor(0),
+                       otherRequest.get_output_tensor(0),
+                       abs_threshold,
+                       rel_threshold);
+    }
+    compiledModel.release_memory();
+    for (const auto& targetStaticShapeVec : targetStaticShapes) {
+        generate_inputs(targetStaticShapeVec);
+        validate();
+    }
+}
+
+TEST_P(MemoryReleaseTest, IdleTimeoutRelease) {
+    configuration.insert({"CPU_IDLE_MEMORY_RELEASE_TIMEOUT", 10});
+    compile_model();
+    auto releases = [&](const std::string& counter) {
+        return compiledModel.get_property("CPU_MEMORY_RELEASE_STATISTICS")
+            .as<std::map<std::string, uint64_t>>()
+            .at(counter);
+    };
+    for (const auto& targetStaticShapeVec : targetStaticShapes) {
+        generate_inputs(targetStaticShapeVec);
+        validate();
+        // the watchdog releases the memory of the idle model, the next inference allocates it again
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        const auto released = releases("RELEASES");
+        while (releases("RELEASES") == released && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_GT(releases("RELEASES"), released);
+    }
+    const auto reallocations = releases("REALLOCATIONS");
+    for (const auto& targetStaticShapeVec : targetStaticShapes) {
+        generate_inputs(targetStaticShapeVec);
+        validate();
+    }
+    ASSERT_GT(releases("REALLOCATIONS"), reallocations);
+}
+
 INSTANTIATE_TEST_SUITE_P(smoke_release_memory,
                          MemoryReleaseTest,
                          ::testing::Values(true, false),
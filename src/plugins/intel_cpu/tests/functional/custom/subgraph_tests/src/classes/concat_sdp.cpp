@@ -264,6 +264,50 @@ TEST_P(ConcatSDPTest, CompareWithRefs) {
     }
 }
 
+TEST_P(ConcatSDPTest, PagedKVCache) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto expectedOutputs = run_test(function);
+    // small blocks to cross the block boundaries several times
+    configuration["KV_CACHE_PAGED_BLOCK_SIZE"] = "4";
+    auto actualOutputs = run_test(function);
+    for (size_t i = 0; i < actualOutputs.size(); i++) {
+        ov::test::utils::compare(expectedOutputs[i], actualOutputs[i], abs_threshold, rel_threshold);
+    }
+}
+
+TEST_P(ConcatSDPTest, ForkState) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    auto expectedOutputs = run_test(function);
+    const size_t forkStep = targetStaticShapes.size() / 2;
+    for (auto pagedBlockSize : {"0", "4"}) {
+        configuration["KV_CACHE_PAGED_BLOCK_SIZE"] = pagedBlockSize;
+        prepare();
+        auto forkedRequest = compiledModel.create_infer_request();
+        auto infer = [&](ov::InferRequest& request, size_t idx) {
+            generate(static_cast<int>(idx), targetStaticShapes[idx]);
+            for (const auto& input : inputs) {
+                request.set_tensor(input.first, input.second);
+            }
+            request.infer();
+            ov::test::utils::compare(expectedOutputs[idx], request.get_output_tensor(0), abs_threshold, rel_threshold);
+        };
+        for (size_t i = 0; i < forkStep; i++) {
+            infer(inferRequest, i);
+        }
+        for (auto&& state : forkedRequest.query_state()) {
+            for (auto&& source : inferRequest.query_state()) {
+                if (source.get_name() == state.get_name()) {
+                    state.fork_from(source);
+                }
+            }
+        }
+        // both requests continue from the common prefix and must not affect each other
+        for (size_t i = forkStep; i < targetStaticShapes.size(); i++) {
+            infer(forkedRequest, i);
+            infer(inferRequest, i);
+        }
+    }
+}
 
 }  // namespace test
 }  // namespace ov
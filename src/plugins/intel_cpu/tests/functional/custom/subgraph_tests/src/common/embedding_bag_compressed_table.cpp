@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// The embedding tables of recommender models are stored compressed (u8/i8 with per row scale and zero point, or f16).
+// The decompression of the table (Convert -> [Subtract] -> [Multiply]) is fused into the EmbeddingBag node, which
+// dequantizes the looked up rows on the fly instead of keeping the whole table in f32. The test checks the result
+// against the reference and that the decompression subgraph doesn't remain in the compiled model.
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/embeddingbag_offsets_sum.hpp"
+#include "openvino/op/embeddingbag_packedsum.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/subtract.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "transformations/rt_info/decompression.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+using EmbeddingBagCompressedTableParams = std::tuple<ov::element::Type,  // Table precision
+                                                     bool,               // With zero point
+                                                     std::string>;       // EmbeddingBag type: Offsets or Packed
+
+class EmbeddingBagCompressedTableTest : public testing::WithParamInterface<EmbeddingBagCompressedTableParams>,
+                                        virtual public SubgraphBaseTest,
+                                        public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagCompressedTableParams>& obj) {
+        ov::element::Type table_type;
+        bool with_zero_point;
+        std::string embedding_bag;
+        std::tie(table_type, with_zero_point, embedding_bag) = obj.param;
+        std::ostringstream result;
+        result << "table=" << table_type << "_zeroPoint=" << with_zero_point << "_" << embedding_bag;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::element::Type table_type;
+        bool with_zero_point;
+        std::string embedding_bag;
+        std::tie(table_type, with_zero_point, embedding_bag) = GetParam();
+
+        const size_t rows = 64;
+        const size_t depth = 24;
+        const size_t bags = 5;
+        const size_t bag_size = 6;
+        // The repeated indices make the rows hot
+        std::vector<int32_t> indices(bags * bag_size);
+        for (size_t i = 0; i < indices.size(); i++) {
+            indices[i] = static_cast<int32_t>(i % 3 == 0 ? 7 : (i * 13) % rows);
+        }
+
+        std::shared_ptr<ov::Node> table = ov::test::utils::make_constant(table_type, {rows, depth});
+        table = std::make_shared<ov::op::v0::Convert>(table, ov::element::f32);
+        if (table_type == ov::element::f16) {
+            mark_as_decompression(table);
+        } else {
+            if (with_zero_point) {
+                auto zero_point = ov::test::utils::make_constant(table_type, {rows, 1});
+                auto zero_point_convert = std::make_shared<ov::op::v0::Convert>(zero_point, ov::element::f32);
+                table = std::make_shared<ov::op::v1::Subtract>(table, zero_point_convert);
+            }
+            auto scale = ov::test::utils::make_constant(ov::element::f32,
+                                                        {rows, 1},
+                                                        ov::test::utils::InputGenerateData(0, 1, 1000, 1));
+            table = std::make_shared<ov::op::v1::Multiply>(table, scale);
+        }
+
+        std::shared_ptr<ov::Node> embedding;
+        ov::ParameterVector params;
+        if (embedding_bag == "Offsets") {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{indices.size()}));
+            std::vector<int32_t> offsets(bags);
+            for (size_t i = 0; i < bags; i++) {
+                offsets[i] = static_cast<int32_t>(i * bag_size);
+            }
+            embedding = std::make_shared<ov::op::v3::EmbeddingBagOffsetsSum>(
+                table,
+                ov::op::v0::Constant::create(ov::element::i32, {indices.size()}, indices),
+                ov::op::v0::Constant::create(ov::element::i32, {bags}, offsets),
+                ov::op::v0::Constant::create(ov::element::i32, {}, {0}),
+                params[0]);
+        } else {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{bags, bag_size}));
+            embedding = std::make_shared<ov::op::v3::EmbeddingBagPackedSum>(
+                table,
+                ov::op::v0::Constant::create(ov::element::i32, {bags, bag_size}, indices),
+                params[0]);
+        }
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{embedding}, params, "EmbeddingBagCompressedTable");
+    }
+};
+
+TEST_P(EmbeddingBagCompressedTableTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagCompressedTable_Int8,
+                         EmbeddingBagCompressedTableTest,
+                         ::testing::Combine(::testing::Values(ov::element::u8, ov::element::i8),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values("Offsets", "Packed")),
+                         EmbeddingBagCompressedTableTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagCompressedTable_F16,
+                         EmbeddingBagCompressedTableTest,
+                         ::testing::Combine(::testing::Values(ov::element::f16),
+                                            ::testing::Values(false),
+                                            ::testing::Values("Offsets", "Packed")),
+                         EmbeddingBagCompressedTableTest::getTestCaseName);
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,133 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// The top-k sampling subgraph of a language model (temperature, TopK, Softmax, Multinomial and Gather of the sampled
+// positions from the TopK indices) is fused into one LLMSampling node that selects the tokens without sorting the
+// whole vocabulary. The test uses k = 1, so the sampled tokens don't depend on the random generator and are compared
+// with the reference, and checks that the chain is replaced by the fused node.
+
+#include <numeric>
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/log_softmax.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+
+namespace ov {
+namespace test {
+
+using LLMSamplingFusionParams = std::tuple<InputShape,    // Logits shape
+                                           std::string,   // Distribution: Softmax, LogSoftmax or Logits
+                                           std::string>;  // Temperature: Multiply or Divide
+
+class LLMSamplingFusionTest : public testing::WithParamInterface<LLMSamplingFusionParams>,
+                              virtual public SubgraphBaseTest,
+                              public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LLMSamplingFusionParams>& obj) {
+        InputShape input_shape;
+        std::string distribution, temperature;
+        std::tie(input_shape, distribution, temperature) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({input_shape.first}) << "_TS=";
+        for (const auto& shape : input_shape.second) {
+            result << ov::test::utils::vec2str(shape) << "_";
+        }
+        result << "distribution=" << distribution << "_temperature=" << temperature;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        InputShape input_shape;
+        std::string distribution, temperature;
+        std::tie(input_shape, distribution, temperature) = GetParam();
+        init_input_shapes({input_shape});
+
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        std::shared_ptr<ov::Node> scaled;
+        if (temperature == "Multiply") {
+            auto scale = ov::op::v0::Constant::create(ov::element::f32, {1, 1}, {1.25f});
+            scaled = std::make_shared<ov::op::v1::Multiply>(logits, scale);
+        } else {
+            auto scale = ov::op::v0::Constant::create(ov::element::f32, {}, {0.8f});
+            scaled = std::make_shared<ov::op::v1::Divide>(logits, scale);
+        }
+
+        auto k = ov::op::v0::Constant::create(ov::element::i64, {}, {1});
+        auto topk = std::make_shared<ov::op::v11::TopK>(scaled,
+                                                        k,
+                                                        -1,
+                                                        ov::op::TopKMode::MAX,
+                                                        ov::op::TopKSortType::SORT_VALUES,
+                                                        ov::element::i64);
+        ov::Output<ov::Node> probs = topk->output(0);
+        bool log_probs = true;
+        if (distribution == "Softmax") {
+            probs = std::make_shared<ov::op::v8::Softmax>(probs, -1);
+            log_probs = false;
+        } else if (distribution == "LogSoftmax") {
+            probs = std::make_shared<ov::op::v5::LogSoftmax>(probs, 1);
+        }
+
+        auto num_samples = ov::op::v0::Constant::create(ov::element::i32, {}, {3});
+        auto multinomial =
+            std::make_shared<ov::op::v13::Multinomial>(probs, num_samples, ov::element::i32, true, log_probs, 1, 2);
+        auto axis = ov::op::v0::Constant::create(ov::element::i64, {}, {1});
+        auto tokens = std::make_shared<ov::op::v8::Gather>(topk->output(1), multinomial, axis, 1);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{tokens}, ov::ParameterVector{logits}, "LLMSampling");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        // The distinct logits make the top token unique
+        const auto& shape = targetInputStaticShapes[0];
+        ov::Tensor tensor(ov::element::f32, shape);
+        auto* data = tensor.data<float>();
+        std::vector<size_t> order(shape[1]);
+        std::iota(order.begin(), order.end(), 0);
+        for (size_t b = 0; b < shape[0]; ++b) {
+            std::rotate(order.begin(), order.begin() + (b * 7 + 3) % order.size(), order.end());
+            for (size_t i = 0; i < order.size(); ++i) {
+                data[b * order.size() + i] = static_cast<float>(order[i]) * 0.01f - 2.0f;
+            }
+        }
+        inputs.insert({function->inputs()[0].get_node_shared_ptr(), tensor});
+    }
+};
+
+TEST_P(LLMSamplingFusionTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "LLMSampling", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Multinomial", 0);
+    CheckNumberOfNodesWithType(compiledModel, "TopK", 0);
+}
+
+namespace {
+const std::vector<InputShape> input_shapes = {
+    {{}, {{2, 1000}}},
+    {{-1, 1000}, {{1, 1000}, {4, 1000}, {1, 1000}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LLMSamplingFusion,
+                         LLMSamplingFusionTest,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes),
+                                            ::testing::Values("Softmax", "LogSoftmax", "Logits"),
+                                            ::testing::Values("Multiply", "Divide")),
+                         LLMSamplingFusionTest::getTestCaseName);
+}  // namespace
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// The output shapes of the nodes of a dynamic graph are memorized for the recent input shapes of the graph, so the
+// shape inference is skipped when the input shapes repeat. The test repeats the input shapes with the cache large
+// enough to keep all of them, with the cache evicting the plans and with the cache disabled, and checks the lookups
+// counted by the cache.
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/softmax.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+class ShapesPlanCacheTest : public testing::WithParamInterface<uint64_t>, public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<uint64_t>& obj) {
+        return "capacity=" + std::to_string(obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::shapes_plan_cache_capacity(GetParam()));
+
+        InputShape inputShape{{-1, -1, 16},
+                              {{2, 5, 16}, {4, 7, 16}, {2, 5, 16}, {1, 1, 16}, {4, 7, 16}, {2, 5, 16}, {1, 1, 16}}};
+        init_input_shapes({inputShape});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes.front());
+        auto weights = ov::test::utils::make_constant(ov::element::f32, {16, 32});
+        auto matmul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+        auto bias = ov::test::utils::make_constant(ov::element::f32, {1, 1, 32});
+        auto add = ov::test::utils::make_eltwise(matmul, bias, ov::test::utils::EltwiseTypes::ADD);
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(add, -1);
+        auto pattern = std::make_shared<ov::op::v0::Constant>(ov::element::i32, ov::Shape{2}, std::vector<int>{0, -1});
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(softmax, pattern, true);
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(reshape)};
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "ShapesPlanCache");
+    }
+};
+
+TEST_P(ShapesPlanCacheTest, CompareWithRefs) {
+    run();
+
+    // the input shapes are A, B, A, C, B, A, C
+    const std::map<uint64_t, std::map<std::string, uint64_t>> expected{
+        {0, {{"HITS", 0}, {"MISSES", 0}, {"EVICTIONS", 0}}},
+        {2, {{"HITS", 1}, {"MISSES", 6}, {"EVICTIONS", 4}}},
+        {16, {{"HITS", 4}, {"MISSES", 3}, {"EVICTIONS", 0}}},
+    };
+    const auto stats = compiledModel.get_property(ov::intel_cpu::shapes_plan_cache_statistics);
+    ASSERT_EQ(expected.at(GetParam()), stats);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ShapesPlanCache,
+                         ShapesPlanCacheTest,
+                         ::testing::Values(0, 2, 16),
+                         ShapesPlanCacheTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
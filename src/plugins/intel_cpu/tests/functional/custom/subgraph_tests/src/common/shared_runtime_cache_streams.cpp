@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// When the runtime cache is shared between the streams (CPU_RUNTIME_CACHE_SHARED), the streams which infer the same
+// shapes look up the same keys concurrently. The executors of Snippets subgraphs and SDPA hold the scratch buffers of
+// the stream they belong to, so they must not be handed out to the other streams. The test infers the same shapes
+// from several streams at once with different data and compares every result with a single stream compiled model.
+
+#include <thread>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace test {
+
+class SharedRuntimeCacheStreamsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const ov::PartialShape shape{-1, 4, -1, 64};
+        ov::ParameterVector params;
+        for (size_t i = 0; i < 3; i++) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+        }
+        auto sdpa = std::make_shared<ov::op::v13::ScaledDotProductAttention>(params[0], params[1], params[2], false);
+        // the eltwise chain over dynamic shapes is executed by a Snippets subgraph
+        auto shift = ov::test::utils::make_constant(ov::element::f32, {1, 4, 1, 64});
+        auto add = ov::test::utils::make_eltwise(sdpa, shift, ov::test::utils::EltwiseTypes::ADD);
+        auto scale = ov::test::utils::make_constant(ov::element::f32, {1, 4, 1, 64});
+        auto multiply = ov::test::utils::make_eltwise(add, scale, ov::test::utils::EltwiseTypes::MULTIPLY);
+        auto relu = std::make_shared<ov::op::v0::Relu>(multiply);
+        model = std::make_shared<ov::Model>(ov::OutputVector{relu}, params, "SharedRuntimeCacheStreams");
+    }
+
+    std::shared_ptr<ov::Model> model;
+};
+
+TEST_F(SharedRuntimeCacheStreamsTest, ConcurrentInferOfSameShapes) {
+    constexpr size_t num_streams = 4;
+    constexpr size_t iterations = 20;
+    const std::vector<ov::Shape> shapes = {{1, 4, 32, 64}, {2, 4, 48, 64}};
+
+    ov::Core core;
+    auto ref_model = core.compile_model(model,
+                                        ov::test::utils::DEVICE_CPU,
+                                        {ov::num_streams(1),
+                                         ov::hint::inference_precision(ov::element::f32),
+                                         ov::intel_cpu::cpu_runtime_cache_shared(false)});
+    auto compiled_model = core.compile_model(model,
+                                             ov::test::utils::DEVICE_CPU,
+                                             {ov::num_streams(num_streams),
+                                              ov::hint::inference_precision(ov::element::f32),
+                                              ov::intel_cpu::cpu_runtime_cache_shared(true)});
+
+    // every stream infers the same shapes with its own data
+    std::vector<std::vector<std::vector<ov::Tensor>>> inputs(num_streams);
+    std::vector<std::vector<ov::Tensor>> expected(num_streams);
+    auto ref_request = ref_model.create_infer_request();
+    for (size_t stream = 0; stream < num_streams; stream++) {
+        for (const auto& shape : shapes) {
+            std::vector<ov::Tensor> tensors;
+            for (size_t i = 0; i < model->inputs().size(); i++) {
+                ov::test::utils::InputGenerateData data(-1, 2, 100, static_cast<int32_t>(stream * 10 + i + 1));
+                tensors.push_back(ov::test::utils::create_and_fill_tensor(ov::element::f32, shape, data));
+                ref_request.set_input_tensor(i, tensors.back());
+            }
+            ref_request.infer();
+            const auto& ref_output = ref_request.get_output_tensor();
+            ov::Tensor output(ref_output.get_element_type(), ref_output.get_shape());
+            ref_output.copy_to(output);
+            expected[stream].push_back(output);
+            inputs[stream].push_back(tensors);
+        }
+    }
+
+    std::vector<std::vector<ov::Tensor>> actual(num_streams);
+    std::vector<std::thread> threads;
+    for (size_t stream = 0; stream < num_streams; stream++) {
+        threads.emplace_back([&, stream] {
+            auto request = compiled_model.create_infer_request();
+            for (size_t iteration = 0; iteration < iterations; iteration++) {
+                for (size_t s = 0; s < shapes.size(); s++) {
+                    for (size_t i = 0; i < inputs[stream][s].size(); i++) {
+                        request.set_input_tensor(i, inputs[stream][s][i]);
+                    }
+                    request.infer();
+                    const auto& output = request.get_output_tensor();
+                    ov::Tensor copy(output.get_element_type(), output.get_shape());
+                    output.copy_to(copy);
+                    actual[stream].push_back(copy);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (size_t stream = 0; stream < num_streams; stream++) {
+        ASSERT_EQ(actual[stream].size(), iterations * shapes.size());
+        for (size_t i = 0; i < actual[stream].size(); i++) {
+            ov::test::utils::compare(expected[stream][i % shapes.size()], actual[stream][i]);
+        }
+    }
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// The code generated for the Snippets subgraphs of static shapes may be kept in a process wide cache and reused by the
+// other compiled models with the same subgraphs. The test compiles the model twice, checks that the second compiled
+// model takes the code of the first one from the cache only when it is enabled, and checks the results of both of them.
+// With the cache directory of the device the code is also written to the directory to be read by the other processes,
+// the test checks that the code file is written.
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/relu.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+class SnippetsSharedCodeCacheTest : public testing::WithParamInterface<bool>, public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<bool>& obj) {
+        return std::string("shared=") + (obj.param ? "true" : "false");
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::snippets_shared_code_cache(GetParam()));
+
+        const auto shape = input_shape();
+        init_input_shapes({InputShape{{}, {shape}}});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes.front());
+        auto shift = ov::test::utils::make_constant(ov::element::f32, {1, shape[1], 1, 1});
+        auto add = ov::test::utils::make_eltwise(param, shift, ov::test::utils::EltwiseTypes::ADD);
+        auto scale = ov::test::utils::make_constant(ov::element::f32, {1, shape[1], 1, 1});
+        auto multiply = ov::test::utils::make_eltwise(add, scale, ov::test::utils::EltwiseTypes::MULTIPLY);
+        auto relu = std::make_shared<ov::op::v0::Relu>(multiply);
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(relu)};
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "SnippetsSharedCodeCache");
+    }
+
+    // the shapes differ per test, so the code of one test isn't taken from the shared cache by another one
+    virtual ov::Shape input_shape() const {
+        return {1, 16, 32, 32};
+    }
+};
+
+TEST_P(SnippetsSharedCodeCacheTest, CompareWithRefs) {
+    auto cache_hits = [this]() {
+        return core->get_property(targetDevice, ov::intel_cpu::snippets_shared_code_cache_statistics).at("HITS");
+    };
+
+    run();
+
+    const auto hits = cache_hits();
+    compile_model();
+    if (GetParam()) {
+        EXPECT_GT(cache_hits(), hits) << "The second compiled model has generated the code again";
+    } else {
+        EXPECT_EQ(cache_hits(), hits);
+    }
+    generate_inputs(targetStaticShapes.front());
+    validate();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsSharedCodeCache,
+                         SnippetsSharedCodeCacheTest,
+                         ::testing::Bool(),
+                         SnippetsSharedCodeCacheTest::getTestCaseName);
+
+class SnippetsPersistedCodeCacheTest : public SnippetsSharedCodeCacheTest {
+protected:
+    void SetUp() override {
+        SnippetsSharedCodeCacheTest::SetUp();
+        m_cache_dir = ov::test::utils::generateTestFilePrefix() + "_snippets_code_cache";
+        core->set_property(ov::cache_dir(m_cache_dir));
+    }
+
+    void TearDown() override {
+        core->set_property(ov::cache_dir(""));
+        ov::test::utils::removeFilesWithExt(m_cache_dir, "code");
+        ov::test::utils::removeFilesWithExt(m_cache_dir, "blob");
+        ov::test::utils::removeDir(m_cache_dir);
+        SnippetsSharedCodeCacheTest::TearDown();
+    }
+
+    ov::Shape input_shape() const override {
+        return {1, 8, 16, 16};
+    }
+
+    std::string m_cache_dir;
+};
+
+TEST_P(SnippetsPersistedCodeCacheTest, CompareWithRefs) {
+    run();
+    EXPECT_FALSE(ov::test::utils::listFilesWithExt(m_cache_dir, "code").empty())
+        << "The code of the subgraph isn't written to the cache directory";
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsPersistedCodeCache,
+                         SnippetsPersistedCodeCacheTest,
+                         ::testing::Values(true),
+                         SnippetsSharedCodeCacheTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,86 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// Motivation:
+// A static TensorIterator binds the body inputs and outputs directly to the chunks of the outer tensors when the
+// sliced chunks are dense, and passes the back edge data by swapping two buffers instead of copying it.
+// The test covers a recurrent body with a sliced input, a back edge, a concatenated output and a last iteration
+// output for the dense (axis 0) and the strided (axis 1) chunks iterated in both directions.
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/node_builders/activation.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/tensor_iterator.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+namespace ov {
+namespace test {
+
+using TensorIteratorZeroCopyParams = std::tuple<int64_t,  // Sequence axis
+                                                int64_t>;  // Stride
+
+class TensorIteratorZeroCopyTest : public testing::WithParamInterface<TensorIteratorZeroCopyParams>,
+                                   public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorZeroCopyParams>& obj) {
+        int64_t axis, stride;
+        std::tie(axis, stride) = obj.param;
+        std::ostringstream result;
+        result << "axis=" << axis << "_stride=" << stride;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        int64_t axis, stride;
+        std::tie(axis, stride) = GetParam();
+
+        ov::Shape data_shape{2, 2, 8};
+        data_shape[axis] = 32;
+        ov::Shape state_shape{2, 2, 8};
+        state_shape[axis] = 1;
+        init_input_shapes(static_shapes_to_test_representation({data_shape, state_shape}));
+
+        auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto init_state = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[1]);
+
+        auto body_data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, state_shape);
+        auto body_state = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, state_shape);
+        auto sum = std::make_shared<ov::op::v1::Add>(body_data, body_state);
+        auto state = ov::test::utils::make_activation(sum, ov::element::f32, ov::test::utils::ActivationTypes::Tanh);
+        auto out = ov::test::utils::make_activation(sum, ov::element::f32, ov::test::utils::ActivationTypes::Relu);
+        auto state_res = std::make_shared<ov::op::v0::Result>(state);
+        auto out_res = std::make_shared<ov::op::v0::Result>(out);
+        auto body = std::make_shared<ov::Model>(ov::ResultVector{state_res, out_res},
+                                                ov::ParameterVector{body_data, body_state},
+                                                "body");
+
+        auto tensor_iterator = std::make_shared<ov::op::v0::TensorIterator>();
+        tensor_iterator->set_function(body);
+        const int64_t start = stride > 0 ? 0 : -1;
+        const int64_t end = stride > 0 ? -1 : 0;
+        tensor_iterator->set_sliced_input(body_data, data, start, stride, 1, end, axis);
+        tensor_iterator->set_merged_input(body_state, init_state, state_res);
+        auto concat_out = tensor_iterator->get_concatenated_slices(out_res, start, stride, 1, end, axis);
+        auto last_state = tensor_iterator->get_iter_value(state_res, -1);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{concat_out, last_state},
+                                               ov::ParameterVector{data, init_state},
+                                               "TensorIteratorZeroCopy");
+    }
+};
+
+TEST_P(TensorIteratorZeroCopyTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorZeroCopy,
+                         TensorIteratorZeroCopyTest,
+                         ::testing::Combine(::testing::ValuesIn(std::vector<int64_t>{0, 1}),
+                                            ::testing::ValuesIn(std::vector<int64_t>{1, -1})),
+                         TensorIteratorZeroCopyTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "activation_mem_pool.h"
+
+using namespace ov::intel_cpu;
+
+TEST(ActivationMemoryPoolTest, ReusesReleasedArena) {
+    ActivationMemoryPool pool;
+    auto first = pool.acquire(1024);
+    ASSERT_NE(first.first, nullptr);
+    ASSERT_GE(first.second, 1024);
+    pool.release(first.first);
+
+    auto second = pool.acquire(512);
+    ASSERT_EQ(second.first, first.first);
+    ASSERT_EQ(pool.size(), first.second);
+    pool.release(second.first);
+}
+
+TEST(ActivationMemoryPoolTest, ConcurrentLeases) {
+    ActivationMemoryPool pool;
+    auto first = pool.acquire(1024);
+    auto second = pool.acquire(1024);
+    ASSERT_NE(first.first, second.first);
+    ASSERT_EQ(pool.size(), first.second + second.second);
+    pool.release(first.first);
+    pool.release(second.first);
+
+    // the pool doesn't grow over the peak number of the concurrent leases
+    for (int i = 0; i < 10; i++) {
+        auto arena = pool.acquire(1024);
+        pool.release(arena.first);
+    }
+    ASSERT_EQ(pool.size(), first.second + second.second);
+}
+
+TEST(ActivationMemoryPoolTest, ReplacesSmallArena) {
+    ActivationMemoryPool pool;
+    auto small = pool.acquire(256);
+    pool.release(small.first);
+
+    auto big = pool.acquire(4096);
+    ASSERT_GE(big.second, 4096);
+    ASSERT_EQ(pool.size(), big.second);
+    pool.release(big.first);
+}
+
+TEST(ActivationMemoryPoolTest, ThrowsOnForeignMemory) {
+    ActivationMemoryPool pool;
+    int value = 0;
+    ASSERT_THROW(pool.release(&value), ov::Exception);
+}
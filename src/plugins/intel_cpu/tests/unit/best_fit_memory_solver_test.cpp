@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "best_fit_memory_solver.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace ov::intel_cpu;
+using Box = ov::MemorySolver::Box;
+
+namespace {
+void checkNoOverlap(std::vector<Box> boxes, const BestFitMemorySolver& solver, int64_t total) {
+    ov::MemorySolver::normalize_boxes(boxes);
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const auto offset_i = solver.get_offset(boxes[i].id);
+        ASSERT_GE(offset_i, 0);
+        ASSERT_LE(offset_i + boxes[i].size, total);
+        for (size_t j = i + 1; j < boxes.size(); j++) {
+            if (boxes[i].start > boxes[j].finish || boxes[j].start > boxes[i].finish) {
+                continue;
+            }
+            const auto offset_j = solver.get_offset(boxes[j].id);
+            ASSERT_TRUE(offset_i >= offset_j + boxes[j].size || offset_j >= offset_i + boxes[i].size)
+                << "boxes " << boxes[i].id << " and " << boxes[j].id << " overlap";
+        }
+    }
+}
+}  // namespace
+
+//  |
+//  |      ____  ____
+//  |   __|____||____|
+//  |__|____||____|_____
+//      0  1  2  3  4
+TEST(BestFitMemorySolverTest, Chain) {
+    std::vector<Box> boxes{{0, 1, 2, 0}, {1, 2, 2, 1}, {2, 3, 2, 2}, {3, 4, 2, 3}};
+    for (bool refine : {false, true}) {
+        BestFitMemorySolver solver(boxes);
+        ASSERT_EQ(solver.solve(refine), 4);
+        EXPECT_EQ(solver.get_offset(0) + solver.get_offset(1), 2);
+        EXPECT_EQ(solver.get_offset(1) + solver.get_offset(2), 2);
+        EXPECT_EQ(solver.get_offset(2) + solver.get_offset(3), 2);
+    }
+    ASSERT_EQ(maxLiveSize(boxes), 4);
+}
+
+TEST(BestFitMemorySolverTest, Empty) {
+    BestFitMemorySolver solver({});
+    ASSERT_EQ(solver.solve(true), 0);
+    ASSERT_EQ(maxLiveSize({}), 0);
+}
+
+TEST(BestFitMemorySolverTest, GetOffsetThrowException) {
+    BestFitMemorySolver solver({{0, 1, 2, 0}});
+    solver.solve(false);
+    EXPECT_THROW(solver.get_offset(100), ov::Exception);
+}
+
+TEST(BestFitMemorySolverTest, RandomBoxes) {
+    std::mt19937 gen(42);
+    for (int test = 0; test < 10; test++) {
+        std::vector<Box> boxes;
+        for (int id = 0; id < 200; id++) {
+            const int start = static_cast<int>(gen() % 100);
+            const int finish = gen() % 50 == 0 ? -1 : start + static_cast<int>(gen() % 10);
+            boxes.push_back({start, finish, static_cast<int64_t>(1 + gen() % 1000), id});
+        }
+        const auto lowerBound = maxLiveSize(boxes);
+
+        BestFitMemorySolver bestFit(boxes);
+        const auto bestFitTotal = bestFit.solve(false);
+        checkNoOverlap(boxes, bestFit, bestFitTotal);
+        ASSERT_GE(bestFitTotal, lowerBound);
+
+        BestFitMemorySolver refined(boxes);
+        const auto refinedTotal = refined.solve(true);
+        checkNoOverlap(boxes, refined, refinedTotal);
+        ASSERT_GE(refinedTotal, lowerBound);
+        ASSERT_LE(refinedTotal, bestFitTotal);
+    }
+}
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "utils/idle_watchdog.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+constexpr std::chrono::milliseconds timeout(20);
+
+void waitFor(const std::atomic<int>& counter, int value) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (counter.load() < value && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+}  // namespace
+
+TEST(IdleWatchdogTest, FiresOncePerIdlePeriod) {
+    std::atomic<int> calls{0};
+    IdleWatchdog watchdog(timeout, [&] {
+        calls++;
+        return true;
+    });
+    waitFor(calls, 1);
+    ASSERT_EQ(calls.load(), 1);
+    std::this_thread::sleep_for(5 * timeout);
+    ASSERT_EQ(calls.load(), 1);
+
+    watchdog.touch();
+    waitFor(calls, 2);
+    ASSERT_EQ(calls.load(), 2);
+}
+
+TEST(IdleWatchdogTest, RetriesFailedCallback) {
+    std::atomic<int> calls{0};
+    IdleWatchdog watchdog(timeout, [&] {
+        return ++calls >= 3;
+    });
+    waitFor(calls, 3);
+    std::this_thread::sleep_for(5 * timeout);
+    ASSERT_EQ(calls.load(), 3);
+}
+
+TEST(IdleWatchdogTest, HoldsCountdownDuringActivity) {
+    std::atomic<int> calls{0};
+    IdleWatchdog watchdog(timeout, [&] {
+        calls++;
+        return true;
+    });
+    // the activity which lasts longer than the timeout isn't mistaken for the idle period
+    watchdog.begin();
+    std::this_thread::sleep_for(5 * timeout);
+    ASSERT_EQ(calls.load(), 0);
+
+    watchdog.end();
+    waitFor(calls, 1);
+    ASSERT_EQ(calls.load(), 1);
+}
+
+TEST(IdleWatchdogTest, SharesTimerThread) {
+    constexpr int count = 16;
+    std::atomic<int> calls{0};
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    std::vector<std::unique_ptr<IdleWatchdog>> watchdogs;
+    for (int i = 0; i < count; i++) {
+        watchdogs.push_back(std::make_unique<IdleWatchdog>(timeout * (i % 4 + 1), [&] {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            }
+            calls++;
+            return true;
+        }));
+    }
+    waitFor(calls, count);
+    ASSERT_EQ(calls.load(), count);
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(threads.size(), 1u);
+    ASSERT_EQ(threads.count(std::this_thread::get_id()), 0u);
+}
+
+TEST(IdleWatchdogTest, StopsOnDestruction) {
+    std::atomic<int> calls{0};
+    {
+        IdleWatchdog watchdog(std::chrono::hours(1), [&] {
+            calls++;
+            return true;
+        });
+        watchdog.touch();
+    }
+    ASSERT_EQ(calls.load(), 0);
+}
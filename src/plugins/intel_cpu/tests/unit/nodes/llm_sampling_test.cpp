@@ -0,0 +1,292 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "graph.h"
+#include "graph_context.h"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/log_softmax.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "transformations/cpu_opset/common/op/llm_sampling.hpp"
+#include "transformations/cpu_opset/common/pass/llm_sampling_fusion.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t batch = 3;
+constexpr size_t vocab = 500;
+
+// Every row holds the distinct logits in [-5, 5) put in the different order, so each row has its own top tokens
+ov::Tensor make_logits() {
+    ov::Tensor logits(ov::element::f32, {batch, vocab});
+    auto* data = logits.data<float>();
+    for (size_t b = 0; b < batch; ++b) {
+        for (size_t i = 0; i < vocab; ++i) {
+            const size_t rank = (i * 7 + b * 131) % vocab;
+            data[b * vocab + i] = -5.0f + 10.0f * static_cast<float>(rank) / vocab;
+        }
+    }
+    return logits;
+}
+
+// The ids of the row sorted by the descending logits
+std::vector<int32_t> sorted_ids(const ov::Tensor& logits, size_t row) {
+    const auto* data = logits.data<const float>() + row * vocab;
+    std::vector<int32_t> ids(vocab);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::stable_sort(ids.begin(), ids.end(), [&](int32_t a, int32_t b) {
+        return data[a] > data[b];
+    });
+    return ids;
+}
+
+std::vector<int32_t> infer(const std::shared_ptr<const ov::Model>& model, const std::vector<ov::Tensor>& inputs) {
+    auto context = std::make_shared<GraphContext>(Config{}, nullptr, false);
+    Graph graph;
+    graph.CreateGraph(model, context);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        graph.PushInputData(i, ov::get_tensor_impl(inputs[i]));
+    }
+    graph.Infer();
+    const auto& memory = graph.getOutputNodeByIndex(0)->getParentEdgeAt(0)->getMemory();
+    const auto* data = memory.getDataAs<const int32_t>();
+    return {data, data + memory.getShape().getElementsCount()};
+}
+
+std::shared_ptr<ov::Model> make_sampling(const LLMSamplingNode::Config& config,
+                                         int32_t num_samples,
+                                         bool with_penalized_ids = false) {
+    ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch, vocab})};
+    ov::OutputVector args{params[0], ov::op::v0::Constant::create(ov::element::i32, {}, {num_samples})};
+    if (with_penalized_ids) {
+        params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::Shape{batch, 3}));
+        args.push_back(params[1]);
+    }
+    auto sampling = std::make_shared<LLMSamplingNode>(args, config);
+    return std::make_shared<ov::Model>(ov::OutputVector{sampling}, params);
+}
+
+using LLMSamplingFusionParams = std::tuple<size_t,       // TopK k
+                                           std::string,  // Distribution: Softmax, LogSoftmax or Logits
+                                           bool>;        // With replacement
+
+class LLMSamplingFusionExecTest : public testing::TestWithParam<LLMSamplingFusionParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LLMSamplingFusionParams>& obj) {
+        size_t top_k;
+        std::string distribution;
+        bool with_replacement;
+        std::tie(top_k, distribution, with_replacement) = obj.param;
+        std::ostringstream result;
+        result << "k=" << top_k << "_" << distribution << "_withReplacement=" << with_replacement;
+        return result.str();
+    }
+
+protected:
+    static std::shared_ptr<ov::Model> make_sampling_chain(size_t top_k,
+                                                          const std::string& distribution,
+                                                          bool with_replacement) {
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch, vocab});
+        auto scaled =
+            std::make_shared<ov::op::v1::Divide>(logits, ov::op::v0::Constant::create(ov::element::f32, {}, {0.8f}));
+        auto topk = std::make_shared<ov::op::v11::TopK>(scaled,
+                                                        ov::op::v0::Constant::create(ov::element::i64, {}, {top_k}),
+                                                        -1,
+                                                        ov::op::TopKMode::MAX,
+                                                        ov::op::TopKSortType::SORT_VALUES,
+                                                        ov::element::i32);
+        ov::Output<ov::Node> probs = topk->output(0);
+        bool log_probs = true;
+        if (distribution == "Softmax") {
+            probs = std::make_shared<ov::op::v8::Softmax>(probs, -1);
+            log_probs = false;
+        } else if (distribution == "LogSoftmax") {
+            probs = std::make_shared<ov::op::v5::LogSoftmax>(probs, 1);
+        }
+        auto multinomial =
+            std::make_shared<ov::op::v13::Multinomial>(probs,
+                                                       ov::op::v0::Constant::create(ov::element::i32, {}, {3}),
+                                                       ov::element::i32,
+                                                       with_replacement,
+                                                       log_probs,
+                                                       1,
+                                                       2);
+        auto tokens = std::make_shared<ov::op::v8::Gather>(topk->output(1),
+                                                           multinomial,
+                                                           ov::op::v0::Constant::create(ov::element::i32, {}, {1}),
+                                                           1);
+        return std::make_shared<ov::Model>(ov::OutputVector{tokens}, ov::ParameterVector{logits});
+    }
+
+    static bool has_sampling(const std::shared_ptr<ov::Model>& model) {
+        const auto ops = model->get_ops();
+        return std::any_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& op) {
+            return ov::is_type<LLMSamplingNode>(op);
+        });
+    }
+};
+
+// The fused operation must draw the same tokens as the unfused chain executed by the CPU TopK, Multinomial and Gather
+// nodes, which share the generator and the seeding with it
+TEST_P(LLMSamplingFusionExecTest, MatchesUnfusedGraph) {
+    size_t top_k;
+    std::string distribution;
+    bool with_replacement;
+    std::tie(top_k, distribution, with_replacement) = GetParam();
+
+    auto fused = make_sampling_chain(top_k, distribution, with_replacement);
+    auto unfused = fused->clone();
+    {
+        ov::pass::Manager manager;
+        manager.register_pass<LLMSamplingFusion>();
+        manager.run_passes(fused);
+    }
+    {
+        ov::pass::Manager manager;
+        manager.register_pass<LLMSamplingFusion>();
+        manager.get_pass_config()->set_callback<LLMSamplingFusion>([](const std::shared_ptr<const ov::Node>&) {
+            return true;
+        });
+        manager.run_passes(unfused);
+    }
+    ASSERT_TRUE(has_sampling(fused));
+    ASSERT_FALSE(has_sampling(unfused));
+
+    const auto logits = make_logits();
+    const auto expected = infer(unfused, {logits});
+    const auto actual = infer(fused, {logits});
+    ASSERT_EQ(expected.size(), batch * 3);
+    EXPECT_EQ(expected, actual);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_LLMSamplingFusionExec,
+                         LLMSamplingFusionExecTest,
+                         testing::Combine(testing::Values(4, 40),
+                                          testing::Values("Softmax", "LogSoftmax", "Logits"),
+                                          testing::Values(true, false)),
+                         LLMSamplingFusionExecTest::getTestCaseName);
+
+}  // namespace
+
+TEST(LLMSamplingNodeTest, TopPKeepsTheNucleus) {
+    constexpr int32_t num_samples = 64;
+    constexpr float top_p = 0.3f;
+    LLMSamplingNode::Config config;
+    config.top_p = top_p;
+    config.global_seed = 3;
+    config.op_seed = 4;
+    config.output_type = ov::element::i32;
+
+    const auto logits = make_logits();
+    const auto tokens = infer(make_sampling(config, num_samples), {logits});
+    ASSERT_EQ(tokens.size(), batch * num_samples);
+
+    for (size_t b = 0; b < batch; ++b) {
+        // the smallest set of the most probable tokens whose probability reaches top_p, the next token is let in
+        // as well since the sums are rounded differently
+        const auto ids = sorted_ids(logits, b);
+        const auto* data = logits.data<const float>() + b * vocab;
+        std::vector<double> weights(vocab);
+        double total = 0.0;
+        for (size_t i = 0; i < vocab; ++i) {
+            weights[i] = std::exp(static_cast<double>(data[ids[i]] - data[ids[0]]));
+            total += weights[i];
+        }
+        std::set<int32_t> nucleus;
+        double cumulative = 0.0;
+        for (size_t i = 0; i < vocab && cumulative < top_p * total; ++i) {
+            nucleus.insert(ids[i]);
+            cumulative += weights[i];
+        }
+        ASSERT_GT(nucleus.size(), 1u);
+        nucleus.insert(ids[nucleus.size()]);
+        ASSERT_LT(nucleus.size(), vocab);
+
+        for (int32_t s = 0; s < num_samples; ++s) {
+            EXPECT_EQ(nucleus.count(tokens[b * num_samples + s]), 1u) << "row " << b << ", sample " << s;
+        }
+    }
+
+    // the nucleus of a tiny top_p holds only the most probable token
+    config.top_p = 1e-6f;
+    const auto greedy = infer(make_sampling(config, num_samples), {logits});
+    for (size_t b = 0; b < batch; ++b) {
+        const auto argmax = sorted_ids(logits, b)[0];
+        for (int32_t s = 0; s < num_samples; ++s) {
+            EXPECT_EQ(greedy[b * num_samples + s], argmax);
+        }
+    }
+}
+
+TEST(LLMSamplingNodeTest, PenalizedIdsDemoteTokens) {
+    LLMSamplingNode::Config config;
+    config.top_k = 1;
+    config.repetition_penalty = 10.0f;
+    config.output_type = ov::element::i32;
+
+    // the positive logits, so the penalty divides the top score well below the second one
+    auto logits = make_logits();
+    auto* data = logits.data<float>();
+    for (size_t i = 0; i < logits.get_size(); ++i) {
+        data[i] += 6.0f;
+    }
+
+    // the first row penalizes its best token, the others penalize the tokens which aren't the best, the ids outside
+    // of the vocabulary are ignored
+    ov::Tensor penalized_ids(ov::element::i32, {batch, 3});
+    auto* ids_data = penalized_ids.data<int32_t>();
+    std::vector<int32_t> expected(batch);
+    for (size_t b = 0; b < batch; ++b) {
+        const auto ids = sorted_ids(logits, b);
+        ids_data[b * 3] = b == 0 ? ids[0] : ids[vocab - 1];
+        ids_data[b * 3 + 1] = -1;
+        ids_data[b * 3 + 2] = static_cast<int32_t>(vocab + 5);
+        expected[b] = b == 0 ? ids[1] : ids[0];
+    }
+
+    const auto tokens = infer(make_sampling(config, 1, true), {logits, penalized_ids});
+    EXPECT_EQ(tokens, expected);
+}
+
+TEST(LLMSamplingNodeTest, WithoutReplacementDrawsDistinctTokens) {
+    constexpr size_t top_k = 8;
+    LLMSamplingNode::Config config;
+    config.top_k = top_k;
+    config.with_replacement = false;
+    config.global_seed = 5;
+    config.op_seed = 6;
+    config.output_type = ov::element::i32;
+
+    // all the top_k tokens are drawn, each of them once
+    const auto logits = make_logits();
+    const auto tokens = infer(make_sampling(config, static_cast<int32_t>(top_k)), {logits});
+    ASSERT_EQ(tokens.size(), batch * top_k);
+    for (size_t b = 0; b < batch; ++b) {
+        const auto ids = sorted_ids(logits, b);
+        std::vector<int32_t> expected(ids.begin(), ids.begin() + top_k);
+        std::vector<int32_t> actual(tokens.begin() + b * top_k, tokens.begin() + (b + 1) * top_k);
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        EXPECT_EQ(actual, expected) << "row " << b;
+    }
+}
@@ -0,0 +1,170 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "paged_mem_blk.h"
+
+using namespace ov::intel_cpu;
+
+TEST(PagedMemoryBlockTest, GrowsInPlace) {
+    constexpr size_t block = 4096;
+    PagedMemoryBlock blk(block, 16 * block);
+    ASSERT_EQ(blk.getRawPtr(), nullptr);
+
+    ASSERT_TRUE(blk.resize(100));
+    auto ptr = static_cast<uint8_t*>(blk.getRawPtr());
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_EQ(blk.committedSize() % blk.blockSize(), 0);
+    std::memset(ptr, 0x5a, 100);
+
+    // growing within the reserved range neither moves nor reallocates the data
+    ASSERT_FALSE(blk.resize(5 * block));
+    ASSERT_EQ(blk.getRawPtr(), ptr);
+    ASSERT_GE(blk.committedSize(), 5 * block);
+    std::memset(ptr + 100, 0x3c, 5 * block - 100);
+    for (size_t i = 0; i < 100; i++) {
+        ASSERT_EQ(ptr[i], 0x5a);
+    }
+    ASSERT_FALSE(blk.resize(block));
+}
+
+TEST(PagedMemoryBlockTest, Release) {
+    constexpr size_t block = 4096;
+    PagedMemoryBlock blk(block, 16 * block);
+    blk.resize(8 * block);
+    auto ptr = static_cast<uint8_t*>(blk.getRawPtr());
+    std::memset(ptr, 0x5a, 8 * block);
+
+    blk.release(2 * blk.blockSize());
+    ASSERT_EQ(blk.committedSize(), 2 * blk.blockSize());
+    ASSERT_EQ(ptr[0], 0x5a);
+
+    // released blocks come back zero filled
+    ASSERT_FALSE(blk.resize(8 * block));
+    ASSERT_EQ(blk.getRawPtr(), ptr);
+    ASSERT_EQ(ptr[0], 0x5a);
+    ASSERT_EQ(ptr[8 * block - 1], 0);
+
+    blk.release();
+    ASSERT_EQ(blk.committedSize(), 0);
+    ASSERT_EQ(blk.getRawPtr(), ptr);
+}
+
+TEST(PagedMemoryBlockTest, MovesOutOfReservedRange) {
+    constexpr size_t block = 4096;
+    PagedMemoryBlock blk(block, 2 * block);
+    blk.resize(2 * block);
+    auto ptr = static_cast<uint8_t*>(blk.getRawPtr());
+    for (size_t i = 0; i < 2 * block; i++) {
+        ptr[i] = static_cast<uint8_t>(i);
+    }
+
+    // the first reservation is twice as big as the requested size
+    ASSERT_FALSE(blk.resize(4 * block));
+    ASSERT_TRUE(blk.resize(5 * block));
+    ASSERT_GE(blk.reservedSize(), 10 * block);
+    ptr = static_cast<uint8_t*>(blk.getRawPtr());
+    for (size_t i = 0; i < 2 * block; i++) {
+        ASSERT_EQ(ptr[i], static_cast<uint8_t>(i));
+    }
+}
+
+TEST(PagedMemoryBlockTest, MemoryRedefine) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto block = std::make_unique<PagedMemoryBlock>(4096);
+    auto* paged = block.get();
+    Memory mem(eng,
+               std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{1, 1024}),
+               std::make_shared<DnnlMemoryBlock>(std::move(block)));
+    auto ptr = mem.getDataAs<float>();
+    ptr[0] = 1.f;
+    auto committed = paged->committedSize();
+
+    mem.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{16, 1024}));
+    ASSERT_EQ(mem.getDataAs<float>(), ptr);
+    ASSERT_EQ(ptr[0], 1.f);
+    ASSERT_GT(paged->committedSize(), committed);
+    ASSERT_EQ(mem.getPrimitive().get_data_handle(), ptr);
+}
+
+TEST(PagedMemoryBlockTest, Share) {
+    constexpr size_t block = 4096;
+    PagedMemoryBlock src(block);
+    src.resize(4 * block);
+    auto src_ptr = static_cast<uint8_t*>(src.getRawPtr());
+    for (size_t i = 0; i < 4 * block; i++) {
+        src_ptr[i] = static_cast<uint8_t>(i);
+    }
+
+    PagedMemoryBlock dst(block);
+    dst.resize(block);
+    auto shared = dst.share(src, 2 * block + 100, 3 * block + 100);
+    ASSERT_LE(shared, 2 * block);
+    ASSERT_GE(dst.committedSize(), 3 * block + 100);
+    auto dst_ptr = static_cast<uint8_t*>(dst.getRawPtr());
+    for (size_t i = 0; i < 3 * block + 100; i++) {
+        ASSERT_EQ(dst_ptr[i], static_cast<uint8_t>(i));
+    }
+
+    // the unshared tail belongs to each block
+    dst_ptr[3 * block] = 0;
+    ASSERT_EQ(src_ptr[3 * block], static_cast<uint8_t>(3 * block));
+
+    // the shared pages survive when the source drops them
+    src.release();
+    for (size_t i = 0; i < 2 * block; i++) {
+        ASSERT_EQ(dst_ptr[i], static_cast<uint8_t>(i));
+    }
+}
+
+TEST(PagedMemoryBlockTest, ShareIsCopyOnWrite) {
+    constexpr size_t block = 4096;
+    PagedMemoryBlock src(block);
+    src.resize(4 * block);
+    auto src_ptr = static_cast<uint8_t*>(src.getRawPtr());
+    std::memset(src_ptr, 1, 4 * block);
+
+    PagedMemoryBlock dst(block);
+    dst.resize(block);
+    dst.share(src, 4 * block, 4 * block);
+    auto dst_ptr = static_cast<uint8_t*>(dst.getRawPtr());
+
+    // a write to one of the blocks is never seen by the other one
+    dst_ptr[0] = 2;
+    src_ptr[block] = 3;
+    ASSERT_EQ(src_ptr[0], 1);
+    ASSERT_EQ(dst_ptr[block], 1);
+
+    // the next fork takes the current content of the source, including the pages written after the first fork
+    PagedMemoryBlock dst2(block);
+    dst2.resize(block);
+    dst2.share(src, 4 * block, 4 * block);
+    auto dst2_ptr = static_cast<uint8_t*>(dst2.getRawPtr());
+    ASSERT_EQ(dst2_ptr[0], 1);
+    ASSERT_EQ(dst2_ptr[block], 3);
+
+    // a fork of a fork
+    PagedMemoryBlock dst3(block);
+    dst3.resize(block);
+    dst3.share(dst, 4 * block, 4 * block);
+    auto dst3_ptr = static_cast<uint8_t*>(dst3.getRawPtr());
+    ASSERT_EQ(dst3_ptr[0], 2);
+    ASSERT_EQ(dst3_ptr[block], 1);
+    dst3_ptr[2 * block] = 4;
+    for (auto* ptr : {src_ptr, dst_ptr, dst2_ptr}) {
+        ASSERT_EQ(ptr[2 * block], 1);
+    }
+
+    // the released source pages come back zero filled, the forks keep their content
+    src.release();
+    src.resize(4 * block);
+    ASSERT_EQ(src_ptr[block], 0);
+    ASSERT_EQ(dst2_ptr[block], 3);
+    ASSERT_EQ(dst_ptr[3 * block], 1);
+}
@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "perf_count.h"
+
+using namespace ov::intel_cpu;
+
+TEST(LatencyHistogramTest, Empty) {
+    LatencyHistogram histogram;
+    ASSERT_EQ(histogram.count(), 0);
+    ASSERT_EQ(histogram.percentile(99.0), 0);
+    ASSERT_EQ(histogram.max(), 0);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram;
+    for (uint64_t ns = 1; ns <= 100000; ns++) {
+        histogram.record(ns);
+    }
+    ASSERT_EQ(histogram.count(), 100000);
+    ASSERT_EQ(histogram.max(), 100000);
+    // the relative error is bounded by the number of sub buckets per power of two
+    for (double percent : {50.0, 90.0, 99.0}) {
+        const auto expected = static_cast<uint64_t>(percent * 1000);
+        const auto actual = histogram.percentile(percent);
+        ASSERT_GE(actual, expected);
+        ASSERT_LE(actual, expected + expected / LatencyHistogram::sub_bucket_count);
+    }
+    ASSERT_EQ(histogram.percentile(100.0), 100000);
+}
+
+TEST(LatencyHistogramTest, TailIsVisible) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 990; i++) {
+        histogram.record(1000);
+    }
+    for (int i = 0; i < 10; i++) {
+        histogram.record(10000);
+    }
+    ASSERT_LE(histogram.percentile(50.0), 1000 + 1000 / LatencyHistogram::sub_bucket_count);
+    ASSERT_LE(histogram.percentile(99.0), 1000 + 1000 / LatencyHistogram::sub_bucket_count);
+    ASSERT_GE(histogram.percentile(99.9), 10000);
+    ASSERT_EQ(histogram.max(), 10000);
+}
+
+TEST(LatencyHistogramTest, MergeAndReset) {
+    LatencyHistogram first, second, merged;
+    first.record(10);
+    second.record(1000000);
+    merged.merge(first);
+    merged.merge(second);
+    ASSERT_EQ(merged.count(), 2);
+    ASSERT_EQ(merged.percentile(50.0), 10);
+    ASSERT_EQ(merged.max(), 1000000);
+
+    merged.reset();
+    ASSERT_EQ(merged.count(), 0);
+    ASSERT_EQ(merged.percentile(50.0), 0);
+}
+
+TEST(PerfCountTest, HistogramIsOptIn) {
+    PerfCount counter;
+    { PerfHelper helper(counter); }
+    ASSERT_EQ(counter.count(), 1);
+    ASSERT_EQ(counter.histogram(), nullptr);
+
+    counter.enable_histogram();
+    { PerfHelper helper(counter); }
+    ASSERT_EQ(counter.count(), 2);
+    ASSERT_NE(counter.histogram(), nullptr);
+    ASSERT_EQ(counter.histogram()->count(), 1);
+
+    counter.reset();
+    ASSERT_EQ(counter.count(), 0);
+    ASSERT_EQ(counter.histogram()->count(), 0);
+}
@@ -9,6 +9,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/sharded_lru_cache.h"
 #include "common_test_utils/test_assertions.hpp"
 
 using namespace ov::intel_cpu;
@@ -97,6 +98,53 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(ShardedLruCacheTests, PutGet) {
+    constexpr int capacity = 64;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    OV_ASSERT_NO_THROW(cache.evict(capacity));
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ShardedLruCacheTests, Capacity) {
+    constexpr int capacity = 16;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    size_t evicted = 0;
+    for (int i = 0; i < 10 * capacity; ++i) {
+        evicted += cache.put({i}, i);
+    }
+    ASSERT_EQ(cache.getCapacity(), capacity);
+    ASSERT_GE(evicted, 10 * capacity - capacity);
+
+    size_t stored = 0;
+    for (int i = 0; i < 10 * capacity; ++i) {
+        stored += cache.get({i}) != int();
+    }
+    ASSERT_LE(stored, capacity);
+}
+
+TEST(ShardedLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr int attempts = 10;
+    ShardedLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -380,3 +428,84 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, Statistics) {
+    using IntValueType = std::shared_ptr<int>;
+    constexpr int capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NE(cache.getOrCreate(IntKey{i}, intBuilder).first, IntValueType());
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_NE(cache.getOrCreate(IntKey{i}, intBuilder).first, IntValueType());
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits, capacity);
+    ASSERT_EQ(stats.misses, 2 * capacity);
+    ASSERT_EQ(stats.evictions, capacity);
+}
+
+TEST(MultiCacheTests, Clear) {
+    constexpr int capacity = 10;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    for (bool threadSafe : {false, true}) {
+        MultiCache cache(capacity, threadSafe);
+        for (int i = 0; i < capacity; ++i) {
+            cache.getOrCreate(IntKey{i}, intBuilder);
+        }
+        cache.clear();
+        for (int i = 0; i < capacity; ++i) {
+            ASSERT_EQ(cache.getOrCreate(IntKey{i}, intBuilder).second, CacheEntryBase::LookUpStatus::Miss);
+        }
+        // the counters survive the clean up
+        ASSERT_EQ(cache.getStatistics().misses, 2 * capacity);
+    }
+}
+
+TEST(MultiCacheTests, SmokeSharedThreadSafe) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 100;
+    constexpr int numKeys = 10;
+    constexpr size_t numThreads = 30;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, true);
+    ASSERT_TRUE(cache.isThreadSafe());
+
+    auto testRoutine = [&]() {
+        for (int iter = 0; iter < 100; ++iter) {
+            for (int i = 0; i < numKeys; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+                auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+                ASSERT_NE(strResult.first, StrValueType());
+                ASSERT_EQ(*strResult.first, std::to_string(i));
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, 2 * numThreads * 100 * numKeys);
+    // all the threads share the records, so each key is built a few times at most
+    ASSERT_LE(stats.misses, 2 * numThreads * numKeys);
+    ASSERT_EQ(stats.evictions, 0);
+}
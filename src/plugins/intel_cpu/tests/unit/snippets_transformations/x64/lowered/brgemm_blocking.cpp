@@ -3,10 +3,12 @@
 //
 
 #include "transformations/snippets/x64/pass/lowered/brgemm_cpu_blocking.hpp"
+#include "transformations/snippets/x64/pass/lowered/brgemm_blocking_tuner.hpp"
 #ifdef SNIPPETS_LIBXSMM_TPP
     #include "transformations/tpp/common/pass/lowered/brgemm_tpp_blocking.hpp"
 #endif
 
+#include "common_test_utils/test_assertions.hpp"
 #include "lir_test_utils.hpp"
 #include "openvino/opsets/opset10_decl.hpp"
 #include "snippets/lowered/loop_info.hpp"
@@ -16,6 +18,9 @@
 #include "transformations/tpp/common/op/brgemm.hpp"
 #include "cpu/x64/cpu_isa_traits.hpp"
 
+#include <algorithm>
+#include <cstdio>
+
 namespace ov {
 namespace test {
 namespace snippets {
@@ -168,6 +173,116 @@ TEST_F(BrgemmCPUBlockingTest, Floating_LargeK) {
     }
 }
 
+class BrgemmCPUBlockingTunedTest : public BrgemmBlockingTest {
+public:
+    BrgemmCPUBlockingTunedTest() : BrgemmBlockingTest() {
+        m_blk = 64;
+        k_blk = 256;
+        n_blk = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ? 128 : 48;
+    }
+
+    void SetUp() override {
+        // The winner is registered explicitly to make the expected blocking independent of the timings
+        auto& tuner = ov::intel_cpu::pass::BrgemmBlockingTuner::instance();
+        tuner.clear();
+        tuner.set_blocking(get_key(), {m_blk, n_blk, k_blk});
+        pipeline.register_pass<ov::intel_cpu::pass::BrgemmCPUBlocking>(true);
+    }
+
+protected:
+    static ov::intel_cpu::pass::BrgemmBlockingTuner::Key get_key() {
+        return {m, n, k, ov::element::f32, brgemm_utils::get_primitive_isa(ov::element::f32, false)};
+    }
+
+    static constexpr size_t m = 384;
+    static constexpr size_t n = 384;
+    static constexpr size_t k = 2048;
+};
+
+TEST_F(BrgemmCPUBlockingTunedTest, Floating) {
+    const ov::PartialShape input_shape_a{1, 16, m, k};
+    const ov::PartialShape input_shape_b{1, 16, k, n};
+    const auto precision = ov::element::f32;
+
+    {
+        auto data_a = linear_ir->push_node<ov::opset10::Parameter>(precision, input_shape_a);
+        auto data_b = linear_ir->push_node<ov::opset10::Parameter>(precision, input_shape_b);
+        auto brgemm = linear_ir->push_node<BrgemmCPU>(data_a.second, data_b.second, BRGEMM_TYPE::STAND_ALONE);
+        init_expr_descriptors(*brgemm.first, {});
+        auto result = linear_ir->push_node<ov::opset10::Result>(brgemm.second);
+    }
+    {
+        auto data_a = linear_ir_ref->push_node<ov::opset10::Parameter>(precision, input_shape_a);
+        auto data_b = linear_ir_ref->push_node<ov::opset10::Parameter>(precision, input_shape_b);
+        auto brgemm = linear_ir_ref->push_node<BrgemmCPU>(data_a.second, data_b.second, BRGEMM_TYPE::STAND_ALONE);
+        const auto& brgemm_expr = *brgemm.first;
+        init_expr_descriptors(brgemm_expr, {{m_blk, k_blk}, {k_blk, n_blk}, {m_blk, n_blk}});
+        create_brgemm_loop_infos(linear_ir_ref, brgemm_expr, m, m_blk, k, k_blk, n, n_blk);
+        brgemm_expr->set_loop_ids({2, 1, 0});
+        auto result = linear_ir_ref->push_node<ov::opset10::Result>(brgemm.second);
+    }
+}
+
+TEST(BrgemmBlockingTuner, PersistedBlockings) {
+    using Tuner = ov::intel_cpu::pass::BrgemmBlockingTuner;
+    auto& tuner = Tuner::instance();
+    const std::string file = "brgemm_blocking_tuner_test.txt";
+    const auto full_dim = ov::snippets::utils::get_full_dim_value();
+    const Tuner::Key key{128, 96, 64, ov::element::f32, brgemm_utils::get_primitive_isa(ov::element::f32, false)};
+    // The blocking isn't among the candidates, so it can be returned only from the file
+    const Tuner::Blocking blocking{8, full_dim, 16};
+
+    tuner.clear();
+    tuner.set_blocking(key, blocking);
+    tuner.save(file);
+    tuner.clear();
+    EXPECT_EQ(tuner.get_blocking(key, {32, full_dim, full_dim}, file), blocking);
+
+    tuner.clear();
+    std::remove(file.c_str());
+}
+
+TEST(BrgemmBlockingTuner, TunesSmallShape) {
+    using Tuner = ov::intel_cpu::pass::BrgemmBlockingTuner;
+    auto& tuner = Tuner::instance();
+    const auto full_dim = ov::snippets::utils::get_full_dim_value();
+    const Tuner::Key key{64, 64, 64, ov::element::f32, brgemm_utils::get_primitive_isa(ov::element::f32, false)};
+    if (!Tuner::is_supported(key)) {
+        GTEST_SKIP() << "The brgemm of the key isn't supported on the machine";
+    }
+    const Tuner::Blocking heuristic{32, full_dim, full_dim};
+    const auto candidates = Tuner::get_candidates(key, heuristic);
+    ASSERT_GT(candidates.size(), 1u);
+    for (const auto& candidate : candidates) {
+        EXPECT_GT(Tuner::benchmark(key, candidate), 0);
+    }
+
+    tuner.clear();
+    const auto tuned = tuner.get_blocking(key, heuristic);
+    EXPECT_NE(std::find(candidates.begin(), candidates.end(), tuned), candidates.end());
+    // The winner is stored, the next compilations take it without timing
+    EXPECT_EQ(tuner.get_blocking(key, {16, full_dim, 32}), tuned);
+    tuner.clear();
+}
+
+TEST(BrgemmBlockingTuner, UnwritableFileIsSkipped) {
+    using Tuner = ov::intel_cpu::pass::BrgemmBlockingTuner;
+    auto& tuner = Tuner::instance();
+    const auto full_dim = ov::snippets::utils::get_full_dim_value();
+    const Tuner::Key key{32, 64, 32, ov::element::f32, brgemm_utils::get_primitive_isa(ov::element::f32, false)};
+    if (!Tuner::is_supported(key)) {
+        GTEST_SKIP() << "The brgemm of the key isn't supported on the machine";
+    }
+    const std::string file = "brgemm_blocking_tuner_missing_dir/brgemm_blocking_tuner_test.txt";
+
+    tuner.clear();
+    Tuner::Blocking tuned;
+    OV_ASSERT_NO_THROW(tuned = tuner.get_blocking(key, {16, full_dim, full_dim}, file));
+    EXPECT_EQ(tuner.get_blocking(key, {8, full_dim, full_dim}, file), tuned);
+    OV_EXPECT_THROW(tuner.save(file), ov::Exception, testing::HasSubstr("cannot open"));
+    tuner.clear();
+}
+
 TEST_F(BrgemmCPUBlockingTest, BlockingIsNotNeeded) {
     const ov::Dimension::value_type m = 32;
     const ov::Dimension::value_type k = 16;
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/multinomial.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/topk.hpp"
+#include "transformations/cpu_opset/common/op/llm_sampling.hpp"
+#include "transformations/cpu_opset/common/pass/llm_sampling_fusion.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t top_k = 4;
+constexpr int32_t num_samples = 3;
+constexpr float temperature = 0.8f;
+
+// The intermediate outputs of the chain which can be used by one more consumer
+enum class SharedOutput { NONE, TOPK_VALUES, TOPK_INDICES, SOFTMAX, MULTINOMIAL };
+
+std::shared_ptr<ov::Model> make_sampling_chain(ov::op::TopKSortType sort_type,
+                                               SharedOutput shared = SharedOutput::NONE) {
+    auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 1000});
+    auto scaled =
+        std::make_shared<ov::op::v1::Divide>(logits, ov::op::v0::Constant::create(ov::element::f32, {}, {temperature}));
+    auto topk = std::make_shared<ov::op::v11::TopK>(scaled,
+                                                    ov::op::v0::Constant::create(ov::element::i64, {}, {top_k}),
+                                                    -1,
+                                                    ov::op::TopKMode::MAX,
+                                                    sort_type,
+                                                    ov::element::i32);
+    auto probs = std::make_shared<ov::op::v8::Softmax>(topk->output(0), -1);
+    auto multinomial =
+        std::make_shared<ov::op::v13::Multinomial>(probs,
+                                                   ov::op::v0::Constant::create(ov::element::i32, {}, {num_samples}),
+                                                   ov::element::i32,
+                                                   true,
+                                                   false,
+                                                   1,
+                                                   2);
+    auto tokens = std::make_shared<ov::op::v8::Gather>(topk->output(1),
+                                                       multinomial,
+                                                       ov::op::v0::Constant::create(ov::element::i32, {}, {1}),
+                                                       1);
+    ov::OutputVector results{tokens};
+    switch (shared) {
+    case SharedOutput::TOPK_VALUES:
+        results.push_back(topk->output(0));
+        break;
+    case SharedOutput::TOPK_INDICES:
+        results.push_back(topk->output(1));
+        break;
+    case SharedOutput::SOFTMAX:
+        results.push_back(probs);
+        break;
+    case SharedOutput::MULTINOMIAL:
+        results.push_back(multinomial);
+        break;
+    default:
+        break;
+    }
+    return std::make_shared<ov::Model>(results, ov::ParameterVector{logits});
+}
+
+}  // namespace
+
+TEST_F(TransformationTestsF, LLMSamplingFusion) {
+    model = make_sampling_chain(ov::op::TopKSortType::SORT_VALUES);
+    manager.register_pass<LLMSamplingFusion>();
+    {
+        auto logits = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 1000});
+        LLMSamplingNode::Config config;
+        config.temperature = temperature;
+        config.top_k = top_k;
+        config.with_replacement = true;
+        config.global_seed = 1;
+        config.op_seed = 2;
+        config.output_type = ov::element::i32;
+        auto sampling = std::make_shared<LLMSamplingNode>(
+            ov::OutputVector{logits, ov::op::v0::Constant::create(ov::element::i32, {}, {num_samples})},
+            config);
+        model_ref = std::make_shared<ov::Model>(ov::OutputVector{sampling}, ov::ParameterVector{logits});
+    }
+}
+
+TEST_F(TransformationTestsF, LLMSamplingFusionSkipsUnsortedTopK) {
+    // The positions drawn by Multinomial refer to the TopK outputs in the order of the indices, not of the scores
+    model = make_sampling_chain(ov::op::TopKSortType::SORT_INDICES);
+    manager.register_pass<LLMSamplingFusion>();
+}
+
+TEST_F(TransformationTestsF, LLMSamplingFusionDisabledByCallback) {
+    model = make_sampling_chain(ov::op::TopKSortType::SORT_VALUES);
+    manager.register_pass<LLMSamplingFusion>();
+    manager.get_pass_config()->set_callback<LLMSamplingFusion>([](const std::shared_ptr<const ov::Node>&) {
+        return true;
+    });
+}
+
+class LLMSamplingFusionSharedOutputTest : public TransformationTestsF, public WithParamInterface<SharedOutput> {};
+
+// The chain whose intermediate output is used elsewhere stays as is: the other consumer would see the samples which
+// the fused operation doesn't draw
+TEST_P(LLMSamplingFusionSharedOutputTest, NotFused) {
+    model = make_sampling_chain(ov::op::TopKSortType::SORT_VALUES, GetParam());
+    manager.register_pass<LLMSamplingFusion>();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_LLMSamplingFusion,
+                         LLMSamplingFusionSharedOutputTest,
+                         Values(SharedOutput::TOPK_VALUES,
+                                SharedOutput::TOPK_INDICES,
+                                SharedOutput::SOFTMAX,
+                                SharedOutput::MULTINOMIAL));
@@ -0,0 +1,145 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "openvino/op/parameter.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+MemoryPtr makeMemory(const dnnl::engine& eng, size_t elements) {
+    return std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{elements}));
+}
+
+std::shared_ptr<ov::Model> makeModel() {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1});
+    return std::make_shared<ov::Model>(ov::OutputVector{param}, ov::ParameterVector{param});
+}
+}  // namespace
+
+TEST(WeightsSharingTest, Statistics) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    WeightsSharing cache;
+    MemoryPtr first = *cache.findOrCreate("a", [&] {
+        return makeMemory(eng, 16);
+    });
+    MemoryPtr second = *cache.findOrCreate("a", [&] {
+        return makeMemory(eng, 16);
+    });
+    ASSERT_EQ(first, second);
+
+    auto stats = cache.dumpStatistics();
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 1);
+    ASSERT_EQ(stats.total_memory_objects, 1);
+    ASSERT_EQ(stats.total_size, 16 * sizeof(float));
+
+    // the pinned object survives its last user
+    ASSERT_EQ(cache.pin(), 16 * sizeof(float));
+    first.reset();
+    second.reset();
+    ASSERT_EQ(cache.dumpStatistics().total_memory_objects, 1);
+    cache.unpin();
+    ASSERT_EQ(cache.dumpStatistics().total_memory_objects, 0);
+}
+
+TEST(WeightsRetentionTest, Reclaim) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto retention = std::make_shared<WeightsRetention>();
+    retention->setBudget(1024);
+    auto model = makeModel();
+    WeightsRetention::Ticket ticket{retention, "model"};
+
+    {
+        SocketsWeights weights;
+        MemoryPtr memory = *weights[0]->findOrCreate("a", [&] {
+            return makeMemory(eng, 16);
+        });
+        retention->retain(ticket, model, weights);
+    }
+
+    auto retained = retention->reclaim(ticket);
+    ASSERT_TRUE(retained.has_value());
+    bool created = false;
+    MemoryPtr memory = *retained->weights[0]->findOrCreate("a", [&] {
+        created = true;
+        return makeMemory(eng, 16);
+    });
+    ASSERT_FALSE(created);
+    const auto stats = retention->getStatistics();
+    ASSERT_EQ(stats.reuses, 1);
+    ASSERT_EQ(stats.retained_size, 0);
+}
+
+TEST(WeightsRetentionTest, Budget) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto retention = std::make_shared<WeightsRetention>();
+    retention->setBudget(100 * sizeof(float));
+    auto model = makeModel();
+
+    for (const std::string key : {"first", "second"}) {
+        SocketsWeights weights;
+        MemoryPtr memory = *weights[0]->findOrCreate("a", [&] {
+            return makeMemory(eng, 64);
+        });
+        retention->retain({retention, key}, model, weights);
+    }
+    // the least recently retained caches are evicted
+    auto stats = retention->getStatistics();
+    ASSERT_EQ(stats.retained_models, 1);
+    ASSERT_EQ(stats.evictions, 1);
+    ASSERT_FALSE(retention->reclaim({retention, "first"}).has_value());
+    ASSERT_TRUE(retention->reclaim({retention, "second"}).has_value());
+
+    // too big caches are not kept at all
+    {
+        SocketsWeights weights;
+        MemoryPtr memory = *weights[0]->findOrCreate("a", [&] {
+            return makeMemory(eng, 128);
+        });
+        retention->retain({retention, "third"}, model, weights);
+    }
+    ASSERT_EQ(retention->getStatistics().retained_models, 0);
+
+    retention->setBudget(0);
+    ASSERT_EQ(retention->getStatistics().budget, 0);
+}
+
+TEST(WeightsRetentionTest, BudgetCoversLiveWeights) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto retention = std::make_shared<WeightsRetention>();
+    retention->setBudget(100 * sizeof(float));
+    auto model = makeModel();
+
+    {
+        SocketsWeights weights;
+        MemoryPtr memory = *weights[0]->findOrCreate("a", [&] {
+            return makeMemory(eng, 32);
+        });
+        retention->retain({retention, "released"}, model, weights);
+    }
+    ASSERT_EQ(retention->getStatistics().retained_models, 1);
+
+    // the weights of a live compiled model leave no room for the released ones
+    SocketsWeights live;
+    MemoryPtr memory = *live[0]->findOrCreate("b", [&] {
+        return makeMemory(eng, 80);
+    });
+    retention->track(live);
+    auto stats = retention->getStatistics();
+    ASSERT_EQ(stats.live_size, 80 * sizeof(float));
+    ASSERT_EQ(stats.retained_models, 0);
+    ASSERT_EQ(stats.evictions, 1);
+
+    // once released, the live weights are retained instead
+    retention->retain({retention, "live"}, model, live);
+    stats = retention->getStatistics();
+    ASSERT_EQ(stats.live_size, 0);
+    ASSERT_EQ(stats.retained_models, 1);
+    ASSERT_EQ(stats.retained_size, 80 * sizeof(float));
+}
@@ -26,6 +26,7 @@ public:
     MOCK_METHOD(bool, wait_for, (const std::chrono::milliseconds&));
     MOCK_METHOD(void, cancel, ());
     MOCK_METHOD(void, set_callback, (std::function<void(std::exception_ptr)>));
+    MOCK_METHOD(void, set_priority, (ov::hint::Priority));
     MOCK_METHOD(void, infer, ());
     MOCK_METHOD(std::vector<ov::ProfilingInfo>, get_profiling_info, (), (const));
     MOCK_METHOD(std::vector<ov::SoPtr<ov::IVariableState>>, query_state, (), (const));